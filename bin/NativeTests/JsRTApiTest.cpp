@@ -1932,4 +1932,518 @@ namespace JsRTApiTest
         JsRTApiTest::WithSetup(JsRuntimeAttributeEnableExperimentalFeatures, ReentrantNoErrorParseModuleTest);
     }
 
+    struct DynamicCodeCacheTracker
+    {
+        std::map<uint64_t, std::pair<uint8_t *, unsigned int>> entries;
+        int lookups;
+        int hits;
+        int stores;
+    };
+
+    bool CHAKRA_CALLBACK DynamicCodeCacheLookup(void *callbackState, uint64_t key, const uint8_t *source, size_t sourceLength,
+        const uint8_t **buffer, unsigned int *bufferSize)
+    {
+        DynamicCodeCacheTracker *tracker = (DynamicCodeCacheTracker *)callbackState;
+        tracker->lookups++;
+        auto entry = tracker->entries.find(key);
+        if (entry == tracker->entries.end())
+        {
+            return false;
+        }
+        tracker->hits++;
+        *buffer = entry->second.first;
+        *bufferSize = entry->second.second;
+        return true;
+    }
+
+    void CHAKRA_CALLBACK DynamicCodeCacheStore(void *callbackState, uint64_t key, const uint8_t *source, size_t sourceLength,
+        const uint8_t *buffer, unsigned int bufferSize)
+    {
+        DynamicCodeCacheTracker *tracker = (DynamicCodeCacheTracker *)callbackState;
+        tracker->stores++;
+        uint8_t *copy = new uint8_t[bufferSize];
+        memcpy(copy, buffer, bufferSize);
+        tracker->entries[key] = std::make_pair(copy, bufferSize);
+    }
+
+    void DynamicCodeCacheTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("var f = new Function('a', 'b', 'return a * b + (function () { return 1; })();'); f(6, 7) + (0, eval)('40 + 2');");
+        DynamicCodeCacheTracker tracker = {};
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int intValue;
+
+        REQUIRE(JsSetDynamicCodeCacheCallbacks(runtime, &tracker, DynamicCodeCacheLookup, DynamicCodeCacheStore) == JsNoError);
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 85);
+        CHECK(tracker.hits == 0);
+        CHECK(tracker.stores == 2);
+
+        // A fresh runtime gets the byte code from the cache instead of compiling it.
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        REQUIRE(JsSetDynamicCodeCacheCallbacks(second, &tracker, DynamicCodeCacheLookup, DynamicCodeCacheStore) == JsNoError);
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 85);
+        CHECK(tracker.hits == 2);
+        CHECK(tracker.stores == 2);
+
+        // Nothing is serialized for a host that only looks code up
+        REQUIRE(JsSetDynamicCodeCacheCallbacks(second, &tracker, DynamicCodeCacheLookup, nullptr) == JsNoError);
+        REQUIRE(JsRunScript(_u("new Function('return 3;')()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 3);
+        CHECK(tracker.stores == 2);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+
+        REQUIRE(JsSetDynamicCodeCacheCallbacks(runtime, nullptr, nullptr, nullptr) == JsNoError);
+        for (auto &entry : tracker.entries)
+        {
+            delete [] entry.second.first;
+        }
+    }
+
+    TEST_CASE("ApiTest_DynamicCodeCacheTest", "[ApiTest]")
+    {
+        JsRTApiTest::WithSetup(JsRuntimeAttributeNone, DynamicCodeCacheTest);
+        JsRTApiTest::WithSetup(JsRuntimeAttributeDisableNativeCodeGeneration, DynamicCodeCacheTest);
+    }
+
+    void ReloadScriptTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const char *scripts[] = {
+            "function unchanged() { return 1; }\nfunction edited() { return 2; }\nvar version = 1;\nfunction after() { return version * 10; }\n",
+            "function unchanged() { return 1; }\nfunction edited() { return 20; }\nvar version = 2;\nfunction after() { return version * 10; }\n",
+        };
+
+        JsValueRef sourceUrl = JS_INVALID_REFERENCE;
+        JsValueRef previousScript = JS_INVALID_REFERENCE;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString("reload.js", strlen("reload.js"), &sourceUrl) == JsNoError);
+
+        for (int i = 0; i < _countof(scripts); i++)
+        {
+            JsValueRef scriptSource = JS_INVALID_REFERENCE;
+            JsValueRef script = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateString(scripts[i], strlen(scripts[i]), &scriptSource) == JsNoError);
+            if (previousScript == JS_INVALID_REFERENCE)
+            {
+                REQUIRE(JsParse(scriptSource, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &script) == JsNoError);
+            }
+            else
+            {
+                REQUIRE(JsReloadScript(previousScript, scriptSource, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &script) == JsNoError);
+            }
+
+            JsValueRef args[] = { GetUndefined() };
+            REQUIRE(JsCallFunction(script, args, _countof(args), nullptr) == JsNoError);
+
+            int unchanged, edited, after;
+            REQUIRE(JsRunScript(_u("unchanged()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsNumberToInt(result, &unchanged) == JsNoError);
+            REQUIRE(JsRunScript(_u("edited()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsNumberToInt(result, &edited) == JsNoError);
+            REQUIRE(JsRunScript(_u("after()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsNumberToInt(result, &after) == JsNoError);
+
+            CHECK(unchanged == 1);
+            CHECK(edited == (i == 0 ? 2 : 20));
+            CHECK(after == (i == 0 ? 10 : 20));
+
+            previousScript = script;
+        }
+
+        // Only scripts can be reloaded
+        JsValueRef object = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&object) == JsNoError);
+        CHECK(JsReloadScript(object, sourceUrl, JS_SOURCE_CONTEXT_NONE, sourceUrl, JsParseScriptAttributeNone, &result) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_ReloadScriptTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ReloadScriptTest);
+    }
+
+    void Latin1StringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // One-byte (Latin-1) content with characters above 0x7F
+        const char content[] = "caf\xe9 au lait, cr\xe8me br\xfbl\xe9" "e";
+        const size_t contentLength = strlen(content);
+
+        JsValueRef latin1 = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(content, contentLength, &latin1) == JsNoError);
+
+        int length;
+        REQUIRE(JsGetStringLength(latin1, &length) == JsNoError);
+        CHECK(length == (int)contentLength);
+
+        // Copy out the one-byte content without widening
+        char buffer[64];
+        size_t written = 0;
+        REQUIRE(JsCopyString(latin1, 0, length, buffer, &written) == JsNoError);
+        CHECK(written == contentLength);
+        CHECK(memcmp(buffer, content, contentLength) == 0);
+        REQUIRE(JsCopyString(latin1, 5, 2, buffer, &written) == JsNoError);
+        CHECK(written == 2);
+        CHECK(memcmp(buffer, "au", 2) == 0);
+        CHECK(JsCopyString(latin1, length + 1, 2, buffer, &written) == JsErrorInvalidArgument);
+
+        // Compare against the same text created from script and from UTF16
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsValueRef scriptString = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsRunScript(_u("'caf\\u00e9 au lait, cr\\u00e8me br\\u00fbl\\u00e9e'"), JS_SOURCE_CONTEXT_NONE, _u(""), &scriptString) == JsNoError);
+
+        bool equals = false;
+        REQUIRE(JsStrictEquals(latin1, scriptString, &equals) == JsNoError);
+        CHECK(equals);
+
+        JsValueRef other = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(content, contentLength, &other) == JsNoError);
+        REQUIRE(JsStrictEquals(latin1, other, &equals) == JsNoError);
+        CHECK(equals);
+
+        // Widening keeps the contents intact
+        uint16_t wideBuffer[64];
+        REQUIRE(JsCopyStringUtf16(latin1, 0, length, wideBuffer, &written) == JsNoError);
+        CHECK(written == contentLength);
+        for (size_t i = 0; i < contentLength; i++)
+        {
+            CHECK(wideBuffer[i] == (uint16_t)(unsigned char)content[i]);
+        }
+
+        REQUIRE(JsCopyString(latin1, 0, length, buffer, &written) == JsNoError);
+        CHECK(written == contentLength);
+        CHECK(memcmp(buffer, content, contentLength) == 0);
+
+        // ASCII UTF8 input takes the same representation
+        const char *ascii = "plain ascii content";
+        JsValueRef utf8 = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateStringUtf8((const uint8_t*)ascii, strlen(ascii), &utf8) == JsNoError);
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyIdUtf8("asciiValue", strlen("asciiValue"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, utf8, true) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool boolValue = false;
+        REQUIRE(JsRunScript(_u("asciiValue.charCodeAt(6) === 97 && asciiValue.indexOf('content') === 12 && (asciiValue + '!').length === 20"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &boolValue) == JsNoError);
+        CHECK(boolValue);
+    }
+
+    TEST_CASE("ApiTest_Latin1StringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::Latin1StringTest);
+    }
+
+    void ConstructorAllocationSiteInfoTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // A constructor that adds more properties than the default number of inline slots
+        JsValueRef constructor = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("(function Point(i) {")
+            _u("    this.a = i; this.b = i; this.c = i; this.d = i; this.e = i; this.f = i;")
+            _u("    this.g = i; this.h = i; this.i = i; this.j = i; this.k = i; this.l = i;")
+            _u("})"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &constructor) == JsNoError);
+
+        JsConstructorAllocationSiteInfo info;
+        REQUIRE(JsGetConstructorAllocationSiteInfo(constructor, &info) == JsNoError);
+        CHECK(info.observedConstructionCount == 0);
+        CHECK(info.inlineSlotCapacityGrowCount == 0);
+        CHECK(!info.isFinal);
+
+        JsValueRef args[] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        for (int i = 0; i < 5; i++)
+        {
+            REQUIRE(JsIntToNumber(i, &args[1]) == JsNoError);
+            JsValueRef object = JS_INVALID_REFERENCE;
+            REQUIRE(JsConstructObject(constructor, args, 2, &object) == JsNoError);
+
+            JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+            JsValueRef value = JS_INVALID_REFERENCE;
+            int intValue = -1;
+            REQUIRE(JsGetPropertyIdFromName(_u("l"), &propertyId) == JsNoError);
+            REQUIRE(JsGetProperty(object, propertyId, &value) == JsNoError);
+            REQUIRE(JsNumberToInt(value, &intValue) == JsNoError);
+            CHECK(intValue == i);
+        }
+
+        REQUIRE(JsGetConstructorAllocationSiteInfo(constructor, &info) == JsNoError);
+        CHECK(info.observedConstructionCount > 0);
+        CHECK(info.observedPropertyCount == 12);
+        CHECK(info.requestedInlineSlotCapacity >= 12);
+        CHECK(info.inlineSlotCapacityGrowCount > 0);
+        CHECK(info.isFinal);
+        CHECK(info.inlineSlotCapacity >= 12);
+        CHECK(info.slotCapacity >= 12);
+
+        JsValueRef notAFunction = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&notAFunction) == JsNoError);
+        CHECK(JsGetConstructorAllocationSiteInfo(notAFunction, &info) == JsErrorInvalidArgument);
+        CHECK(JsGetConstructorAllocationSiteInfo(constructor, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_ConstructorAllocationSiteInfoTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ConstructorAllocationSiteInfoTest);
+    }
+
+    void JsonParserTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Two, three and four byte characters, so that chunks end in the middle of each of them
+        const char text[] = "{\"name\":\"caf\xc3\xa9\",\"cjk\":\"\xe4\xb8\xad\",\"emoji\":\"\xf0\x9f\x98\x80\",\"list\":[1,2.5,true,null]}";
+        const size_t textLength = strlen(text);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsCreatePropertyIdUtf8("parsed", strlen("parsed"), &propertyId) == JsNoError);
+
+        JsJsonParserHandle parser = nullptr;
+        REQUIRE(JsCreateJsonParser(&parser) == JsNoError);
+
+        for (size_t split = 0; split <= textLength; split++)
+        {
+            // Split the text in two at every byte; for odd splits, add the rest one byte at a time
+            REQUIRE(JsJsonParserAddChunk(parser, (const uint8_t*)text, split) == JsNoError);
+            if (split % 2 == 0)
+            {
+                REQUIRE(JsJsonParserAddChunk(parser, (const uint8_t*)text + split, textLength - split) == JsNoError);
+            }
+            else
+            {
+                for (size_t i = split; i < textLength; i++)
+                {
+                    REQUIRE(JsJsonParserAddChunk(parser, (const uint8_t*)text + i, 1) == JsNoError);
+                }
+            }
+
+            JsValueRef parsed = JS_INVALID_REFERENCE;
+            REQUIRE(JsJsonParserFinish(parser, &parsed) == JsNoError);
+            REQUIRE(JsSetProperty(global, propertyId, parsed, true) == JsNoError);
+
+            JsValueRef check = JS_INVALID_REFERENCE;
+            bool matches = false;
+            REQUIRE(JsRunScript(
+                _u("parsed.name === 'caf\\u00e9' && parsed.cjk === '\\u4e2d' && parsed.emoji === '\\ud83d\\ude00' && ")
+                _u("parsed.list.length === 4 && parsed.list[1] === 2.5 && parsed.list[3] === null"),
+                JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+            REQUIRE(JsBooleanToBool(check, &matches) == JsNoError);
+            CHECK(matches);
+        }
+
+        // A syntax error is reported as a script exception, and the parser can take another text afterwards
+        const char badText[] = "[1, 2,";
+        JsValueRef parsed = JS_INVALID_REFERENCE;
+        REQUIRE(JsJsonParserAddChunk(parser, (const uint8_t*)badText, strlen(badText)) == JsNoError);
+        CHECK(JsJsonParserFinish(parser, &parsed) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        REQUIRE(JsJsonParserAddChunk(parser, (const uint8_t*)"[42]", 4) == JsNoError);
+        REQUIRE(JsJsonParserFinish(parser, &parsed) == JsNoError);
+        JsValueRef zero = JS_INVALID_REFERENCE;
+        JsValueRef element = JS_INVALID_REFERENCE;
+        int value = 0;
+        REQUIRE(JsIntToNumber(0, &zero) == JsNoError);
+        REQUIRE(JsGetIndexedProperty(parsed, zero, &element) == JsNoError);
+        REQUIRE(JsNumberToInt(element, &value) == JsNoError);
+        CHECK(value == 42);
+
+        CHECK(JsCreateJsonParser(nullptr) == JsErrorNullArgument);
+        CHECK(JsJsonParserAddChunk(parser, nullptr, 1) == JsErrorNullArgument);
+        CHECK(JsJsonParserFinish(parser, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsReleaseJsonParser(parser) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsonParserTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsonParserTest);
+    }
+
+    struct JsonWriteState
+    {
+        std::string text;
+        size_t chunkCount;
+        size_t firstChunkLength;
+    };
+
+    static void CHAKRA_CALLBACK JsonWriteCallback(const char *chunk, size_t length, void *callbackState)
+    {
+        JsonWriteState *state = (JsonWriteState *)callbackState;
+        if (state->chunkCount++ == 0)
+        {
+            state->firstChunkLength = length;
+        }
+        state->text.append(chunk, length);
+    }
+
+    void JsonUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const char text[] = "{\"name\":\"caf\xc3\xa9\",\"emoji\":\"\xf0\x9f\x98\x80\",\"list\":[1,2.5,true,null]}";
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsCreatePropertyIdUtf8("parsed", strlen("parsed"), &propertyId) == JsNoError);
+
+        JsValueRef parsed = JS_INVALID_REFERENCE;
+        REQUIRE(JsParseJsonUtf8(text, strlen(text), &parsed) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, parsed, true) == JsNoError);
+
+        JsValueRef check = JS_INVALID_REFERENCE;
+        bool matches = false;
+        REQUIRE(JsRunScript(
+            _u("parsed.name === 'caf\\u00e9' && parsed.emoji === '\\ud83d\\ude00' && parsed.list.length === 4 && parsed.list[3] === null"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+        REQUIRE(JsBooleanToBool(check, &matches) == JsNoError);
+        CHECK(matches);
+
+        // Round trip the parsed object
+        JsonWriteState state = {};
+        REQUIRE(JsStringifyJsonUtf8(parsed, JsonWriteCallback, &state) == JsNoError);
+        CHECK(state.text == text);
+
+        // The opening quote and 1022 characters put the lead surrogate last in the first 1024-character piece,
+        // so the pair has to move to the next piece
+        JsValueRef longString = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("new Array(1023).join('a') + '\\ud83d\\ude00'"), JS_SOURCE_CONTEXT_NONE, _u(""), &longString) == JsNoError);
+        state = JsonWriteState();
+        REQUIRE(JsStringifyJsonUtf8(longString, JsonWriteCallback, &state) == JsNoError);
+        CHECK(state.chunkCount == 2);
+        CHECK(state.firstChunkLength == 1023);
+        CHECK(state.text == "\"" + std::string(1022, 'a') + "\xf0\x9f\x98\x80\"");
+
+        // An object with more members than one chunk of the builder holds, written without flattening the result
+        JsValueRef wideObject = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var o = {}; for (var i = 0; i < 3000; i++) { o['k' + i] = 'v\\u00e9' + i; } o"), JS_SOURCE_CONTEXT_NONE, _u(""), &wideObject) == JsNoError);
+        std::string wideText = "{";
+        for (int i = 0; i < 3000; i++)
+        {
+            wideText += (i == 0 ? "\"k" : ",\"k") + std::to_string(i) + "\":\"v\xc3\xa9" + std::to_string(i) + "\"";
+        }
+        wideText += "}";
+        state = JsonWriteState();
+        REQUIRE(JsStringifyJsonUtf8(wideObject, JsonWriteCallback, &state) == JsNoError);
+        CHECK(state.chunkCount > 1);
+        CHECK(state.text == wideText);
+
+        // Nothing is written for a value without a JSON representation
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        state = JsonWriteState();
+        REQUIRE(JsStringifyJsonUtf8(undefined, JsonWriteCallback, &state) == JsNoError);
+        CHECK(state.chunkCount == 0);
+
+        const char badText[] = "{\"a\":}";
+        CHECK(JsParseJsonUtf8(badText, strlen(badText), &parsed) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        CHECK(JsParseJsonUtf8(nullptr, 0, &parsed) == JsErrorNullArgument);
+        CHECK(JsStringifyJsonUtf8(undefined, nullptr, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_JsonUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsonUtf8Test);
+    }
+
+    struct RegexProfileState
+    {
+        size_t entryCount;
+        JsRegexProfileEntry backtracking;
+        bool foundBacktracking;
+        JsRegexProfileEntry flagged;
+        bool foundFlagged;
+    };
+
+    static void CHAKRA_CALLBACK RegexProfileCallback(const JsRegexProfileEntry *entry, void *callbackState)
+    {
+        RegexProfileState *state = (RegexProfileState *)callbackState;
+        state->entryCount++;
+        if (!wcscmp((const char16 *)entry->source, _u("(a|aa)+b")) && !strcmp(entry->flags, ""))
+        {
+            state->backtracking = *entry;
+            state->foundBacktracking = true;
+        }
+        else if (!wcscmp((const char16 *)entry->source, _u("x+y")) && !strcmp(entry->flags, "gi"))
+        {
+            state->flagged = *entry;
+            state->foundFlagged = true;
+        }
+    }
+
+    void RegexProfileTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        RegexProfileState state = {};
+        REQUIRE(JsGetRegexProfile(runtime, RegexProfileCallback, &state) == JsNoError);
+        CHECK(state.entryCount == 0);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("var backtracking = /(a|aa)+b/;")
+            _u("function run(n) { for (var i = 0; i < n; i++) backtracking.test('aaaaaaaaaaaaaaaacb'); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Sample every match
+        REQUIRE(JsStartRegexProfiling(runtime, 1) == JsNoError);
+        REQUIRE(JsRunScript(_u("run(10); new RegExp('x+y', 'gi').test('XXy');"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsGetRegexProfile(runtime, RegexProfileCallback, &state) == JsNoError);
+        REQUIRE(state.foundBacktracking);
+        CHECK(state.backtracking.sourceLength == 8);
+        // Compiled before profiling started
+        CHECK(state.backtracking.compileCount == 0);
+        CHECK(state.backtracking.executionCount == 10);
+        CHECK(state.backtracking.sampledExecutionCount == 10);
+        CHECK(state.backtracking.sampledMatchTime >= 0);
+        CHECK(state.backtracking.sampledBacktrackCount > 0);
+        CHECK(state.backtracking.peakBacktrackStackSize > 0);
+        REQUIRE(state.foundFlagged);
+        CHECK(state.flagged.compileCount == 1);
+        CHECK(state.flagged.compileTime >= 0);
+        CHECK(state.flagged.executionCount == 1);
+        CHECK(state.flagged.sampledBacktrackCount == 0);
+
+        // Matches while profiling is stopped are not counted, but the profile is kept
+        REQUIRE(JsStopRegexProfiling(runtime) == JsNoError);
+        REQUIRE(JsRunScript(_u("run(5);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        state = RegexProfileState();
+        REQUIRE(JsGetRegexProfile(runtime, RegexProfileCallback, &state) == JsNoError);
+        REQUIRE(state.foundBacktracking);
+        CHECK(state.backtracking.executionCount == 10);
+
+        // Restarting discards the profile; with an interval of 4, every fourth match is sampled
+        REQUIRE(JsStartRegexProfiling(runtime, 4) == JsNoError);
+        REQUIRE(JsRunScript(_u("run(8);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        state = RegexProfileState();
+        REQUIRE(JsGetRegexProfile(runtime, RegexProfileCallback, &state) == JsNoError);
+        CHECK(state.entryCount == 1);
+        REQUIRE(state.foundBacktracking);
+        CHECK(state.backtracking.executionCount == 8);
+        CHECK(state.backtracking.sampledExecutionCount == 2);
+        CHECK(!state.foundFlagged);
+        REQUIRE(JsStopRegexProfiling(runtime) == JsNoError);
+
+        CHECK(JsStartRegexProfiling(runtime, 0) == JsErrorInvalidArgument);
+        CHECK(JsGetRegexProfile(runtime, nullptr, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_RegexProfileTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RegexProfileTest);
+    }
 }
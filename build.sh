@@ -43,6 +43,9 @@ PRINT_USAGE() {
     echo "      --lto            Enables LLVM Full LTO"
     echo "      --lto-thin       Enables LLVM Thin LTO - xcode 8+ or clang 3.9+"
     echo "      --static         Build as static library (by default shared library)"
+    echo "      --threaded-interpreter"
+    echo "                       Use computed-goto (direct-threaded) opcode dispatch"
+    echo "                       in the interpreter loop"
     echo "      --sanitize=CHECKS Build with clang -fsanitize checks,"
     echo "                       e.g. undefined,signed-integer-overflow"
     echo "  -t, --test-build     Test build (by default Release build)"
@@ -68,6 +71,7 @@ CMAKE_GEN=
 MAKE=make
 MULTICORE_BUILD=""
 NO_JIT=
+THREADED_INTERPRETER=
 ICU_PATH="-DICU_SETTINGS_RESET=1"
 STATIC_LIBRARY="-DSHARED_LIBRARY_SH=1"
 SANITIZE=
@@ -211,6 +215,10 @@ while [[ $# -gt 0 ]]; do
         NO_JIT="-DNO_JIT_SH=1"
         ;;
 
+    --threaded-interpreter)
+        THREADED_INTERPRETER="-DINTERPRETER_THREADED_DISPATCH_SH=1"
+        ;;
+
     --xcode)
         CMAKE_GEN="-G Xcode -DCC_XCODE_PROJECT=1"
         MAKE=0
@@ -333,7 +341,8 @@ fi
 
 echo Generating $BUILD_TYPE makefiles
 cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $LTO $STATIC_LIBRARY $ARCH \
-    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $WITHOUT_FEATURES ../..
+    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $THREADED_INTERPRETER \
+    $WITHOUT_FEATURES ../..
 
 _RET=$?
 if [[ $? == 0 ]]; then
@@ -483,6 +483,9 @@ const char16 *GetVtableName(VTableValue value)
     case VtableCompoundString:
         return _u("vtable CompoundString");
         break;
+    case VtableLatin1String:
+        return _u("vtable Latin1String");
+        break;
     default:
         Assert(false);
         break;
@@ -16045,17 +16045,20 @@ Lowerer::GenerateFastStringLdElem(IR::Instr * ldElem, IR::LabelInstr * labelHelp
     IR::RegOpnd * bufferOpnd = IR::RegOpnd::New(TyMachPtr, this->m_func);
     const IR::AutoReuseOpnd autoReuseBufferOpnd(bufferOpnd, m_func);
     IR::IndirOpnd * charIndirOpnd;
+    IR::IndirOpnd * latin1CharIndirOpnd;
     if (indexOpnd)
     {
         // Untag the var and generate the indir into the string buffer
         IR::RegOpnd * index32Opnd = GenerateUntagVar(indexOpnd, labelHelper, ldElem);
         charIndirOpnd = IR::IndirOpnd::New(bufferOpnd, index32Opnd, 1, TyUint16, this->m_func);
+        latin1CharIndirOpnd = IR::IndirOpnd::New(bufferOpnd, index32Opnd, 0, TyUint8, this->m_func);
         index32CmpOpnd = index32Opnd;
     }
     else
     {
         // Just use the offset to indirect into the string buffer
         charIndirOpnd = IR::IndirOpnd::New(bufferOpnd, indirOpnd->GetOffset() * sizeof(char16), TyUint16, this->m_func);
+        latin1CharIndirOpnd = IR::IndirOpnd::New(bufferOpnd, indirOpnd->GetOffset(), TyUint8, this->m_func);
         index32CmpOpnd = IR::IntConstOpnd::New((uint32)indirOpnd->GetOffset(), TyUint32, this->m_func);
     }
 
@@ -16066,22 +16069,19 @@ Lowerer::GenerateFastStringLdElem(IR::Instr * ldElem, IR::LabelInstr * labelHelp
     InsertCompareBranch(IR::IndirOpnd::New(baseOpnd, offsetof(Js::JavascriptString, m_charLength), TyUint32, this->m_func)
         , index32CmpOpnd, Js::OpCode::BrLe_A, true, labelHelper, ldElem);
 
-    // Load the string buffer and make sure it is not null
+    // Load the string buffer
     //  MOV bufferOpnd, [baseOpnd + offset(m_pszValue)]
-    //  TEST bufferOpnd, bufferOpnd
-    //  JEQ $labelHelper
     indirOpnd = IR::IndirOpnd::New(baseOpnd, offsetof(Js::JavascriptString, m_pszValue), TyMachPtr, this->m_func);
 
     InsertMove(bufferOpnd, indirOpnd, ldElem);
-    GenerateNotZeroTest(bufferOpnd, labelHelper, ldElem);
 
-    // Load the character and check if it is 7bit ASCI (which we have the cache for)
+    // Load the character from either buffer and check if it is 7bit ASCI (which we have the cache for)
     //  MOV charOpnd, [bufferOpnd + index32Opnd]
     //  CMP charOpnd, 0x80
     //  JAE $helper
     IR::RegOpnd * charOpnd = IR::RegOpnd::New(TyUint32, this->m_func);
     const IR::AutoReuseOpnd autoReuseCharOpnd(charOpnd, m_func);
-    InsertMove(charOpnd, charIndirOpnd, ldElem);
+    GenerateLoadStringChar(baseOpnd, bufferOpnd, charIndirOpnd, latin1CharIndirOpnd, charOpnd, labelHelper, ldElem);
     InsertCompareBranch(charOpnd, IR::IntConstOpnd::New(Js::CharStringCache::CharStringCacheSize, TyUint16, this->m_func),
         Js::OpCode::BrGe_A, true, labelHelper, ldElem);
 
@@ -24049,6 +24049,71 @@ Lowerer::GenerateStringTest(IR::RegOpnd *srcReg, IR::Instr *insertInstr, IR::Lab
     }
 }
 
+//
+// Loads a character from a string whose m_pszValue is already in bufferOpnd. A Latin1String has no char16 buffer until it
+// is widened, so its character is read from the one-byte buffer instead; other strings without a buffer go to labelHelper.
+//
+void
+Lowerer::GenerateLoadStringChar(IR::RegOpnd *strOpnd, IR::RegOpnd *bufferOpnd, IR::IndirOpnd *wideCharOpnd, IR::IndirOpnd *latin1CharOpnd,
+    IR::RegOpnd *charOpnd, IR::LabelInstr *labelHelper, IR::Instr *insertBeforeInstr)
+{
+    //      TEST bufferOpnd, bufferOpnd
+    //      JNE $loadWide
+    //      CMP [strOpnd], Latin1String vtable
+    //      JNE $helper
+    //      MOV bufferOpnd, [strOpnd + offset(latin1Buffer)]
+    //      MOVZX charOpnd, byte [latin1CharOpnd]
+    //      JMP $loaded
+    // $loadWide:
+    //      MOVZX charOpnd, word [wideCharOpnd]
+    // $loaded:
+    IR::LabelInstr *labelLoadWide = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    IR::LabelInstr *labelLoaded = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+
+    InsertTestBranch(bufferOpnd, bufferOpnd, Js::OpCode::BrNeq_A, labelLoadWide, insertBeforeInstr);
+
+    InsertCompareBranch(
+        IR::IndirOpnd::New(strOpnd, 0, TyMachPtr, m_func),
+        this->LoadVTableValueOpnd(insertBeforeInstr, VTableValue::VtableLatin1String),
+        Js::OpCode::BrNeq_A,
+        labelHelper,
+        insertBeforeInstr);
+    InsertMove(bufferOpnd, IR::IndirOpnd::New(strOpnd, Js::Latin1String::GetOffsetOfLatin1Buffer(), TyMachPtr, m_func), insertBeforeInstr);
+    InsertMove(charOpnd, latin1CharOpnd, insertBeforeInstr);
+    InsertBranch(Js::OpCode::Br, labelLoaded, insertBeforeInstr);
+
+    insertBeforeInstr->InsertBefore(labelLoadWide);
+    InsertMove(charOpnd, wideCharOpnd, insertBeforeInstr);
+    insertBeforeInstr->InsertBefore(labelLoaded);
+}
+
+//
+// Makes sure bufferOpnd, already loaded from the string's m_pszValue, points to a flat char16 buffer. Strings without one
+// (including a Latin1String, which is widened once here) get it from GetSz.
+//
+void
+Lowerer::GenerateFlatStringBuffer(IR::RegOpnd *strOpnd, IR::RegOpnd *bufferOpnd, IR::Instr *insertBeforeInstr)
+{
+    //      TEST bufferOpnd, bufferOpnd
+    //      JNE $continue
+    // $helper:
+    //      PUSH strOpnd
+    //      CALL JavascriptString::GetSzHelper
+    //      MOV bufferOpnd, eax
+    // $continue:
+    IR::LabelInstr *labelHelper = IR::LabelInstr::New(Js::OpCode::Label, m_func, true);
+    IR::LabelInstr *labelContinue = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+
+    InsertTestBranch(bufferOpnd, bufferOpnd, Js::OpCode::BrNeq_A, labelContinue, insertBeforeInstr);
+
+    insertBeforeInstr->InsertBefore(labelHelper);
+    m_lowererMD.LoadHelperArgument(insertBeforeInstr, strOpnd);
+    IR::Instr *instrCall = IR::Instr::New(Js::OpCode::Call, bufferOpnd, IR::HelperCallOpnd::New(IR::HelperString_GetSz, m_func), m_func);
+    insertBeforeInstr->InsertBefore(instrCall);
+    m_lowererMD.LowerCall(instrCall, 0);
+    insertBeforeInstr->InsertBefore(labelContinue);
+}
+
 void
 Lowerer::LowerConvNum(IR::Instr *instrLoad, bool noMathFastPath)
 {
@@ -305,6 +305,8 @@ private:
     void            GenerateIsEnabledFloatArraySetElementFastPathCheck(IR::LabelInstr * isDisabledLabel, IR::Instr * const insertBeforeInstr);
     void            GenerateTypeIdCheck(Js::TypeId typeId, IR::RegOpnd * opnd, IR::LabelInstr * labelFail, IR::Instr * insertBeforeInstr, bool generateObjectCheck = true);
     void            GenerateStringTest(IR::RegOpnd *srcReg, IR::Instr *instrInsert, IR::LabelInstr * failLabel, IR::LabelInstr * succeedLabel = nullptr, bool generateObjectCheck = true);
+    void            GenerateLoadStringChar(IR::RegOpnd *strOpnd, IR::RegOpnd *bufferOpnd, IR::IndirOpnd *wideCharOpnd, IR::IndirOpnd *latin1CharOpnd, IR::RegOpnd *charOpnd, IR::LabelInstr *labelHelper, IR::Instr *insertBeforeInstr);
+    void            GenerateFlatStringBuffer(IR::RegOpnd *strOpnd, IR::RegOpnd *bufferOpnd, IR::Instr *insertBeforeInstr);
     IR::RegOpnd *   GenerateUntagVar(IR::RegOpnd * opnd, IR::LabelInstr * labelFail, IR::Instr * insertBeforeInstr, bool generateTagCheck = true);
     void            GenerateNotZeroTest( IR::Opnd * opndSrc, IR::LabelInstr * labelZero, IR::Instr * instrInsert);
     IR::Opnd *      CreateOpndForSlotAccess(IR::Opnd * opnd);
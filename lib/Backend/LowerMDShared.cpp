@@ -2596,11 +2596,11 @@ LowererMD::GenerateFastStringCheck(IR::Instr *instr, IR::RegOpnd *srcReg1, IR::R
     //
     // Compare length of src1 and src2 if not equal goto $failure
     //
-    // if src1 is not flat string jump to $helper
+    // if src1 is not flat string, flatten it (this also widens a Latin1String once)
     //
     // if src1 and src2 m_pszValue pointer match goto $success
     //
-    // if src2 is not flat string jump to $helper
+    // if src2 is not flat string, flatten it
     //
     // if first character of src1 and src2 doesn't match goto $failure
     //
@@ -2634,11 +2634,15 @@ LowererMD::GenerateFastStringCheck(IR::Instr *instr, IR::RegOpnd *srcReg1, IR::R
     //      MOV s4, [srcReg1,offset(m_pszValue)]
     //      CMP srcReg1, srcReg2
     //      JEQ $success
-    //      CMP s4, 0
-    //      JEQ $helper
+    //      TEST s4, s4
+    //      JNE $s4Flat
+    //      s4 = CALL GetSzHelper(srcReg1)
+    // $s4Flat:
     //      MOV s5, [srcReg2,offset(m_pszValue)]
-    //      CMP s5, 0
-    //      JEQ $helper
+    //      TEST s5, s5
+    //      JNE $s5Flat
+    //      s5 = CALL GetSzHelper(srcReg2)
+    // $s5Flat:
     //      MOV s6,[s4]
     //      CMP [s5], s6                       -First character comparison
     //      JNE $fail
@@ -2678,11 +2682,8 @@ LowererMD::GenerateFastStringCheck(IR::Instr *instr, IR::RegOpnd *srcReg1, IR::R
     instrInsert->InsertBefore(IR::BranchInstr::New(Js::OpCode::JNE, labelBranchFail, this->m_func));
 
     //      MOV s4, [src1,offset(m_pszValue)]
-    //      CMP s4, 0
-    //      JEQ $helper
+    //      if s4 is null, s4 = GetSz(src1)
     //      MOV s5, [src2,offset(m_pszValue)]
-    //      CMP s5, 0
-    //      JEQ $helper
 
     IR::RegOpnd * src1FlatString = IR::RegOpnd::New(TyMachPtr, this->m_func);
     IR::Instr * loadSrc1StringInstr = IR::Instr::New(Js::OpCode::MOV, src1FlatString,
@@ -2690,11 +2691,8 @@ LowererMD::GenerateFastStringCheck(IR::Instr *instr, IR::RegOpnd *srcReg1, IR::R
         this->m_func), this->m_func);
     instrInsert->InsertBefore(loadSrc1StringInstr);
 
-    IR::Instr * checkFlatString1Instr = IR::Instr::New(Js::OpCode::CMP, this->m_func);
-    checkFlatString1Instr->SetSrc1(src1FlatString);
-    checkFlatString1Instr->SetSrc2(IR::IntConstOpnd::New(0, TyUint32, this->m_func));
-    instrInsert->InsertBefore(checkFlatString1Instr);
-    instrInsert->InsertBefore(IR::BranchInstr::New(Js::OpCode::JEQ, labelHelper, this->m_func));
+    // Flatten here rather than in the helper, so that a Latin1String is widened once and later compares stay inline
+    this->m_lowerer->GenerateFlatStringBuffer(srcReg1, src1FlatString, instrInsert);
 
     IR::RegOpnd * src2FlatString = IR::RegOpnd::New(TyMachPtr, this->m_func);
     IR::Instr * loadSrc2StringInstr = IR::Instr::New(Js::OpCode::MOV, src2FlatString,
@@ -2710,11 +2708,7 @@ LowererMD::GenerateFastStringCheck(IR::Instr *instr, IR::RegOpnd *srcReg1, IR::R
     instrInsert->InsertBefore(comparePtrInstr);
     instrInsert->InsertBefore(IR::BranchInstr::New(Js::OpCode::JEQ, labelBranchSuccess, this->m_func));
 
-    IR::Instr * checkFlatString2Instr = IR::Instr::New(Js::OpCode::CMP, this->m_func);
-    checkFlatString2Instr->SetSrc1(src2FlatString);
-    checkFlatString2Instr->SetSrc2(IR::IntConstOpnd::New(0, TyUint32, this->m_func));
-    instrInsert->InsertBefore(checkFlatString2Instr);
-    instrInsert->InsertBefore(IR::BranchInstr::New(Js::OpCode::JEQ, labelHelper, this->m_func));
+    this->m_lowerer->GenerateFlatStringBuffer(srcReg2, src2FlatString, instrInsert);
 
     //      MOV s6,[s4]
     //      CMP [s5], s6                       -First character comparison
@@ -5649,14 +5643,12 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
     //  CMP [regSrcStr + offset(type)] , static string type   -- check base string type
     //  JNE $helper
     //  MOV r1, [regSrcStr + offset(m_pszValue)]
-    //  TEST r1, r1
-    //  JEQ $helper
     //  MOV r2, srcIndex
     //  If r2 is not int, JMP $helper
     //  Convert r2 to int
     //  CMP [regSrcStr + offsetof(length)], r2
     //  JBE $helper
-    //  MOVZX r2, [r1 + r2 * 2]
+    //  Lowerer.GenerateLoadStringChar   -- MOVZX r2, [r1 + r2 * 2], or a byte load from a Latin1String
     //  if (charAt)
     //      PUSH r1
     //      PUSH scriptContext
@@ -5732,16 +5724,7 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
     instr = IR::Instr::New(Js::OpCode::MOV, r1, indirOpnd, this->m_func);
     insertInstr->InsertBefore(instr);
 
-    // TEST r1, r1 -- Null pointer test
-    instr = IR::Instr::New(Js::OpCode::TEST, this->m_func);
-    instr->SetSrc1(r1);
-    instr->SetSrc2(r1);
-    insertInstr->InsertBefore(instr);
-
-    // JEQ $helper
-    instr = IR::BranchInstr::New(Js::OpCode::JEQ, labelHelper, this->m_func);
-    insertInstr->InsertBefore(instr);
-
+    IR::IndirOpnd *latin1IndirOpnd;
     IR::IndirOpnd *strLength = IR::IndirOpnd::New(regSrcStr, offsetof(Js::JavascriptString, m_charLength), TyUint32, this->m_func);
     if (srcIndex->IsAddrOpnd())
     {
@@ -5756,7 +5739,8 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
         instr = IR::BranchInstr::New(Js::OpCode::JBE, labelHelper, this->m_func);
         insertInstr->InsertBefore(instr);
 
-        indirOpnd = IR::IndirOpnd::New(r1, Js::TaggedInt::ToUInt32(srcIndex->AsAddrOpnd()->m_address) * sizeof(char16), TyInt16, this->m_func);
+        indirOpnd = IR::IndirOpnd::New(r1, Js::TaggedInt::ToUInt32(srcIndex->AsAddrOpnd()->m_address) * sizeof(char16), TyUint16, this->m_func);
+        latin1IndirOpnd = IR::IndirOpnd::New(r1, Js::TaggedInt::ToUInt32(srcIndex->AsAddrOpnd()->m_address), TyUint8, this->m_func);
     }
     else
     {
@@ -5798,12 +5782,14 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
         instr = IR::BranchInstr::New(Js::OpCode::JBE, labelHelper, this->m_func);
         insertInstr->InsertBefore(instr);
 
-        indirOpnd = IR::IndirOpnd::New(r1, r2, 1, TyInt16, this->m_func);
+        indirOpnd = IR::IndirOpnd::New(r1, r2, 1, TyUint16, this->m_func);
+        latin1IndirOpnd = IR::IndirOpnd::New(r1, r2, 0, TyUint8, this->m_func);
     }
     // MOVZX charReg, [r1 + r2 * 2]  -- this is the value of the char
+    // A Latin1String has a null r1; its char is loaded from the one-byte buffer, which is left in r1. Latin-1 chars are
+    // never surrogates, so the code point path below never reads r1 as char16.
     IR::RegOpnd *charReg = IR::RegOpnd::New(TyMachReg, this->m_func);
-    instr = IR::Instr::New(Js::OpCode::MOVZXW, charReg, indirOpnd, this->m_func);
-    insertInstr->InsertBefore(instr);
+    this->m_lowerer->GenerateLoadStringChar(regSrcStr, r1, indirOpnd, latin1IndirOpnd, charReg, labelHelper, insertInstr);
     if (index == Js::BuiltinFunction::JavascriptString_CharAt)
     {
         IR::Opnd *resultOpnd;
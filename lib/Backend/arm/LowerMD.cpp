@@ -3086,12 +3086,9 @@ LowererMD::GenerateFastStringCheck(IR::Instr* instrBr, IR::RegOpnd *regSrc1, IR:
     //           BNE $notEqual
     //
     // psz1    = LDR [regSrc1 + offset(m_pszValue)]
+    //           if psz1 is null, psz1 = GetSz(regSrc1)     -- widens a Latin1String once
     // psz2    = LDR [regSrc2 + offset(m_pszValue)]
-    //
-    //           CMP psz1, 0
-    //           BEQ $helper
-    //           CMP psz2, 0
-    //           BEQ $helper
+    //           if psz2 is null, psz2 = GetSz(regSrc2)
     //
     // ch1     = LDR [psz1]
     // ch2     = LDR [psz2]
@@ -3162,38 +3159,20 @@ LowererMD::GenerateFastStringCheck(IR::Instr* instrBr, IR::RegOpnd *regSrc1, IR:
     instrBr->InsertBefore(instr);
 
 
-    // Load string pointers and check for null
+    // Load string pointers, flattening strings that don't have one yet
     // psz1    = LDR [regSrc1 + offset(m_pszValue)]
     IR::RegOpnd *psz1 = IR::RegOpnd::New(TyMachReg, this->m_func);
     indirOpnd = IR::IndirOpnd::New(regSrc1, Js::JavascriptString::GetOffsetOfpszValue(), TyMachReg, this->m_func);
     instr = IR::Instr::New(Js::OpCode::LDR, psz1, indirOpnd, this->m_func);
     instrBr->InsertBefore(instr);
+    this->m_lowerer->GenerateFlatStringBuffer(regSrc1, psz1, instrBr);
 
     // psz2    = LDR [regSrc2 + offset(m_pszValue)]
     IR::RegOpnd *psz2 = IR::RegOpnd::New(TyMachReg, this->m_func);
     indirOpnd = IR::IndirOpnd::New(regSrc2, Js::JavascriptString::GetOffsetOfpszValue(), TyMachReg, this->m_func);
     instr = IR::Instr::New(Js::OpCode::LDR, psz2, indirOpnd, this->m_func);
     instrBr->InsertBefore(instr);
-
-    //           CMP psz1, 0
-    instr = IR::Instr::New(Js::OpCode::CMP, this->m_func);
-    instr->SetSrc1(psz1);
-    instr->SetSrc2(IR::IntConstOpnd::New(0, TyMachReg, this->m_func));
-    instrBr->InsertBefore(instr);
-
-    //           BEQ $helper
-    instr = IR::BranchInstr::New(Js::OpCode::BEQ, labelHelper, this->m_func);
-    instrBr->InsertBefore(instr);
-
-    //           CMP psz2, 0
-    instr = IR::Instr::New(Js::OpCode::CMP, this->m_func);
-    instr->SetSrc1(psz2);
-    instr->SetSrc2(IR::IntConstOpnd::New(0, TyMachReg, this->m_func));
-    instrBr->InsertBefore(instr);
-
-    //           BEQ $helper
-    instr = IR::BranchInstr::New(Js::OpCode::BEQ, labelHelper, this->m_func);
-    instrBr->InsertBefore(instr);
+    this->m_lowerer->GenerateFlatStringBuffer(regSrc2, psz2, instrBr);
 
     // ch1     = LDR [psz1]
     IR::RegOpnd *ch1 = IR::RegOpnd::New(TyUint16, this->m_func);
@@ -6588,14 +6567,12 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
     //                  CMP typeid, TypeIds_String
     //                  BNE $helper
     // psz          =   LDR [regSrc + offset(m_pszValue)]
-    //                  CMP psz, 0
-    //                  BEQ $helper
     // index32      =   ASRS srcIndex, VarShift
     //                  BCC $helper
     // length       =   LDR [regSrc + offset(length)]
     //                  CMP length, index32
     //                  BLS $helper
-    // char         =   LDRH [regSrc + index32, LSL #1]
+    // char         =   Lowerer.GenerateLoadStringChar  -- LDRH [psz + index32, LSL #1], or LDRB from a Latin1String
     //
     // if (charAt)
     // (r1)         =   MOV char
@@ -6660,15 +6637,7 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
     indirOpnd = IR::IndirOpnd::New(regSrcStr, Js::JavascriptString::GetOffsetOfpszValue(), TyMachPtr, this->m_func);
     LowererMD::CreateAssign(psz, indirOpnd, insertInstr);
 
-    //      CMP psz, 0
-    instr = IR::Instr::New(Js::OpCode::CMP, this->m_func);
-    instr->SetSrc1(psz);
-    instr->SetSrc2(IR::IntConstOpnd::New(0, TyMachPtr, this->m_func));
-    insertInstr->InsertBefore(instr);
-
-    //      BEQ $helper
-    instr = IR::BranchInstr::New(Js::OpCode::BEQ, labelHelper, this->m_func);
-    insertInstr->InsertBefore(instr);
+    IR::IndirOpnd *latin1IndirOpnd;
 
     // Arm should change to Uint32 for the length
     // length = LDR [regSrcStr + offsetof(length)]
@@ -6695,6 +6664,7 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
 
         // indir = [psz + index32 * 2]
         indirOpnd = IR::IndirOpnd::New(psz, constIndex * sizeof(char16), TyUint16, this->m_func);
+        latin1IndirOpnd = IR::IndirOpnd::New(psz, constIndex, TyUint8, this->m_func);
     }
     else
     {
@@ -6723,11 +6693,14 @@ bool LowererMD::GenerateFastCharAt(Js::BuiltinFunction index, IR::Opnd *dst, IR:
 
         // indir = [psz + index32 * 2]
         indirOpnd = IR::IndirOpnd::New(psz, index32, (byte)Math::Log2(sizeof(char16)), TyUint16, this->m_func);
+        latin1IndirOpnd = IR::IndirOpnd::New(psz, index32, 0, TyUint8, this->m_func);
     }
 
     // char = LDRH [regSrc + index32, LSL #1]
+    // A Latin1String has a null psz; its char is loaded from the one-byte buffer, which is left in psz. Latin-1 chars are
+    // never surrogates, so the code point path below never reads psz as char16.
     IR::RegOpnd *charResult = IR::RegOpnd::New(TyUint32, this->m_func);
-    LowererMD::CreateAssign(charResult, indirOpnd, insertInstr);
+    this->m_lowerer->GenerateLoadStringChar(regSrcStr, psz, indirOpnd, latin1IndirOpnd, charResult, labelHelper, insertInstr);
 
     if (index == Js::BuiltinFunction::JavascriptString_CharAt)
     {
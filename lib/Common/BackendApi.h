@@ -270,6 +270,7 @@ enum VTableValue {
     VtableStackScriptFunction,
     VtableConcatStringMulti,
     VtableCompoundString,
+    VtableLatin1String,
     // SIMD_JS
     VtableSimd128F4,
     VtableSimd128I4,
@@ -64,6 +64,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "Common/DateUtilities.h"
 #include "Common/NumberUtilitiesBase.h"
 #include "Common/NumberUtilities.h"
+#include "Common/StringUtilities.h"
 #include <Codex/Utf8Codex.h>
 
 #include "Core/DelayLoadLibrary.h"
@@ -0,0 +1,444 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonCommonPch.h"
+#include "Common/StringUtilities.h"
+
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#define STRING_UTILITIES_SSE2 1
+#endif
+
+namespace Js
+{
+#ifdef STRING_UTILITIES_SSE2
+    static const charcount_t CharsPerBlock = sizeof(__m128i) / sizeof(char16);
+
+    static __m128i LoadBlock(const char16* chars)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    }
+
+    // The result of _mm_movemask_epi8 has two bits per 16-bit lane
+    static charcount_t FirstLane(uint mask)
+    {
+        Assert(mask != 0);
+        DWORD index;
+        _BitScanForward(&index, mask);
+        return index / 2;
+    }
+
+    static charcount_t LastLane(uint mask)
+    {
+        Assert(mask != 0);
+        DWORD index;
+        _BitScanReverse(&index, mask);
+        return index / 2;
+    }
+
+    static uint ClearLane(uint mask, charcount_t lane)
+    {
+        return mask & ~(3u << (lane * 2));
+    }
+#endif
+
+    int StringUtilities::IndexOfChar(const char16* buffer, charcount_t length, char16 c)
+    {
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i needle = _mm_set1_epi16(static_cast<short>(c));
+            for (; length - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                uint mask = _mm_movemask_epi8(_mm_cmpeq_epi16(LoadBlock(buffer + i), needle));
+                if (mask != 0)
+                {
+                    return i + FirstLane(mask);
+                }
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            if (buffer[i] == c)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int StringUtilities::IndexOfEitherChar(const char16* buffer, charcount_t length, char16 c0, char16 c1)
+    {
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i needle0 = _mm_set1_epi16(static_cast<short>(c0));
+            const __m128i needle1 = _mm_set1_epi16(static_cast<short>(c1));
+            for (; length - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                const __m128i chars = LoadBlock(buffer + i);
+                uint mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(chars, needle0), _mm_cmpeq_epi16(chars, needle1)));
+                if (mask != 0)
+                {
+                    return i + FirstLane(mask);
+                }
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            if (buffer[i] == c0 || buffer[i] == c1)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int StringUtilities::IndexOfCharInRanges(const char16* buffer, charcount_t length, const char16* ranges, uint numRanges)
+    {
+        Assert(numRanges <= MaxRanges);
+
+        // c is in [lower, upper] exactly when the unsigned difference c - lower is at most upper - lower
+        char16 spans[MaxRanges];
+        for (uint r = 0; r < numRanges; r++)
+        {
+            Assert(ranges[r * 2] <= ranges[r * 2 + 1]);
+            spans[r] = static_cast<char16>(ranges[r * 2 + 1] - ranges[r * 2]);
+        }
+
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            __m128i lowers[MaxRanges];
+            __m128i spanNeedles[MaxRanges];
+            for (uint r = 0; r < numRanges; r++)
+            {
+                lowers[r] = _mm_set1_epi16(static_cast<short>(ranges[r * 2]));
+                spanNeedles[r] = _mm_set1_epi16(static_cast<short>(spans[r]));
+            }
+            const __m128i zero = _mm_setzero_si128();
+            for (; length - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                const __m128i chars = LoadBlock(buffer + i);
+                __m128i inRanges = zero;
+                for (uint r = 0; r < numRanges; r++)
+                {
+                    // Saturating subtraction leaves 0 exactly for the lanes that are within the span
+                    const __m128i beyondSpan = _mm_subs_epu16(_mm_sub_epi16(chars, lowers[r]), spanNeedles[r]);
+                    inRanges = _mm_or_si128(inRanges, _mm_cmpeq_epi16(beyondSpan, zero));
+                }
+                uint mask = _mm_movemask_epi8(inRanges);
+                if (mask != 0)
+                {
+                    return i + FirstLane(mask);
+                }
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            for (uint r = 0; r < numRanges; r++)
+            {
+                if (static_cast<char16>(buffer[i] - ranges[r * 2]) <= spans[r])
+                {
+                    return i;
+                }
+            }
+        }
+        return -1;
+    }
+
+    int StringUtilities::IndexOfAny(const char16* buffer, charcount_t length, const char16* const* searches, const charcount_t* searchLengths, uint numSearches, uint* foundSearch)
+    {
+        Assert(numSearches <= MaxSearches);
+
+        // As in IndexOf, a start position is only a candidate for a search string if both its first and last characters
+        // are there. All the search strings are filtered in the same pass over the buffer.
+        charcount_t maxSearchLength = 0;
+        for (uint s = 0; s < numSearches; s++)
+        {
+            Assert(searchLengths[s] != 0);
+            maxSearchLength = max(maxSearchLength, searchLengths[s]);
+        }
+
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available() && length >= maxSearchLength)
+        {
+            __m128i firstNeedles[MaxSearches];
+            __m128i lastNeedles[MaxSearches];
+            for (uint s = 0; s < numSearches; s++)
+            {
+                firstNeedles[s] = _mm_set1_epi16(static_cast<short>(searches[s][0]));
+                lastNeedles[s] = _mm_set1_epi16(static_cast<short>(searches[s][searchLengths[s] - 1]));
+            }
+
+            // Every search string fits at each start position of a block
+            const charcount_t startCount = length - maxSearchLength + 1;
+            for (; startCount - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                uint masks[MaxSearches];
+                uint anyMask = 0;
+                for (uint s = 0; s < numSearches; s++)
+                {
+                    masks[s] = _mm_movemask_epi8(_mm_and_si128(
+                        _mm_cmpeq_epi16(LoadBlock(buffer + i), firstNeedles[s]),
+                        _mm_cmpeq_epi16(LoadBlock(buffer + i + searchLengths[s] - 1), lastNeedles[s])));
+                    anyMask |= masks[s];
+                }
+                while (anyMask != 0)
+                {
+                    const charcount_t lane = FirstLane(anyMask);
+                    for (uint s = 0; s < numSearches; s++)
+                    {
+                        if ((masks[s] & (3u << (lane * 2))) != 0 && Equals(buffer + i + lane, searches[s], searchLengths[s]))
+                        {
+                            *foundSearch = s;
+                            return i + lane;
+                        }
+                    }
+                    anyMask = ClearLane(anyMask, lane);
+                }
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            for (uint s = 0; s < numSearches; s++)
+            {
+                if (searchLengths[s] <= length - i && buffer[i] == searches[s][0] && Equals(buffer + i, searches[s], searchLengths[s]))
+                {
+                    *foundSearch = s;
+                    return i;
+                }
+            }
+        }
+        return -1;
+    }
+
+    int StringUtilities::IndexOf(const char16* buffer, charcount_t length, const char16* search, charcount_t searchLength)
+    {
+        if (searchLength == 0)
+        {
+            return 0;
+        }
+        if (searchLength > length)
+        {
+            return -1;
+        }
+        if (searchLength == 1)
+        {
+            return IndexOfChar(buffer, length, search[0]);
+        }
+
+        // Candidates are filtered on both the first and the last character of the search string, which rejects
+        // far more positions than the first character alone; only the middle is compared for the survivors.
+        const char16 first = search[0];
+        const char16 last = search[searchLength - 1];
+        const charcount_t lastOffset = searchLength - 1;
+        const charcount_t middleLength = searchLength - 2;
+        const charcount_t startCount = length - searchLength + 1;
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i firstNeedle = _mm_set1_epi16(static_cast<short>(first));
+            const __m128i lastNeedle = _mm_set1_epi16(static_cast<short>(last));
+            for (; startCount - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                uint mask = _mm_movemask_epi8(_mm_and_si128(
+                    _mm_cmpeq_epi16(LoadBlock(buffer + i), firstNeedle),
+                    _mm_cmpeq_epi16(LoadBlock(buffer + i + lastOffset), lastNeedle)));
+                while (mask != 0)
+                {
+                    charcount_t lane = FirstLane(mask);
+                    if (Equals(buffer + i + lane + 1, search + 1, middleLength))
+                    {
+                        return i + lane;
+                    }
+                    mask = ClearLane(mask, lane);
+                }
+            }
+        }
+#endif
+
+        for (; i < startCount; i++)
+        {
+            if (buffer[i] == first && buffer[i + lastOffset] == last && Equals(buffer + i + 1, search + 1, middleLength))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int StringUtilities::LastIndexOf(const char16* buffer, charcount_t length, const char16* search, charcount_t searchLength, charcount_t maxStart)
+    {
+        if (searchLength > length)
+        {
+            return -1;
+        }
+
+        // Start positions below end are still to be checked, from the highest down
+        charcount_t end = min(maxStart, length - searchLength) + 1;
+        if (searchLength == 0)
+        {
+            return end - 1;
+        }
+
+        const char16 first = search[0];
+        const char16 last = search[searchLength - 1];
+        const charcount_t lastOffset = searchLength - 1;
+        const charcount_t middleLength = searchLength > 2 ? searchLength - 2 : 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i firstNeedle = _mm_set1_epi16(static_cast<short>(first));
+            const __m128i lastNeedle = _mm_set1_epi16(static_cast<short>(last));
+            while (end >= CharsPerBlock)
+            {
+                const charcount_t blockStart = end - CharsPerBlock;
+                uint mask = _mm_movemask_epi8(_mm_and_si128(
+                    _mm_cmpeq_epi16(LoadBlock(buffer + blockStart), firstNeedle),
+                    _mm_cmpeq_epi16(LoadBlock(buffer + blockStart + lastOffset), lastNeedle)));
+                while (mask != 0)
+                {
+                    charcount_t lane = LastLane(mask);
+                    if (Equals(buffer + blockStart + lane + 1, search + 1, middleLength))
+                    {
+                        return blockStart + lane;
+                    }
+                    mask = ClearLane(mask, lane);
+                }
+                end = blockStart;
+            }
+        }
+#endif
+
+        while (end > 0)
+        {
+            end--;
+            if (buffer[end] == first && buffer[end + lastOffset] == last && Equals(buffer + end + 1, search + 1, middleLength))
+            {
+                return end;
+            }
+        }
+        return -1;
+    }
+
+    charcount_t StringUtilities::IndexOfDifference(const char16* left, const char16* right, charcount_t length)
+    {
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            for (; length - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                uint mask = ~_mm_movemask_epi8(_mm_cmpeq_epi16(LoadBlock(left + i), LoadBlock(right + i))) & 0xFFFF;
+                if (mask != 0)
+                {
+                    return i + FirstLane(mask);
+                }
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            if (left[i] != right[i])
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    bool StringUtilities::Equals(const char16* left, const char16* right, charcount_t length)
+    {
+        return left == right || IndexOfDifference(left, right, length) == length;
+    }
+
+    int StringUtilities::Compare(const char16* left, const char16* right, charcount_t length)
+    {
+        charcount_t i = IndexOfDifference(left, right, length);
+        return i == length ? 0 : static_cast<int>(left[i]) - static_cast<int>(right[i]);
+    }
+
+    template <bool toUpper>
+    bool StringUtilities::TryChangeCaseAscii(const char16* src, char16* dst, charcount_t length)
+    {
+        const char16 rangeFirst = toUpper ? _u('a') : _u('A');
+        const char16 rangeLast = toUpper ? _u('z') : _u('Z');
+        const char16 caseBit = _u('a') - _u('A');
+        charcount_t i = 0;
+
+#ifdef STRING_UTILITIES_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i belowRange = _mm_set1_epi16(static_cast<short>(rangeFirst - 1));
+            const __m128i aboveRange = _mm_set1_epi16(static_cast<short>(rangeLast + 1));
+            const __m128i caseBits = _mm_set1_epi16(static_cast<short>(caseBit));
+            for (; length - i >= CharsPerBlock; i += CharsPerBlock)
+            {
+                const __m128i chars = LoadBlock(src + i);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, nonAsciiBits), zero)) != 0xFFFF)
+                {
+                    return false;
+                }
+
+                // All lanes are ASCII here, so the signed compares are exact
+                const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi16(chars, belowRange), _mm_cmplt_epi16(chars, aboveRange));
+                const __m128i delta = _mm_and_si128(inRange, caseBits);
+                const __m128i mapped = toUpper ? _mm_sub_epi16(chars, delta) : _mm_add_epi16(chars, delta);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), mapped);
+            }
+        }
+#endif
+
+        for (; i < length; i++)
+        {
+            char16 c = src[i];
+            if (c >= 0x80)
+            {
+                return false;
+            }
+            if (c >= rangeFirst && c <= rangeLast)
+            {
+                c = static_cast<char16>(toUpper ? c - caseBit : c + caseBit);
+            }
+            dst[i] = c;
+        }
+        return true;
+    }
+
+    bool StringUtilities::TryToLowerCaseAscii(const char16* src, char16* dst, charcount_t length)
+    {
+        return TryChangeCaseAscii<false>(src, dst, length);
+    }
+
+    bool StringUtilities::TryToUpperCaseAscii(const char16* src, char16* dst, charcount_t length)
+    {
+        return TryChangeCaseAscii<true>(src, dst, length);
+    }
+}
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    ///---------------------------------------------------------------------------
+    ///
+    /// class StringUtilities
+    ///
+    /// Search, comparison and case mapping over char16 buffers. On x86 and x64
+    /// these process 8 code units at a time with SSE2 when the processor has it,
+    /// and fall back to a scalar loop otherwise and for the tail of the buffer.
+    ///
+    ///---------------------------------------------------------------------------
+
+    class StringUtilities
+    {
+    public:
+        static const uint MaxRanges = 8;
+        static const uint MaxSearches = 4;
+
+        // Index of the first occurrence of c in buffer, or -1
+        static int IndexOfChar(const char16* buffer, charcount_t length, char16 c);
+
+        // Index of the first occurrence of either c0 or c1 in buffer, or -1
+        static int IndexOfEitherChar(const char16* buffer, charcount_t length, char16 c0, char16 c1);
+
+        // Index of the first character of buffer in one of the inclusive ranges, given as numRanges (lower, upper) pairs,
+        // or -1. There may be at most MaxRanges ranges.
+        static int IndexOfCharInRanges(const char16* buffer, charcount_t length, const char16* ranges, uint numRanges);
+
+        // Index of the first occurrence of any of the numSearches (at most MaxSearches) non-empty search strings in buffer,
+        // or -1. foundSearch is set to the search string found there, the lowest numbered one if several are.
+        static int IndexOfAny(const char16* buffer, charcount_t length, const char16* const* searches, const charcount_t* searchLengths, uint numSearches, uint* foundSearch);
+
+        // Index of the first occurrence of search in buffer, or -1. An empty search string is found at 0.
+        static int IndexOf(const char16* buffer, charcount_t length, const char16* search, charcount_t searchLength);
+
+        // Index of the last occurrence of search in buffer that starts at or before maxStart, or -1
+        static int LastIndexOf(const char16* buffer, charcount_t length, const char16* search, charcount_t searchLength, charcount_t maxStart);
+
+        static bool Equals(const char16* left, const char16* right, charcount_t length);
+
+        // Compares code unit by code unit: negative, zero or positive like wmemcmp
+        static int Compare(const char16* left, const char16* right, charcount_t length);
+
+        // Maps an all-ASCII string to lower or upper case into dst (which may be src). Returns false, with dst only
+        // partially written, as soon as a non-ASCII character is found, since those need full Unicode case mapping.
+        static bool TryToLowerCaseAscii(const char16* src, char16* dst, charcount_t length);
+        static bool TryToUpperCaseAscii(const char16* src, char16* dst, charcount_t length);
+
+    private:
+        // Index of the first code unit that differs, or length if there is none
+        static charcount_t IndexOfDifference(const char16* left, const char16* right, charcount_t length);
+
+        template <bool toUpper>
+        static bool TryChangeCaseAscii(const char16* src, char16* dst, charcount_t length);
+    };
+}
@@ -185,11 +185,20 @@
 #ifdef _WIN32
 #define ENABLE_OOP_NATIVE_CODEGEN 1     // Out of process JIT
 #endif
+#if defined(_M_X64) && DYNAMIC_INTERPRETER_THUNK
+#define ENABLE_REGEX_NATIVE_CODE 1      // Hot regex programs compiled to native code, in the interpreter thunk code pages
+#endif
 #endif
 
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
+// Direct-threaded (computed goto) opcode dispatch in the interpreter loop, see InterpreterLoop.inl.
+// Relies on the GCC/Clang labels-as-values extension.
+#if defined(INTERPRETER_THREADED_DISPATCH) && !defined(__GNUC__)
+#error "INTERPRETER_THREADED_DISPATCH requires compiler support for labels as values"
+#endif
+
 // VS2015 RTM has bugs with constexpr, so require min of VS2015 Update 3 (known good version)
 #if !defined(_MSC_VER) || _MSC_FULL_VER >= 190024210
 #define HAS_CONSTEXPR 1
@@ -11,6 +11,7 @@ PHASE(All)
         PHASE(RegexCompile)
         PHASE(DeferParse)
         PHASE(Redeferral)
+        PHASE(ScriptReload)
         PHASE(DeferEventHandlers)
         PHASE(FunctionSourceInfoParse)
         PHASE(StringTemplateParse)
@@ -26,6 +27,7 @@ PHASE(All)
         PHASE(DisableStackFuncOnDeferredEscape)
         PHASE(DelayCapture)
         PHASE(DebuggerScope)
+        PHASE(SuperInstruction)
         PHASE(ByteCodeSerialization)
             PHASE(VariableIntEncoding)
         PHASE(NativeCodeSerialization)
@@ -242,8 +244,10 @@ PHASE(All)
 #endif
     PHASE(Run)
         PHASE(Interpreter)
+            PHASE(InterpreterStack)
         PHASE(EvalCompile)
             PHASE(FastIndirectEval)
+            PHASE(DynamicCodeCache)
         PHASE(IdleDecommit)
         PHASE(IdleCollect)
         PHASE(MemoryAllocation)
@@ -290,11 +294,14 @@ PHASE(All)
         PHASE(BailOut)
         PHASE(RegexQc)
         PHASE(RegexOptBT)
+        PHASE(RegexJit)
+        PHASE(RegexLinear)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
         PHASE(CloneCacheInCollision)
         PHASE(ConstructorCache)
+            PHASE(ConstructorSlackTracking)
         PHASE(InlineCandidate)
         PHASE(InlineHostCandidate)
         PHASE(ScriptFunctionWithInlineCache)
@@ -306,6 +313,7 @@ PHASE(All)
             PHASE(ObjectHeaderInliningForObjectLiterals)
             PHASE(ObjectHeaderInliningForEmptyObjects)
         PHASE(OptUnknownElementName)
+        PHASE(MegamorphicPropertyCache)
 #if DBG_DUMP
         PHASE(TypePropertyCache)
         PHASE(InlineSlots)
@@ -329,6 +337,7 @@ PHASE(All)
         PHASE(XDataAllocator)
         PHASE(PageAllocator)
         PHASE(StringConcat)
+        PHASE(Latin1String)
 #if DBG_DUMP
         PHASE(PRNG)
 #endif
@@ -420,6 +429,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_InlineThresholdAdjustCountInSmallFunction  (10)
 #define DEFAULT_CONFIG_ConstructorInlineThreshold (21)      //Monomorphic constructor threshold
 #define DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType (2)
+#define DEFAULT_CONFIG_ConstructorMaxInlineSlotCapacity (32)
 #define DEFAULT_CONFIG_OutsideLoopInlineThreshold (16)      //Threshold to inline outside loops
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
@@ -478,6 +488,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_RegexDebug           (false)
 #define DEFAULT_CONFIG_RegexOptimize        (true)
 #define DEFAULT_CONFIG_DynamicRegexMruListSize (16)
+#define DEFAULT_CONFIG_RegexJitThreshold    (0)     // Number of matches at which a regex program is compiled to native code, 0 for never
+#define DEFAULT_CONFIG_RegexBacktrackLimit  (100000) // Number of backtracks in one match after which a regex switches to the linear-time matcher
+#define DEFAULT_CONFIG_RegexProgramCacheSize (1024) // Number of compiled regex programs the script contexts of a thread share
 #define DEFAULT_CONFIG_GoptCleanupThreshold  (25)
 #define DEFAULT_CONFIG_AsmGoptCleanupThreshold  (500)
 #define DEFAULT_CONFIG_OptimizeForManyInstances (false)
@@ -862,6 +875,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGNR(Boolean, BytecodeBigramHist    , "Provide a histogram of adjacent byte code pairs run by the script, to pick super-instruction candidates. (NoNative required).", false)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -879,6 +893,7 @@ FLAGNR(Boolean, ConsoleExitPause      , "Pause on exit when a console window is
 #endif
 FLAGNR(Number,  ConstructorInlineThreshold      , "Maximum size in bytecodes of a constructor inline candidate with monomorphic field access", DEFAULT_CONFIG_ConstructorInlineThreshold)
 FLAGNR(Number,  ConstructorCallsRequiredToFinalizeCachedType, "Number of calls to a constructor required before the type cached in the constructor cache is finalized", DEFAULT_CONFIG_ConstructorCallsRequiredToFinalizeCachedType)
+FLAGNR(Number,  ConstructorMaxInlineSlotCapacity, "Maximum number of inline slots slack tracking may give to objects created by a constructor", DEFAULT_CONFIG_ConstructorMaxInlineSlotCapacity)
 #ifdef SECURITY_TESTING
 FLAGNR(Boolean, CrashOnException      , "Removes the top-level exception handler, allowing jc.exe to crash on an unhandled exception.  No effect on IE. (default: false)", false)
 #endif
@@ -1385,6 +1400,9 @@ FLAGR (Boolean, RegexDebug            , "Trace compilation of UnifiedRegex expre
 FLAGR (Boolean, RegexOptimize         , "Optimize regular expressions in the unified Regex system (default: true)", DEFAULT_CONFIG_RegexOptimize)
 FLAGR (Number,  DynamicRegexMruListSize, "Size of the MRU list for dynamic regexes", DEFAULT_CONFIG_DynamicRegexMruListSize)
 #endif
+FLAGNR(Number,  RegexJitThreshold     , "Number of matches of a regular expression at which its program is compiled to native code, or 0 to never compile it (x64 only)", DEFAULT_CONFIG_RegexJitThreshold)
+FLAGNR(Number,  RegexBacktrackLimit   , "Number of backtracks in one match of a regular expression after which it is redone by the linear-time matcher, where supported (0 to always use it)", DEFAULT_CONFIG_RegexBacktrackLimit)
+FLAGR (Number,  RegexProgramCacheSize , "Number of compiled regular expression programs shared by the script contexts of a thread (0 to compile each one in every script context)", DEFAULT_CONFIG_RegexProgramCacheSize)
 
 FLAGR (Boolean, OptimizeForManyInstances, "Optimize script engine for many instances (low memory footprint per engine, assume low spare CPU cycles) (default: false)", DEFAULT_CONFIG_OptimizeForManyInstances)
 FLAGNR(Phases,  TestTrace             , "Test trace for the given phase", )
@@ -52,7 +52,7 @@ typedef unsigned char boolean;
 #endif
 
 // TODO: OOP JIT, how do we make this better?
-const int VTABLE_COUNT = 47;
+const int VTABLE_COUNT = 48;
 const int EQUIVALENT_TYPE_CACHE_SIZE = 8;
 
 typedef IDL_DEF([context_handle]) void * PTHREADCONTEXT_HANDLE;
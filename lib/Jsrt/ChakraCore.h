@@ -163,6 +163,73 @@ JsGetModuleHostInfo(
     _In_ JsModuleHostInfoKind moduleHostInfo,
     _Outptr_result_maybenull_ void** hostInfo);
 
+/// <summary>
+///     Called by the runtime to look up the serialized byte code of a dynamic code string
+///     (a Function constructor body or a global-scope eval) before parsing it.
+/// </summary>
+/// <param name="callbackState">The state passed to JsSetDynamicCodeCacheCallbacks.</param>
+/// <param name="key">
+///     A hash of the source and the flags it is compiled with. The key is stable across processes running
+///     the same engine build.
+/// </param>
+/// <param name="source">The UTF8 source. The host must only return an entry stored for exactly this source.</param>
+/// <param name="sourceLength">The number of bytes in source.</param>
+/// <param name="buffer">The serialized byte code. It only needs to stay valid until the callback returns.</param>
+/// <param name="bufferSize">The size of buffer in bytes.</param>
+/// <returns>
+///     true if an entry was found, false otherwise.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsDynamicCodeCacheLookupCallback)(
+    _In_opt_ void *callbackState,
+    _In_ uint64_t key,
+    _In_reads_bytes_(sourceLength) const uint8_t *source,
+    _In_ size_t sourceLength,
+    _Outptr_result_bytebuffer_(*bufferSize) const uint8_t **buffer,
+    _Out_ unsigned int *bufferSize);
+
+/// <summary>
+///     Called by the runtime after compiling a dynamic code string that missed the cache.
+/// </summary>
+/// <param name="callbackState">The state passed to JsSetDynamicCodeCacheCallbacks.</param>
+/// <param name="key">The key the entry will be looked up with.</param>
+/// <param name="source">The UTF8 source the byte code was compiled from.</param>
+/// <param name="sourceLength">The number of bytes in source.</param>
+/// <param name="buffer">The serialized byte code. It is only valid for the duration of the callback.</param>
+/// <param name="bufferSize">The size of buffer in bytes.</param>
+typedef void (CHAKRA_CALLBACK * JsDynamicCodeCacheStoreCallback)(
+    _In_opt_ void *callbackState,
+    _In_ uint64_t key,
+    _In_reads_bytes_(sourceLength) const uint8_t *source,
+    _In_ size_t sourceLength,
+    _In_reads_bytes_(bufferSize) const uint8_t *buffer,
+    _In_ unsigned int bufferSize);
+
+/// <summary>
+///     Sets the host cache consulted for code compiled by the Function constructor and by global-scope eval.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Direct eval is never cached since its code depends on the scope of the caller. Code compiled while
+///     a debugger is attached is not cached either.
+///     </para>
+///     <para>
+///     Entries written by a different engine build are rejected and the source is compiled again.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime the cache is used for.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callbacks.</param>
+/// <param name="lookupCallback">The lookup callback, or null to remove the cache.</param>
+/// <param name="storeCallback">The store callback. May be null for a read-only cache.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetDynamicCodeCacheCallbacks(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsDynamicCodeCacheLookupCallback lookupCallback,
+    _In_opt_ JsDynamicCodeCacheStoreCallback storeCallback);
+
 #ifndef NTBUILD
 /// <summary>
 ///     Called by the runtime to load the source code of the serialized script.
@@ -396,6 +463,43 @@ CHAKRA_API
         _In_ JsParseScriptAttributes parseAttributes,
         _Out_ JsValueRef *result);
 
+/// <summary>
+///     Parses a new version of a previously parsed script and returns a function representing it.
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         Function bodies of the new version are parsed on first call. Top-level functions whose text did not
+///         change, and that were already compiled in the previous version, are shared with it instead, together
+///         with their profile data and native code. Functions after the edit are only shared if the edit did
+///         not add or remove lines. Nothing is shared while a debugger is attached.
+///     </para>
+///     <para>
+///         Script source can be either JavascriptString or JavascriptExternalArrayBuffer, as for JsParse.
+///     </para>
+/// </remarks>
+/// <param name="previousScript">The function returned by JsParse or JsReloadScript for the previous version.</param>
+/// <param name="script">The new version of the script.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="parseAttributes">Attribute mask for parsing the script</param>
+/// <param name="result">The result of the compiled script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReloadScript(
+        _In_ JsValueRef previousScript,
+        _In_ JsValueRef script,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _In_ JsParseScriptAttributes parseAttributes,
+        _Out_ JsValueRef *result);
+
 /// <summary>
 ///     Creates the property ID associated with the name.
 /// </summary>
@@ -552,5 +656,295 @@ CHAKRA_API
         _In_ JsSourceContext sourceContext,
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
+
+/// <summary>
+///     Describes how the objects allocated by a constructor are laid out.
+/// </summary>
+typedef struct JsConstructorAllocationSiteInfo
+{
+    /// <summary>The number of constructions observed while the object layout was not final yet.</summary>
+    unsigned int observedConstructionCount;
+    /// <summary>The largest number of properties an observed construction added to its object.</summary>
+    unsigned int observedPropertyCount;
+    /// <summary>The number of inline slots requested for new objects.</summary>
+    unsigned int requestedInlineSlotCapacity;
+    /// <summary>The number of times the inline slots were found too few and the request was raised.</summary>
+    unsigned int inlineSlotCapacityGrowCount;
+    /// <summary>The number of inline slots of the objects currently allocated by the constructor, or 0 if none is cached.</summary>
+    unsigned int inlineSlotCapacity;
+    /// <summary>The total number of slots of the objects currently allocated by the constructor, or 0 if none is cached.</summary>
+    unsigned int slotCapacity;
+    /// <summary>Whether the object layout is final, i.e. the observation phase is over.</summary>
+    bool isFinal;
+} JsConstructorAllocationSiteInfo;
+
+/// <summary>
+///     Gets allocation site statistics for a constructor.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The first few objects a constructor creates are observed to find out how many properties it adds to them.
+///     Objects created afterwards are given enough inline slots to hold those properties, and unused ones are
+///     trimmed. This reports what was observed and the resulting layout. It is meant for diagnostics; the
+///     numbers are not stable across engine versions.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="constructor">The constructor function.</param>
+/// <param name="info">The allocation site statistics.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetConstructorAllocationSiteInfo(
+        _In_ JsValueRef constructor,
+        _Out_ JsConstructorAllocationSiteInfo *info);
+
+/// <summary>
+///     A handle to a JSON parser that takes its input in chunks.
+/// </summary>
+typedef void *JsJsonParserHandle;
+
+/// <summary>
+///     Creates a JSON parser that takes a UTF-8 JSON text in chunks, as they arrive.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Each chunk is decoded as it is added, so the host does not need to concatenate the chunks or
+///     convert the whole text first. A character may be split between two chunks.
+///     </para>
+///     <para>
+///     The parser is not tied to a runtime or context. It must be released with <c>JsReleaseJsonParser</c>.
+///     </para>
+/// </remarks>
+/// <param name="parser">The new JSON parser.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateJsonParser(
+        _Out_ JsJsonParserHandle *parser);
+
+/// <summary>
+///     Adds the next chunk of the UTF-8 JSON text to a JSON parser.
+/// </summary>
+/// <remarks>
+///     The parser does not hold on to the chunk after the call returns.
+/// </remarks>
+/// <param name="parser">The JSON parser.</param>
+/// <param name="content">The next chunk of the text.</param>
+/// <param name="length">The number of bytes in the chunk.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorOutOfMemory</c> if the text
+///     became too long, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsJsonParserAddChunk(
+        _In_ JsJsonParserHandle parser,
+        _In_reads_(length) const uint8_t *content,
+        _In_ size_t length);
+
+/// <summary>
+///     Parses the JSON text added to a JSON parser, like <c>JSON.parse</c> without a reviver.
+/// </summary>
+/// <remarks>
+///     <para>
+///     If the text is not valid JSON, a <c>SyntaxError</c> is set as the exception and
+///     <c>JsErrorScriptException</c> is returned. Either way the parser is empty afterwards and can
+///     take another text.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="parser">The JSON parser.</param>
+/// <param name="result">The parsed value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsJsonParserFinish(
+        _In_ JsJsonParserHandle parser,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Releases a JSON parser, along with any text that was added to it but not parsed.
+/// </summary>
+/// <param name="parser">The JSON parser.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReleaseJsonParser(
+        _In_ JsJsonParserHandle parser);
+
+/// <summary>
+///     Parses a UTF-8 JSON text, like <c>JSON.parse</c> without a reviver.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The text is parsed without first being made into a string. If it is not valid JSON, a
+///     <c>SyntaxError</c> is set as the exception and <c>JsErrorScriptException</c> is returned.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="content">The UTF-8 JSON text.</param>
+/// <param name="length">The number of bytes in the text.</param>
+/// <param name="result">The parsed value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseJsonUtf8(
+        _In_reads_(length) const char *content,
+        _In_ size_t length,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     A callback that receives the next piece of the UTF-8 text written by <c>JsStringifyJsonUtf8</c>.
+/// </summary>
+/// <remarks>
+///     The chunk is only valid during the call. The callback must not call back into the runtime.
+/// </remarks>
+/// <param name="chunk">The next piece of the text. A character is never split between two pieces.</param>
+/// <param name="length">The number of bytes in the piece.</param>
+/// <param name="callbackState">The state passed to <c>JsStringifyJsonUtf8</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsJsonWriteCallback)(
+    _In_reads_(length) const char *chunk,
+    _In_ size_t length,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Stringifies a value to UTF-8 JSON, like <c>JSON.stringify</c> without a replacer or indentation.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The text is written through <c>writeCallback</c> in pieces as it is encoded, so the UTF-8 text
+///     is never held in memory as a whole. Nothing is written if the value has no JSON representation,
+///     e.g. if it is undefined or a function.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to stringify.</param>
+/// <param name="writeCallback">The callback that receives the text.</param>
+/// <param name="callbackState">State passed to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStringifyJsonUtf8(
+        _In_ JsValueRef value,
+        _In_ JsJsonWriteCallback writeCallback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     Starts collecting statistics about the regular expressions run in a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Statistics are kept per pattern, i.e. per source and flags, across all the regular expressions
+///     and contexts of the runtime. Every match is counted. One match in every <c>sampleInterval</c>,
+///     across all patterns, is also timed and has its backtracking measured; sampled matches do not
+///     run as native code. An interval of 1 samples every match.
+///     </para>
+///     <para>
+///     Starting discards the statistics collected before. At most 4096 patterns are profiled; patterns
+///     first seen after that are not.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="sampleInterval">The number of matches per sampled match, at least 1.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStartRegexProfiling(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int sampleInterval);
+
+/// <summary>
+///     Stops collecting statistics about the regular expressions run in a runtime.
+/// </summary>
+/// <remarks>
+///     The statistics collected so far are kept, and can be read with <c>JsGetRegexProfile</c> until
+///     profiling is started again.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStopRegexProfiling(
+        _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Statistics about the regular expressions with one pattern.
+/// </summary>
+typedef struct JsRegexProfileEntry
+{
+    /// <summary>The source of the pattern, null terminated. Only valid during the callback.</summary>
+    const uint16_t *source;
+    /// <summary>The number of UTF-16 code units in the source.</summary>
+    size_t sourceLength;
+    /// <summary>The flags of the pattern, e.g. "gi", null terminated.</summary>
+    char flags[8];
+    /// <summary>The number of times the pattern was compiled. Contexts may share a compiled pattern.</summary>
+    unsigned int compileCount;
+    /// <summary>The total time spent compiling the pattern, in milliseconds.</summary>
+    double compileTime;
+    /// <summary>The number of matches run.</summary>
+    uint64_t executionCount;
+    /// <summary>The number of matches sampled.</summary>
+    uint64_t sampledExecutionCount;
+    /// <summary>The total time the sampled matches took, in milliseconds.</summary>
+    double sampledMatchTime;
+    /// <summary>The total number of times the sampled matches backtracked.</summary>
+    uint64_t sampledBacktrackCount;
+    /// <summary>The largest size the backtracking stack of a sampled match reached, in bytes.</summary>
+    size_t peakBacktrackStackSize;
+} JsRegexProfileEntry;
+
+/// <summary>
+///     A callback that receives the statistics of one pattern from <c>JsGetRegexProfile</c>.
+/// </summary>
+/// <remarks>
+///     The entry is only valid during the call. The callback must not call back into the runtime.
+/// </remarks>
+/// <param name="entry">The statistics of the pattern.</param>
+/// <param name="callbackState">The state passed to <c>JsGetRegexProfile</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsRegexProfileCallback)(
+    _In_ const JsRegexProfileEntry *entry,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Reports the statistics collected since regular expression profiling was last started.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The callback is called once per pattern, in the order the patterns were first seen. Nothing is
+///     reported if profiling was never started.
+///     </para>
+///     <para>
+///     The time a pattern takes overall can be estimated as
+///     <c>sampledMatchTime * executionCount / sampledExecutionCount</c>.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="callback">The callback that receives the statistics.</param>
+/// <param name="callbackState">State passed to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRegexProfile(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsRegexProfileCallback callback,
+        _In_opt_ void *callbackState);
 #endif // NTBUILD
 #endif // _CHAKRACORE_H_
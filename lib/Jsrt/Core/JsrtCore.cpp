@@ -213,3 +213,18 @@ JsGetModuleHostInfo(
     });
     return errorCode;
 }
+
+CHAKRA_API
+JsSetDynamicCodeCacheCallbacks(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsDynamicCodeCacheLookupCallback lookupCallback,
+    _In_opt_ JsDynamicCodeCacheStoreCallback storeCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetDynamicCodeCacheCallbacks(lookupCallback, storeCallback, callbackState);
+        return JsNoError;
+    });
+}
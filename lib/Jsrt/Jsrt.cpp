@@ -6,6 +6,8 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtJsonParser.h"
+#include "JsrtJsonWriter.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
@@ -13,6 +15,9 @@
 #include "Common/ByteSwap.h"
 #include "Library/DataView.h"
 #include "Library/JavascriptSymbol.h"
+#include "Library/JSON.h"
+#include "RegexFlags.h"
+#include "RegexProfiler.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
 
@@ -2869,7 +2874,7 @@ CHAKRA_API JsSetPromiseContinuationCallback(_In_ JsPromiseContinuationCallback p
 JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb,
     LoadScriptFlag loadScriptFlag, JsSourceContext sourceContext,
     const wchar_t *sourceUrl, bool parseOnly, JsParseScriptAttributes parseAttributes,
-    bool isSourceModule, JsValueRef *result)
+    bool isSourceModule, JsValueRef *result, Js::FunctionBody *previousGlobalBody = nullptr)
 {
     Js::JavascriptFunction *scriptFunction;
     CompileScriptException se;
@@ -2925,10 +2930,21 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
         }
 #endif
 
+        if (previousGlobalBody != nullptr)
+        {
+            // Only the functions that are actually called after the reload get compiled
+            loadScriptFlag = (LoadScriptFlag)(loadScriptFlag | LoadScriptFlag_ForceDeferParse);
+        }
+
         scriptFunction = scriptContext->LoadScript(script, cb,
             &si, &se, &utf8SourceInfo,
             Js::Constants::GlobalCode, loadScriptFlag, scriptSource);
 
+        if (scriptFunction != nullptr && previousGlobalBody != nullptr)
+        {
+            scriptContext->ReuseUnchangedFunctions(scriptFunction->GetFunctionBody(), previousGlobalBody);
+        }
+
 #if ENABLE_TTD
         if(PERFORM_JSRT_TTD_RECORD_ACTION_CHECK(scriptContext))
         {
@@ -4078,6 +4094,38 @@ static void CastCopy(const SrcChar* src, DstChar* dst, size_t count)
     }
 }
 
+// Creates a string from one-byte content, keeping it in the compact Latin-1 representation when possible.
+// Sets *created to false (without touching *value) if the caller has to fall back to creating a UTF16 string.
+static JsErrorCode CreateLatin1String(
+    _In_reads_(length) const uint8_t *content,
+    _In_ size_t length,
+    _Out_ bool *created,
+    _Out_ JsValueRef *value)
+{
+    *created = false;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(value);
+
+#if ENABLE_TTD
+        // TTD logs created strings as UTF16; let the caller record them through JsPointerToString.
+        if (scriptContext->IsTTDRecordModeEnabled() || scriptContext->ShouldPerformReplayAction())
+        {
+            return JsNoError;
+        }
+#endif
+
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        *value = Js::Latin1String::NewCopyBuffer(content, static_cast<charcount_t>(length), scriptContext);
+        *created = true;
+        return JsNoError;
+    });
+}
+
 CHAKRA_API JsCreateString(
     _In_ const char *content,
     _In_ size_t length,
@@ -4085,6 +4133,13 @@ CHAKRA_API JsCreateString(
 {
     PARAM_NOT_NULL(content);
 
+    bool created;
+    JsErrorCode errorCode = CreateLatin1String(reinterpret_cast<const uint8_t*>(content), length, &created, value);
+    if (errorCode != JsNoError || created)
+    {
+        return errorCode;
+    }
+
     AutoArrayPtr<uint16_t> data(HeapNewNoThrowArray(uint16_t, length), length);
     if (!data)
     {
@@ -4105,6 +4160,27 @@ CHAKRA_API JsCreateStringUtf8(
 {
     PARAM_NOT_NULL(content);
 
+    // ASCII input is also valid Latin-1 and needs no decoding
+    bool isAscii = true;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (content[i] >= 0x80)
+        {
+            isAscii = false;
+            break;
+        }
+    }
+
+    if (isAscii)
+    {
+        bool created;
+        JsErrorCode errorCode = CreateLatin1String(content, length, &created, value);
+        if (errorCode != JsNoError || created)
+        {
+            return errorCode;
+        }
+    }
+
     utf8::NarrowToWide wstr((LPCSTR)content, length);
     if (!wstr)
     {
@@ -4126,9 +4202,10 @@ CHAKRA_API JsCreateStringUtf16(
 }
 
 
-template <class CopyFunc>
-JsErrorCode WriteStringCopy(
-    JsValueRef value,
+template <class CharType, class CopyFunc>
+JsErrorCode WriteStringRangeCopy(
+    const CharType* str,
+    size_t strLength,
     int start,
     int length,
     _Out_opt_ size_t* written,
@@ -4139,14 +4216,6 @@ JsErrorCode WriteStringCopy(
         *written = 0;  // init to 0 for default
     }
 
-    const char16* str = nullptr;
-    size_t strLength = 0;
-    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
-    if (errorCode != JsNoError)
-    {
-        return errorCode;
-    }
-
     if (start < 0 || (size_t)start > strLength)
     {
         return JsErrorInvalidArgument;  // start out of range, no chars written
@@ -4158,7 +4227,7 @@ JsErrorCode WriteStringCopy(
         return JsNoError;  // no chars written
     }
 
-    errorCode = copyFunc(str + start, count, written);
+    JsErrorCode errorCode = copyFunc(str + start, count, written);
     if (errorCode != JsNoError)
     {
         return errorCode;
@@ -4172,6 +4241,30 @@ JsErrorCode WriteStringCopy(
     return JsNoError;
 }
 
+template <class CopyFunc>
+JsErrorCode WriteStringCopy(
+    JsValueRef value,
+    int start,
+    int length,
+    _Out_opt_ size_t* written,
+    const CopyFunc& copyFunc)
+{
+    if (written)
+    {
+        *written = 0;  // init to 0 for default
+    }
+
+    const char16* str = nullptr;
+    size_t strLength = 0;
+    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    return WriteStringRangeCopy(str, strLength, start, length, written, copyFunc);
+}
+
 CHAKRA_API JsCopyString(
     _In_ JsValueRef value,
     _In_ int start,
@@ -4182,6 +4275,26 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    // Strings still stored as Latin-1 are copied out as-is, without widening them first
+    const byte* latin1Str = Js::JavascriptString::Is(value) ?
+        Js::JavascriptString::FromVar(value)->TryGetLatin1Buffer() : nullptr;
+    if (latin1Str != nullptr)
+    {
+        return WriteStringRangeCopy(latin1Str, Js::JavascriptString::FromVar(value)->GetLength(), start, length, written,
+            [buffer](const byte* src, size_t count, size_t *needed)
+            {
+                if (buffer)
+                {
+                    memmove(buffer, src, count);
+                }
+                else
+                {
+                    *needed = count;
+                }
+                return JsNoError;
+            });
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
         {
@@ -4273,7 +4386,8 @@ _ALWAYSINLINE JsErrorCode CompileRun(
     JsValueRef sourceUrl,
     JsParseScriptAttributes parseAttributes,
     _Out_ JsValueRef *result,
-    bool parseOnly)
+    bool parseOnly,
+    Js::FunctionBody *previousGlobalBody = nullptr)
 {
     PARAM_NOT_NULL(scriptVal);
     VALIDATE_JSREF(scriptVal);
@@ -4334,7 +4448,7 @@ _ALWAYSINLINE JsErrorCode CompileRun(
     }
 
     return RunScriptCore(scriptVal, script, cb, scriptFlag,
-        sourceContext, url, parseOnly, parseAttributes, false, result);
+        sourceContext, url, parseOnly, parseAttributes, false, result, previousGlobalBody);
 }
 
 CHAKRA_API JsParse(
@@ -4359,6 +4473,45 @@ CHAKRA_API JsRun(
         result, false);
 }
 
+CHAKRA_API JsReloadScript(
+    _In_ JsValueRef previousScript,
+    _In_ JsValueRef scriptVal,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _In_ JsParseScriptAttributes parseAttributes,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(previousScript);
+    VALIDATE_JSREF(previousScript);
+
+    Js::FunctionBody *previousGlobalBody = nullptr;
+    JsErrorCode error = ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(previousScript, scriptContext);
+
+        if (!Js::ScriptFunction::Is(previousScript))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::FunctionProxy *proxy = Js::ScriptFunction::FromVar(previousScript)->GetFunctionProxy();
+        if (proxy == nullptr || !proxy->IsFunctionBody() || !proxy->GetFunctionBody()->GetIsGlobalFunc())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        previousGlobalBody = proxy->GetFunctionBody();
+        return JsNoError;
+    });
+
+    if (error != JsNoError)
+    {
+        return error;
+    }
+
+    return CompileRun(scriptVal, sourceContext, sourceUrl, parseAttributes,
+        result, true, previousGlobalBody);
+}
+
 CHAKRA_API JsCreatePropertyIdUtf8(
     _In_z_ const char *name,
     _In_ size_t length,
@@ -4514,4 +4667,217 @@ CHAKRA_API JsRunSerialized(
         sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
         buffer, sourceContext, url, false, result);
 }
+
+CHAKRA_API JsGetConstructorAllocationSiteInfo(
+    _In_ JsValueRef constructor,
+    _Out_ JsConstructorAllocationSiteInfo *info)
+{
+    PARAM_NOT_NULL(info);
+    memset(info, 0, sizeof(*info));
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_FUNCTION(constructor, scriptContext);
+
+        const Js::ConstructorCache *constructorCache = Js::JavascriptFunction::FromVar(constructor)->GetConstructorCache();
+        info->observedConstructionCount = constructorCache->GetObservedConstructionCount();
+        info->observedPropertyCount = constructorCache->GetObservedPropertyCount();
+        info->requestedInlineSlotCapacity = constructorCache->GetRequestedInlineSlotCapacity();
+        info->inlineSlotCapacityGrowCount = constructorCache->GetInlineSlotCapacityGrowCount();
+        if (constructorCache->IsEnabled())
+        {
+            info->inlineSlotCapacity = constructorCache->GetInlineSlotCount();
+            info->slotCapacity = constructorCache->GetSlotCount();
+        }
+        info->isFinal = constructorCache->IsEnabled() && !constructorCache->NeedsUpdateAfterCtor();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateJsonParser(
+    _Out_ JsJsonParserHandle *parser)
+{
+    PARAM_NOT_NULL(parser);
+    *parser = nullptr;
+
+    JsrtJsonParser *jsonParser = HeapNewNoThrow(JsrtJsonParser);
+    if (jsonParser == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    *parser = jsonParser->ToHandle();
+    return JsNoError;
+}
+
+CHAKRA_API JsJsonParserAddChunk(
+    _In_ JsJsonParserHandle parser,
+    _In_reads_(length) const uint8_t *content,
+    _In_ size_t length)
+{
+    PARAM_NOT_NULL(parser);
+    if (length > 0)
+    {
+        PARAM_NOT_NULL(content);
+    }
+
+    return JsrtJsonParser::FromHandle(parser)->AddChunk(content, length) ? JsNoError : JsErrorOutOfMemory;
+}
+
+CHAKRA_API JsJsonParserFinish(
+    _In_ JsJsonParserHandle parser,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(parser);
+    PARAM_NOT_NULL(result);
+    *result = JS_INVALID_REFERENCE;
+
+    return ContextAPIWrapper_NoRecord<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        *result = JsrtJsonParser::FromHandle(parser)->Finish(scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReleaseJsonParser(
+    _In_ JsJsonParserHandle parser)
+{
+    PARAM_NOT_NULL(parser);
+
+    HeapDelete(JsrtJsonParser::FromHandle(parser));
+    return JsNoError;
+}
+
+CHAKRA_API JsParseJsonUtf8(
+    _In_reads_(length) const char *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(result);
+    *result = JS_INVALID_REFERENCE;
+
+    // The text is decoded once into a buffer that is parsed in place, without making a string of it
+    JsrtJsonParser jsonParser;
+    if (!jsonParser.AddChunk(reinterpret_cast<const utf8char_t *>(content), length))
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPIWrapper_NoRecord<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        *result = jsonParser.Finish(scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStringifyJsonUtf8(
+    _In_ JsValueRef value,
+    _In_ JsJsonWriteCallback writeCallback,
+    _In_opt_ void *callbackState)
+{
+    PARAM_NOT_NULL(writeCallback);
+
+    return ContextAPIWrapper_NoRecord<true>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+
+        Js::Var json = JSON::Stringify(value, scriptContext);
+        if (!Js::JavascriptString::Is(json))
+        {
+            // No JSON representation, e.g. undefined or a function
+            return JsNoError;
+        }
+
+        // The result is a string tree; it is encoded a piece at a time rather than flattened first
+        JsrtJsonWriter writer(scriptContext, writeCallback, callbackState);
+        writer.Write(Js::JavascriptString::FromVar(json));
+        writer.Finish();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStartRegexProfiling(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int sampleInterval)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        if (sampleInterval == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->StartRegexProfiling(sampleInterval);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopRegexProfiling(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->StopRegexProfiling();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRegexProfile(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsRegexProfileCallback callback,
+    _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(callback);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        const UnifiedRegex::RegexProfiler *profiler = threadContext->GetRegexProfiler();
+        if (profiler == nullptr)
+        {
+            return JsNoError;
+        }
+
+        profiler->Map([&](const UnifiedRegex::RegexProfileEntry &profileEntry)
+        {
+            JsRegexProfileEntry entry = {};
+            entry.source = reinterpret_cast<const uint16_t *>(profileEntry.source);
+            entry.sourceLength = profileEntry.sourceLen;
+
+            // In the order the flags getter of RegExp.prototype lists them
+            int flagCount = 0;
+            if (profileEntry.flags & UnifiedRegex::GlobalRegexFlag) entry.flags[flagCount++] = 'g';
+            if (profileEntry.flags & UnifiedRegex::IgnoreCaseRegexFlag) entry.flags[flagCount++] = 'i';
+            if (profileEntry.flags & UnifiedRegex::MultilineRegexFlag) entry.flags[flagCount++] = 'm';
+            if (profileEntry.flags & UnifiedRegex::UnicodeRegexFlag) entry.flags[flagCount++] = 'u';
+            if (profileEntry.flags & UnifiedRegex::StickyRegexFlag) entry.flags[flagCount++] = 'y';
+            entry.flags[flagCount] = '\0';
+
+            entry.compileCount = profileEntry.compileCount;
+            entry.compileTime = profiler->TicksToMilliseconds(profileEntry.compileTicks);
+            entry.executionCount = profileEntry.executionCount;
+            entry.sampledExecutionCount = profileEntry.sampledExecutionCount;
+            entry.sampledMatchTime = profiler->TicksToMilliseconds(profileEntry.sampledMatchTicks);
+            entry.sampledBacktrackCount = profileEntry.sampledBacktrackCount;
+            entry.peakBacktrackStackSize = profileEntry.peakContStackSize;
+            callback(&entry, callbackState);
+        });
+        return JsNoError;
+    });
+}
 #endif // NTBUILD
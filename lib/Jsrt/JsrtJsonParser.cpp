@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtJsonParser.h"
+#include "Library/JSON.h"
+
+static bool IsContinuationByte(utf8char_t b)
+{
+    return (b & 0xC0) == 0x80;
+}
+
+static size_t SequenceLength(utf8char_t lead)
+{
+    return lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+}
+
+// The number of bytes at the start of the chunk that hold whole characters
+static size_t CompleteLength(const utf8char_t * bytes, size_t count)
+{
+    for (size_t back = 1; back <= count && back < 4; back++)
+    {
+        const utf8char_t b = bytes[count - back];
+        if (!IsContinuationByte(b))
+        {
+            return SequenceLength(b) > back ? count - back : count;
+        }
+    }
+    return count;
+}
+
+JsrtJsonParser::JsrtJsonParser()
+    : buffer(nullptr), length(0), capacity(0), pendingCount(0)
+{
+}
+
+JsrtJsonParser::~JsrtJsonParser()
+{
+    Reset();
+}
+
+void JsrtJsonParser::Reset()
+{
+    if (buffer != nullptr)
+    {
+        HeapDeleteArray(capacity, buffer);
+        buffer = nullptr;
+    }
+    length = 0;
+    capacity = 0;
+    pendingCount = 0;
+}
+
+bool JsrtJsonParser::EnsureCapacity(size_t additional)
+{
+    const size_t required = length + additional;
+    if (required < length || required > Js::JavascriptString::MaxCharLength)
+    {
+        return false;
+    }
+    if (required <= capacity)
+    {
+        return true;
+    }
+
+    size_t newCapacity = capacity * 2 > required ? capacity * 2 : required;
+    if (newCapacity < InitialCapacity)
+    {
+        newCapacity = InitialCapacity;
+    }
+    char16 * newBuffer = HeapNewNoThrowArray(char16, newCapacity);
+    if (newBuffer == nullptr)
+    {
+        return false;
+    }
+    if (buffer != nullptr)
+    {
+        js_memcpy_s(newBuffer, newCapacity * sizeof(char16), buffer, length * sizeof(char16));
+        HeapDeleteArray(capacity, buffer);
+    }
+    buffer = newBuffer;
+    capacity = newCapacity;
+    return true;
+}
+
+void JsrtJsonParser::Decode(const utf8char_t * bytes, size_t count)
+{
+    // Each byte decodes to at most one UTF-16 code unit, which EnsureCapacity has made room for
+    LPCUTF8 current = bytes;
+    length += utf8::DecodeUnitsInto(buffer + length, current, bytes + count, utf8::doAllowInvalidWCHARs);
+}
+
+bool JsrtJsonParser::AddChunk(const utf8char_t * chunk, size_t chunkLength)
+{
+    if (!EnsureCapacity(pendingCount + chunkLength))
+    {
+        return false;
+    }
+
+    if (pendingCount > 0)
+    {
+        // Finish the character that the last chunk ended in the middle of
+        const size_t sequenceLength = SequenceLength(pendingBytes[0]);
+        while (pendingCount < sequenceLength && chunkLength > 0 && IsContinuationByte(*chunk))
+        {
+            pendingBytes[pendingCount++] = *chunk++;
+            chunkLength--;
+        }
+        if (pendingCount < sequenceLength && chunkLength == 0)
+        {
+            return true;
+        }
+        Decode(pendingBytes, pendingCount);
+        pendingCount = 0;
+    }
+
+    const size_t completeLength = CompleteLength(chunk, chunkLength);
+    Decode(chunk, completeLength);
+    pendingCount = chunkLength - completeLength;
+    js_memcpy_s(pendingBytes, sizeof(pendingBytes), chunk + completeLength, pendingCount);
+    return true;
+}
+
+Js::Var JsrtJsonParser::Finish(Js::ScriptContext * scriptContext)
+{
+    Js::Var result = nullptr;
+    TryFinally([&]()
+    {
+        // A character cut off at the very end is decoded as it is, like it would be from a single buffer
+        if (pendingCount > 0)
+        {
+            Decode(pendingBytes, pendingCount);
+            pendingCount = 0;
+        }
+        result = JSON::Parse(length > 0 ? buffer : _u(""), static_cast<charcount_t>(length), nullptr, scriptContext);
+    },
+    [&](bool /*hasException*/)
+    {
+        Reset();
+    });
+    return result;
+}
@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Collects a UTF-8 JSON text chunk by chunk for JsJsonParserAddChunk. Each chunk is decoded as it arrives into one
+// growing UTF-16 buffer, which JsJsonParserFinish parses in place, so neither the chunks nor a string holding the
+// whole text are ever materialized. A character split between two chunks is held back until the rest arrives.
+class JsrtJsonParser
+{
+public:
+    JsrtJsonParser();
+    ~JsrtJsonParser();
+
+    static JsrtJsonParser * FromHandle(JsJsonParserHandle handle) { return static_cast<JsrtJsonParser *>(handle); }
+    JsJsonParserHandle ToHandle() { return static_cast<JsJsonParserHandle>(this); }
+
+    // Returns false if the buffer could not be grown to hold the chunk
+    bool AddChunk(const utf8char_t * chunk, size_t chunkLength);
+
+    // Parses the text added so far. The parser is empty afterwards, whether or not the text was valid.
+    Js::Var Finish(Js::ScriptContext * scriptContext);
+
+private:
+    static const size_t MaxSequenceLength = 4;
+    static const size_t InitialCapacity = 256;
+
+    bool EnsureCapacity(size_t additional);
+    void Decode(const utf8char_t * bytes, size_t count);
+    void Reset();
+
+    char16 * buffer;
+    size_t length;
+    size_t capacity;
+
+    // The start of a multi-byte character at the end of the last chunk
+    utf8char_t pendingBytes[MaxSequenceLength];
+    size_t pendingCount;
+};
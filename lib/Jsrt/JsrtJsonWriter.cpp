@@ -0,0 +1,121 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtJsonWriter.h"
+#include "Codex/Utf8Helper.h"
+
+JsrtJsonWriter::JsrtJsonWriter(Js::ScriptContext * scriptContext, JsJsonWriteCallback writeCallback, void * callbackState)
+    : scriptContext(scriptContext), writeCallback(writeCallback), callbackState(callbackState), bufferLength(0)
+{
+}
+
+void JsrtJsonWriter::Write(Js::JavascriptString * str)
+{
+    PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+    const charcount_t length = str->GetLength();
+    if (length == 0)
+    {
+        return;
+    }
+
+    if (str->IsFinalized())
+    {
+        Append(str->GetString(), length);
+        return;
+    }
+
+    // Less than the whole buffer, since a flush may keep back half a surrogate pair
+    if (length < BufferLength)
+    {
+        // Copy the whole subtree into the scratch buffer, the way flattening would, but without finalizing it
+        if (length > BufferLength - bufferLength)
+        {
+            Flush(false);
+        }
+
+        char16 * const destination = &buffer[bufferLength];
+        Js::StringCopyInfoStack nestedStringTreeCopyInfos(scriptContext);
+        str->Copy(destination, nestedStringTreeCopyInfos, 0);
+        while (!nestedStringTreeCopyInfos.IsEmpty())
+        {
+            const Js::StringCopyInfo copyInfo(nestedStringTreeCopyInfos.Pop());
+            copyInfo.SourceString()->Copy(copyInfo.DestinationBuffer(), nestedStringTreeCopyInfos, 0);
+        }
+        bufferLength += length;
+        return;
+    }
+
+    Js::JavascriptString * const * items;
+    const int itemCount = str->GetRandomAccessItemsFromConcatString(items);
+    if (itemCount != -1)
+    {
+        for (int i = 0; i < itemCount; i++)
+        {
+            if (items[i] != nullptr)
+            {
+                Write(items[i]);
+            }
+        }
+        return;
+    }
+
+    if (VirtualTableInfo<Js::ConcatStringBuilder>::HasVirtualTable(str))
+    {
+        static_cast<Js::ConcatStringBuilder *>(str)->MapItems([this](Js::JavascriptString * item)
+        {
+            Write(item);
+        });
+        return;
+    }
+
+    // A leaf that is too long for the scratch buffer and has no buffer of its own yet, e.g. a long escaped string.
+    // Only this leaf is flattened.
+    Append(str->GetString(), length);
+}
+
+void JsrtJsonWriter::Finish()
+{
+    Flush(true);
+}
+
+void JsrtJsonWriter::Append(const char16 * str, charcount_t count)
+{
+    while (count != 0)
+    {
+        if (bufferLength == BufferLength)
+        {
+            Flush(false);
+        }
+
+        const charcount_t copyCount = min(count, BufferLength - bufferLength);
+        js_wmemcpy_s(&buffer[bufferLength], BufferLength - bufferLength, str, copyCount);
+        bufferLength += copyCount;
+        str += copyCount;
+        count -= copyCount;
+    }
+}
+
+void JsrtJsonWriter::Flush(bool isLast)
+{
+    charcount_t count = bufferLength;
+    if (!isLast && count != 0 && Js::NumberUtilities::IsSurrogateUpperPart(buffer[count - 1]))
+    {
+        // Keep a surrogate pair together so that it is encoded as one character
+        count--;
+    }
+
+    if (count != 0)
+    {
+        const size_t encodedLength = utf8::EncodeTrueUtf8IntoAndNullTerminate(encoded, buffer, count);
+        writeCallback(reinterpret_cast<const char *>(encoded), encodedLength, callbackState);
+    }
+
+    if (count != bufferLength)
+    {
+        buffer[0] = buffer[count];
+    }
+    bufferLength -= count;
+}
@@ -0,0 +1,33 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Encodes the string tree that JSON.stringify produces to UTF-8 for JsStringifyJsonUtf8, a piece at a time. The tree is
+// walked without being flattened: finalized leaves are encoded straight from their buffers, and subtrees that fit are
+// copied into a fixed scratch buffer first, so neither the UTF-16 nor the UTF-8 text is ever materialized as a whole.
+class JsrtJsonWriter
+{
+public:
+    JsrtJsonWriter(Js::ScriptContext * scriptContext, JsJsonWriteCallback writeCallback, void * callbackState);
+
+    void Write(Js::JavascriptString * str);
+
+    // Writes what is left in the scratch buffer. Must be called once after the last Write.
+    void Finish();
+
+private:
+    static const charcount_t BufferLength = 1024;
+
+    void Append(const char16 * str, charcount_t count);
+    void Flush(bool isLast);
+
+    Js::ScriptContext * const scriptContext;
+    const JsJsonWriteCallback writeCallback;
+    void * const callbackState;
+
+    char16 buffer[BufferLength];
+    charcount_t bufferLength;
+    utf8char_t encoded[BufferLength * 3 + 1];
+};
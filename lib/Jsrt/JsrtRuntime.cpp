@@ -97,6 +97,12 @@ void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollect
     }
 }
 
+void JsrtRuntime::SetDynamicCodeCacheCallbacks(JsDynamicCodeCacheLookupCallback lookupCallback, JsDynamicCodeCacheStoreCallback storeCallback, void * callbackState)
+{
+    this->dynamicCodeCache.SetCallbacks(lookupCallback, storeCallback, callbackState);
+    this->threadContext->SetDynamicCodeCache(this->dynamicCodeCache.HasCallbacks() ? &this->dynamicCodeCache : nullptr);
+}
+
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
     if (flags & Collect_Begin)
@@ -141,3 +147,42 @@ JsrtDebugManager * JsrtRuntime::GetJsrtDebugManager()
 {
     return this->jsrtDebugManager;
 }
+
+void JsrtDynamicCodeCache::SetCallbacks(JsDynamicCodeCacheLookupCallback lookupCallback, JsDynamicCodeCacheStoreCallback storeCallback, void * callbackState)
+{
+    if (lookupCallback != nullptr)
+    {
+        this->lookupCallback = lookupCallback;
+        this->storeCallback = storeCallback;
+        this->callbackState = callbackState;
+    }
+    else
+    {
+        this->lookupCallback = nullptr;
+        this->storeCallback = nullptr;
+        this->callbackState = nullptr;
+    }
+}
+
+bool JsrtDynamicCodeCache::TryGetByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte ** buffer, DWORD * bufferSize)
+{
+    Assert(this->lookupCallback != nullptr);
+
+    const uint8_t * cachedBuffer = nullptr;
+    unsigned int cachedBufferSize = 0;
+    if (!this->lookupCallback(this->callbackState, key, (const uint8_t *)utf8Source, cbSource, &cachedBuffer, &cachedBufferSize))
+    {
+        return false;
+    }
+
+    *buffer = cachedBuffer;
+    *bufferSize = cachedBufferSize;
+    return true;
+}
+
+void JsrtDynamicCodeCache::StoreByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte * buffer, DWORD bufferSize)
+{
+    Assert(this->storeCallback != nullptr);
+
+    this->storeCallback(this->callbackState, key, (const uint8_t *)utf8Source, cbSource, buffer, bufferSize);
+}
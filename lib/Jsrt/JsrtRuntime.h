@@ -10,6 +10,24 @@
 
 class JsrtContext;
 
+class JsrtDynamicCodeCache : public DynamicCodeCache
+{
+public:
+    JsrtDynamicCodeCache() : lookupCallback(nullptr), storeCallback(nullptr), callbackState(nullptr) {}
+
+    void SetCallbacks(JsDynamicCodeCacheLookupCallback lookupCallback, JsDynamicCodeCacheStoreCallback storeCallback, void * callbackState);
+    bool HasCallbacks() const { return lookupCallback != nullptr; }
+
+    virtual bool TryGetByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte ** buffer, DWORD * bufferSize) override;
+    virtual bool CanStoreByteCode() const override { return storeCallback != nullptr; }
+    virtual void StoreByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte * buffer, DWORD bufferSize) override;
+
+private:
+    JsDynamicCodeCacheLookupCallback lookupCallback;
+    JsDynamicCodeCacheStoreCallback storeCallback;
+    void * callbackState;
+};
+
 class JsrtRuntime
 {
     friend class JsrtContext;
@@ -36,6 +54,7 @@ public:
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetDynamicCodeCacheCallbacks(JsDynamicCodeCacheLookupCallback lookupCallback, JsDynamicCodeCacheStoreCallback storeCallback, void * callbackState);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -56,6 +75,7 @@ private:
     ThreadContext::CollectCallBack * collectCallback;
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
+    JsrtDynamicCodeCache dynamicCodeCache;
     void * callbackContext;
     bool useIdle;
     bool dispatchExceptions;
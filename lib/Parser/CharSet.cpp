@@ -1818,6 +1818,12 @@ namespace UnifiedRegex
         return leaf->vec.Get(CharSetNode::leafIdx(k));
     }
 
+    bool RuntimeCharSet<char16>::GetNextHighRange(Char searchCharStart, _Out_ Char *outLowerChar, _Out_ Char *outHigherChar) const
+    {
+        Assert(CTU(searchCharStart) >= CharSetNode::directSize);
+        return root != nullptr && root->GetNextRange(CharSetNode::levels - 1, searchCharStart, outLowerChar, outHigherChar);
+    }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     // CAUTION: This method is very slow.
     void RuntimeCharSet<char16>::Print(DebugWriter* w) const
@@ -738,6 +738,10 @@ namespace UnifiedRegex
                 return Get_helper(CTU(kc));
         }
 
+        // Finds the next range of characters in the set starting at or after searchCharStart, which must be at least
+        // CharSetNode::directSize. Characters below that are tested one by one with Get.
+        _Success_(return) bool GetNextHighRange(Char searchCharStart, _Out_ Char *outLowerChar, _Out_ Char *outHigherChar) const;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         void Print(DebugWriter* w) const;
 #endif
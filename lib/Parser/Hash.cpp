@@ -315,6 +315,15 @@ IdentPtr HashTbl::PidHashNameLenWithHash(_In_reads_(cch) CharType const * prgch,
 
     HashTbl::CopyString(pid->m_sz, prgch, cch);
 
+    if (m_backgroundPropertyIdSource != nullptr)
+    {
+        const Js::PropertyRecord * propertyRecord = m_backgroundPropertyIdSource->FindBoundPropertyRecordConcurrent(pid->m_sz, cch);
+        if (propertyRecord != nullptr)
+        {
+            pid->m_propertyId = propertyRecord->GetPropertyId();
+        }
+    }
+
     return pid;
 }
 
@@ -4,6 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
+class ThreadContext;
+
 // StaticSym contains a string literal at the end (flexible array) and is
 // meant to be initialized statically. However, flexible array initialization
 // is not allowed in standard C++. We declare each StaticSym with length
@@ -373,6 +375,10 @@ public:
     NoReleaseAllocator* GetAllocator() {return &m_noReleaseAllocator;}
 
     bool Contains(_In_reads_(cch) LPCOLESTR prgch, int32 cch);
+
+    // Set on the tables of background parsers. New identifiers that name built-in or bound properties get their property
+    // ids as they are added, so the main thread doesn't have to look them up when it generates byte code.
+    void SetBackgroundPropertyIdSource(ThreadContext * threadContext) { m_backgroundPropertyIdSource = threadContext; }
 private:
 
     NoReleaseAllocator m_noReleaseAllocator;            // to allocate identifiers
@@ -382,11 +388,13 @@ private:
     uint32 m_luCount;              // count of the number of entires in the hash table
     ErrHandler * m_perr;        // error handler to use
     IdentPtr m_rpid[tkLimKwd];
+    ThreadContext * m_backgroundPropertyIdSource;
 
     HashTbl(ErrHandler * perr)
     {
         m_prgpidName = nullptr;
         m_perr = perr;
+        m_backgroundPropertyIdSource = nullptr;
         memset(&m_rpid, 0, sizeof(m_rpid));
     }
     ~HashTbl(void) {}
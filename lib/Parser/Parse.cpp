@@ -11182,6 +11182,10 @@ void Parser::PrepareScanner(bool fromExternal)
     // create the hash table and init PID members
     if (nullptr == (m_phtbl = HashTbl::Create(HASH_TABLE_SIZE, &m_err)))
         Error(ERRnoMemory);
+    if (m_isInBackground)
+    {
+        m_phtbl->SetBackgroundPropertyIdSource(m_scriptContext->GetThreadContext());
+    }
     InitPids();
 
     // create the scanner
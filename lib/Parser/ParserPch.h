@@ -15,6 +15,9 @@
 #include "StandardChars.h"
 #include "OctoquadIdentifier.h"
 #include "RegexCompileTime.h"
+#include "RegexNativeCompiler.h"
+#include "RegexLinearMatcher.h"
+#include "RegexProfiler.h"
 #include "RegexParser.h"
 #include "RegexPattern.h"
 
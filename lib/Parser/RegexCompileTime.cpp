@@ -94,7 +94,7 @@ namespace UnifiedRegex
             else if (count == 2)
                 EMIT(compiler, SyncToChar2SetAndConsumeInst, entries[0], entries[1]);
             else
-                EMIT(compiler, SyncToSetAndConsumeInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneSetFrom(compiler.rtAllocator, *firstSet);
             return 1;
         }
         else
@@ -104,7 +104,7 @@ namespace UnifiedRegex
             else if (count == 2)
                 EMIT(compiler, SyncToChar2SetAndContinueInst, entries[0], entries[1]);
             else
-                EMIT(compiler, SyncToSetAndContinueInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneSetFrom(compiler.rtAllocator, *firstSet);
             return 0;
         }
     }
@@ -1361,7 +1361,7 @@ namespace UnifiedRegex
             if (firstSet->IsSingleton())
                 EMIT(compiler, SyncToCharAndConsumeInst, firstSet->Singleton());
             else
-                EMIT(compiler, SyncToSetAndConsumeInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneSetFrom(compiler.rtAllocator, *firstSet);
             return 1;
         }
         else
@@ -1378,14 +1378,14 @@ namespace UnifiedRegex
                 else if (count == 2)
                     EMIT(compiler, SyncToChar2SetAndContinueInst, entries[0], entries[1]);
                 else
-                    EMIT(compiler, SyncToSetAndContinueInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                    EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneSetFrom(compiler.rtAllocator, *firstSet);
             }
             else
             {
                 if (firstSet->IsSingleton())
                     EMIT(compiler, SyncToCharAndBackupInst, firstSet->Singleton(), prevConsumes);
                 else
-                    EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                    EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->CloneSetFrom(compiler.rtAllocator, *firstSet);
             }
             return 0;
         }
@@ -1614,16 +1614,15 @@ namespace UnifiedRegex
         //   SyncToSetAnd(Consume|Continue|Backup)
         //
 
-        RuntimeCharSet<Char> *runtimeSet;
         CharCount consumedChars;
         if (isHeadSyncronizingNode)
         {
             // For a head literal there's no need to back up after finding the literal, so use a faster instruction
             Assert(prevConsumes.IsExact(0)); // there should not be any consumes before this node
             if(isNegation)
-                runtimeSet = &EMIT(compiler, SyncToSetAndConsumeInst<true>)->set;
+                EMIT(compiler, SyncToSetAndConsumeInst<true>)->CloneSetFrom(compiler.rtAllocator, set);
             else
-                runtimeSet = &EMIT(compiler, SyncToSetAndConsumeInst<false>)->set;
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneSetFrom(compiler.rtAllocator, set);
             consumedChars = 1;
         }
         else
@@ -1635,17 +1634,16 @@ namespace UnifiedRegex
             if(prevConsumes.IsExact(0))
             {
                 if(isNegation)
-                    runtimeSet = &EMIT(compiler, SyncToSetAndContinueInst<true>)->set;
+                    EMIT(compiler, SyncToSetAndContinueInst<true>)->CloneSetFrom(compiler.rtAllocator, set);
                 else
-                    runtimeSet = &EMIT(compiler, SyncToSetAndContinueInst<false>)->set;
+                    EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneSetFrom(compiler.rtAllocator, set);
             }
             else if(isNegation)
-                runtimeSet = &EMIT(compiler, SyncToSetAndBackupInst<true>, prevConsumes)->set;
+                EMIT(compiler, SyncToSetAndBackupInst<true>, prevConsumes)->CloneSetFrom(compiler.rtAllocator, set);
             else
-                runtimeSet = &EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->set;
+                EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->CloneSetFrom(compiler.rtAllocator, set);
             consumedChars = 0;
         }
-        runtimeSet->CloneFrom(compiler.rtAllocator, set);
         return consumedChars;
     }
 
@@ -4388,6 +4386,66 @@ namespace UnifiedRegex
         Assert(program->rep.insts.litbufLen == finalLen);
     }
 
+    void Compiler::Annotate(Node* root)
+    {
+        root->AnnotatePass0(*this);
+        root->AnnotatePass1(*this, true, true, true, true);
+        // Nothing comes before or after overall pattern
+        CountDomain consumes(0);
+        // Match could progress from lhs (since we try successive start positions), but can never regress
+        root->AnnotatePass2(*this, consumes, false, true);
+        // Anything could follow an end of pattern match
+        CharSet<Char>* follow = standardChars->GetFullSet();
+        root->AnnotatePass3(*this, consumes, follow, true, false);
+        root->AnnotatePass4(*this);
+    }
+
+    MatchLiteralNode* Compiler::RequiredLiteral(Node* node)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::MatchLiteral:
+            {
+                MatchLiteralNode* literalNode = (MatchLiteralNode*)node;
+                return literalNode->isEquivClass ? 0 : literalNode;
+            }
+        case Node::Concat:
+            {
+                MatchLiteralNode* best = 0;
+                for (ConcatNode* curr = (ConcatNode*)node; curr != 0; curr = curr->tail)
+                {
+                    MatchLiteralNode* literalNode = RequiredLiteral(curr->head);
+                    if (literalNode != 0 && (best == 0 || literalNode->length > best->length))
+                        best = literalNode;
+                }
+                return best;
+            }
+        case Node::DefineGroup:
+            return RequiredLiteral(((DefineGroupNode*)node)->body);
+        case Node::Loop:
+            {
+                LoopNode* loopNode = (LoopNode*)node;
+                return loopNode->repeats.lower == 0 ? 0 : RequiredLiteral(loopNode->body);
+            }
+        default:
+            // Alternatives, assertions and the rest don't need any one literal
+            return 0;
+        }
+    }
+
+    void Compiler::CaptureRequiredLiteral(Node* root, Node* syncNode)
+    {
+        // Looking for a literal the scan at the start of the program already looks for would only repeat its work
+        MatchLiteralNode* literalNode = RequiredLiteral(root);
+        if (literalNode == 0 || literalNode == syncNode)
+            return;
+
+        program->rep.insts.requiredLiteralOffset = literalNode->offset;
+        program->rep.insts.requiredLiteralLength = literalNode->length;
+    }
+
     void Compiler::EmitAndCaptureSuccInst(Recycler* recycler, Program* program)
     {
         program->rep.insts.insts = (uint8*)RecyclerNewLeaf(recycler, SuccInst);
@@ -4457,6 +4515,9 @@ namespace UnifiedRegex
         }
 #endif
 
+        RegexProfiler* const regexProfiler = scriptContext->GetThreadContext()->GetActiveRegexProfiler();
+        const RegexProfiler::Ticks compileStartTicks = regexProfiler != nullptr ? RegexProfiler::Now() : 0;
+
         Compiler compiler
             ( scriptContext
             , ctAllocator
@@ -4545,17 +4606,14 @@ namespace UnifiedRegex
                 {
                     program->tag = Program::InstructionsTag;
                     compiler.CaptureLiterals(root, litbuf);
+                    compiler.Annotate(root);
 
-                    root->AnnotatePass0(compiler);
-                    root->AnnotatePass1(compiler, true, true, true, true);
-                    // Nothing comes before or after overall pattern
-                    CountDomain consumes(0);
-                    // Match could progress from lhs (since we try successive start positions), but can never regress
-                    root->AnnotatePass2(compiler, consumes, false, true);
-                    // Anything could follow an end of pattern match
-                    CharSet<Char>* follow = standardChars->GetFullSet();
-                    root->AnnotatePass3(compiler, consumes, follow, true, false);
-                    root->AnnotatePass4(compiler);
+                    // Deterministic patterns never backtrack, so have no use for the linear matcher. Most patterns never
+                    // reach the backtrack limit either, so the linear program is only compiled once one does.
+                    if (!root->isDeterministic && !PHASE_OFF1(Js::RegexLinearPhase) && LinearCompiler::MayCompile(root))
+                    {
+                        program->rep.insts.linearProgramState = Program::LinearProgramNotCompiled;
+                    }
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
                     if (w != 0)
@@ -4583,6 +4641,7 @@ namespace UnifiedRegex
                         }
                         else
                         {
+                            Node* syncNode = 0;
                             Node* bestSyncronizingNode = 0;
                             root->BestSyncronizingNode(compiler, bestSyncronizingNode);
                             Node* headSyncronizingNode = root->HeadSyncronizingNode(compiler);
@@ -4592,12 +4651,14 @@ namespace UnifiedRegex
                             {
                                 // Scan and consume the head, continue with rest assuming head has been consumed
                                 skipped = headSyncronizingNode->EmitScan(compiler, true);
+                                syncNode = headSyncronizingNode;
                             }
                             else if (bestSyncronizingNode != 0)
                             {
                                 // Scan for the synchronizing node, then backup ready for entire pattern
                                 skipped = bestSyncronizingNode->EmitScan(compiler, false);
                                 Assert(skipped == 0);
+                                syncNode = bestSyncronizingNode;
 
                                 // We're synchronizing to a non-head node; if we have to back up, then try to synchronize to a character
                                 // in the first set before running the remaining instructions
@@ -4610,6 +4671,8 @@ namespace UnifiedRegex
                                 // then match all or remainder of pattern
                                 skipped = root->EmitScanFirstSet(compiler);
                             }
+
+                            compiler.CaptureRequiredLiteral(root, syncNode);
                         }
                     }
 
@@ -4630,6 +4693,11 @@ namespace UnifiedRegex
             }
         }
 
+        if (regexProfiler != nullptr)
+        {
+            regexProfiler->RecordCompile(program, RegexProfiler::Now() - compileStartTicks);
+        }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         if (w != 0)
         {
@@ -4639,4 +4707,80 @@ namespace UnifiedRegex
         }
 #endif
     }
+
+    LinearProgram* Compiler::CompileLinearProgram(Js::ScriptContext* scriptContext, const Program* program)
+    {
+        Assert(program->rep.insts.linearProgramState == Program::LinearProgramNotCompiled);
+
+        // The AST the program was compiled from is gone by now, so the source is parsed and annotated again. The literals
+        // go to a scratch program, which leaves the program itself alone.
+        char16 opts[6];
+        CharCount optsLen = 0;
+        if ((program->flags & GlobalRegexFlag) != 0)
+            opts[optsLen++] = _u('g');
+        if ((program->flags & IgnoreCaseRegexFlag) != 0)
+            opts[optsLen++] = _u('i');
+        if ((program->flags & MultilineRegexFlag) != 0)
+            opts[optsLen++] = _u('m');
+        if ((program->flags & UnicodeRegexFlag) != 0)
+            opts[optsLen++] = _u('u');
+        if ((program->flags & StickyRegexFlag) != 0)
+            opts[optsLen++] = _u('y');
+        opts[optsLen] = 0;
+
+        LinearProgram* linearProgram = nullptr;
+        BEGIN_TEMP_ALLOCATOR(ctAllocator, scriptContext, _u("RegexLinearCompiler"));
+        {
+            StandardChars<Char>* standardChars = scriptContext->GetThreadContext()->GetStandardChars((char16*)0);
+            Parser<NullTerminatedUnicodeEncodingPolicy, false> parser
+                ( scriptContext
+                , ctAllocator
+                , standardChars
+                , standardChars
+                , false
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                , 0
+#endif
+                );
+
+            Node* root = 0;
+            RegexFlags flags = NoRegexFlags;
+            try
+            {
+                root = parser.ParseDynamic(program->source, program->source + program->sourceLen, opts, opts + optsLen, flags);
+            }
+            catch (ParseError)
+            {
+                // The same source parsed when the program was compiled
+                Assert(false);
+            }
+
+            if (root != 0)
+            {
+                Assert(flags == program->flags);
+                Program* scratchProgram = Program::New(scriptContext->GetRecycler(), program->flags);
+                scratchProgram->source = program->source;
+                scratchProgram->sourceLen = program->sourceLen;
+                scratchProgram->numGroups = program->numGroups;
+
+                Compiler compiler
+                    ( scriptContext
+                    , ctAllocator
+                    , ctAllocator
+                    , standardChars
+                    , scratchProgram
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                    , 0
+                    , 0
+#endif
+                    );
+                compiler.CaptureLiterals(root, parser.GetLitbuf());
+                compiler.Annotate(root);
+                linearProgram = LinearCompiler::Compile(scriptContext, ctAllocator, scratchProgram, root);
+            }
+        }
+        END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
+
+        return linearProgram;
+    }
 }
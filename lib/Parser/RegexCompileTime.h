@@ -681,6 +681,9 @@ namespace UnifiedRegex
 
         static void CaptureNoLiterals(Program* program);
         void CaptureLiterals(Node* root, const Char *litbuf);
+        void Annotate(Node* root);
+        MatchLiteralNode* RequiredLiteral(Node* node);
+        void CaptureRequiredLiteral(Node* root, Node* syncNode);
         static void EmitAndCaptureSuccInst(Recycler* recycler, Program* program);
         void CaptureInsts();
         void FreeBody();
@@ -721,5 +724,9 @@ namespace UnifiedRegex
             , RegexStats* stats
 #endif
             );
+
+        // Compiles the linear program of an instructions program whose linear program hasn't been compiled yet, from its
+        // source. Returns null if the pattern can't be run in linear time.
+        static LinearProgram* CompileLinearProgram(Js::ScriptContext* scriptContext, const Program* program);
     };
 }
@@ -0,0 +1,579 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // LinearCompiler
+    // ----------------------------------------------------------------------
+
+    LinearCompiler::LinearCompiler(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Program* program)
+        : scriptContext(scriptContext)
+        , program(program)
+        , insts(ctAllocator)
+        , ranges(ctAllocator)
+        , isSupported(true)
+    {
+    }
+
+    bool LinearCompiler::MayCompile(Node* root)
+    {
+        return (root->features & (Node::HasMatchGroup | Node::HasAssertion)) == 0;
+    }
+
+    LinearProgram* LinearCompiler::Compile(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Program* program, Node* root)
+    {
+        if (!MayCompile(root))
+        {
+            return nullptr;
+        }
+
+        LinearCompiler compiler(scriptContext, ctAllocator, program);
+
+        // Group 0 is the overall match
+        compiler.Emit(LinearInst::Save)->slot = 0;
+        compiler.EmitNode(root);
+        compiler.Emit(LinearInst::Save)->slot = 1;
+        compiler.Emit(LinearInst::Succ);
+
+        const uint numInsts = (uint)compiler.insts.Count();
+        const uint numSlots = program->numGroups * 2;
+        if (!compiler.isSupported || numInsts > MaxInsts || numInsts * numSlots > MaxThreadSlots)
+        {
+            return nullptr;
+        }
+
+        Recycler* const recycler = scriptContext->GetRecycler();
+        LinearProgram* const linearProgram = RecyclerNew(recycler, LinearProgram);
+        linearProgram->insts = RecyclerNewArrayLeaf(recycler, LinearInst, numInsts);
+        js_memcpy_s(linearProgram->insts, numInsts * sizeof(LinearInst), compiler.insts.GetBuffer(), numInsts * sizeof(LinearInst));
+        linearProgram->numInsts = numInsts;
+        const uint numRangeChars = (uint)compiler.ranges.Count();
+        if (numRangeChars != 0)
+        {
+            linearProgram->ranges = RecyclerNewArrayLeaf(recycler, Char, numRangeChars);
+            js_memcpy_s(linearProgram->ranges, numRangeChars * sizeof(Char), compiler.ranges.GetBuffer(), numRangeChars * sizeof(Char));
+        }
+        linearProgram->numRanges = numRangeChars / 2;
+        linearProgram->numSlots = numSlots;
+        return linearProgram;
+    }
+
+    LinearInst* LinearCompiler::Emit(LinearInst::InstTag tag)
+    {
+        LinearInst inst;
+        memset(&inst, 0, sizeof(inst));
+        inst.tag = tag;
+        return &insts.Item(insts.Add(inst));
+    }
+
+    void LinearCompiler::EmitNode(Node* node)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackRegex);
+
+        if (!isSupported || (uint)insts.Count() > MaxInsts)
+        {
+            // Stop early, the program will be thrown away
+            isSupported = false;
+            return;
+        }
+
+        switch (node->tag)
+        {
+        case Node::Empty:
+            break;
+
+        case Node::BOL:
+            Emit((program->flags & MultilineRegexFlag) != 0 ? LinearInst::BOLTest : LinearInst::BOITest);
+            break;
+
+        case Node::EOL:
+            Emit((program->flags & MultilineRegexFlag) != 0 ? LinearInst::EOLTest : LinearInst::EOITest);
+            break;
+
+        case Node::WordBoundary:
+            Emit(((WordBoundaryNode*)node)->isNegation ? LinearInst::NotWordBoundaryTest : LinearInst::WordBoundaryTest);
+            break;
+
+        case Node::MatchLiteral:
+        {
+            const MatchLiteralNode* const literalNode = (MatchLiteralNode*)node;
+            const Char* literal = program->rep.insts.litbuf + literalNode->offset;
+            for (CharCount i = 0; i < literalNode->length; i++)
+            {
+                if (literalNode->isEquivClass)
+                {
+                    EmitMatchChars(literal + i * CaseInsensitive::EquivClassSize, true);
+                }
+                else
+                {
+                    EmitMatchChars(literal + i, false);
+                }
+            }
+            break;
+        }
+
+        case Node::MatchChar:
+        {
+            MatchCharNode* const charNode = (MatchCharNode*)node;
+            EmitMatchChars(charNode->cs, charNode->isEquivClass);
+            break;
+        }
+
+        case Node::MatchSet:
+            EmitMatchSet((MatchSetNode*)node);
+            break;
+
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                EmitNode(curr->head);
+            }
+            break;
+
+        case Node::Alt:
+        {
+            //
+            // Compilation scheme:
+            //
+            //           Split Ln
+            //           <item 0>
+            //           Jump Lexit
+            //     Ln:   Split Lm
+            //           <item 1>
+            //           Jump Lexit
+            //     Lm:   <last item>
+            //     Lexit:
+            //
+            JsUtil::List<uint, ArenaAllocator> exitFixups(insts.GetAllocator());
+            for (AltNode* curr = (AltNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                if (curr->tail == nullptr)
+                {
+                    EmitNode(curr->head);
+                    break;
+                }
+                const uint split = CurrentLabel();
+                Emit(LinearInst::Split);
+                EmitNode(curr->head);
+                exitFixups.Add(CurrentLabel());
+                Emit(LinearInst::Jump);
+                insts.Item(split).target = CurrentLabel();
+            }
+            for (int i = 0; i < exitFixups.Count(); i++)
+            {
+                insts.Item(exitFixups.Item(i)).target = CurrentLabel();
+            }
+            break;
+        }
+
+        case Node::DefineGroup:
+        {
+            DefineGroupNode* const groupNode = (DefineGroupNode*)node;
+            Emit(LinearInst::Save)->slot = groupNode->groupId * 2;
+            EmitNode(groupNode->body);
+            Emit(LinearInst::Save)->slot = groupNode->groupId * 2 + 1;
+            break;
+        }
+
+        case Node::Loop:
+            EmitLoop((LoopNode*)node);
+            break;
+
+        default:
+            // Back-references and assertions
+            isSupported = false;
+            break;
+        }
+    }
+
+    void LinearCompiler::EmitLoop(LoopNode* loop)
+    {
+        // The backtracking matcher fails an iteration beyond the minimum that matches empty, which a thread can't tell
+        // without remembering where its iteration began
+        if (loop->body->thisConsumes.CouldMatchEmpty())
+        {
+            isSupported = false;
+            return;
+        }
+
+        int minGroupId = program->numGroups;
+        int maxGroupId = -1;
+        loop->body->AccumDefineGroups(scriptContext, minGroupId, maxGroupId);
+
+        //
+        // Compilation scheme, for e{n,m} (with LazySplit instead of Split for a non-greedy loop):
+        //
+        //           <body>                n times
+        //     L:    Split Lexit           m - n times
+        //           <body>
+        //     ...
+        //     Lexit:
+        //
+        // and for e{n,}:
+        //
+        //           <body>                n times
+        //     L:    Split Lexit
+        //           <body>
+        //           Jump L
+        //     Lexit:
+        //
+        for (CharCount i = 0; i < loop->repeats.lower && isSupported; i++)
+        {
+            EmitLoopBody(loop, minGroupId, maxGroupId);
+        }
+
+        JsUtil::List<uint, ArenaAllocator> splits(insts.GetAllocator());
+        if (loop->repeats.IsUnbounded())
+        {
+            const uint begin = CurrentLabel();
+            splits.Add(begin);
+            Emit(LinearInst::Split);
+            EmitLoopBody(loop, minGroupId, maxGroupId);
+            Emit(LinearInst::Jump)->target = begin;
+        }
+        else
+        {
+            for (CharCount i = loop->repeats.lower; i < (CharCount)loop->repeats.upper && isSupported; i++)
+            {
+                splits.Add(CurrentLabel());
+                Emit(LinearInst::Split);
+                EmitLoopBody(loop, minGroupId, maxGroupId);
+            }
+        }
+
+        const uint exit = CurrentLabel();
+        for (int i = 0; i < splits.Count(); i++)
+        {
+            LinearInst& split = insts.Item(splits.Item(i));
+            split.target = exit;
+            if (!loop->isGreedy)
+            {
+                split.tag = LinearInst::LazySplit;
+            }
+        }
+    }
+
+    void LinearCompiler::EmitLoopBody(LoopNode* loop, int minGroupId, int maxGroupId)
+    {
+        if (minGroupId <= maxGroupId)
+        {
+            // Each iteration starts with the body's groups undefined
+            LinearInst* const reset = Emit(LinearInst::ResetGroups);
+            reset->minGroupId = minGroupId;
+            reset->maxGroupId = maxGroupId;
+        }
+        EmitNode(loop->body);
+    }
+
+    void LinearCompiler::EmitMatchChars(const Char* cs, bool isEquivClass)
+    {
+        LinearInst* const inst = Emit(LinearInst::MatchChar);
+        inst->cs[0] = cs[0];
+        inst->numChars = 1;
+        if (isEquivClass)
+        {
+            for (int i = 1; i < CaseInsensitive::EquivClassSize; i++)
+            {
+                inst->cs[inst->numChars++] = cs[i];
+            }
+        }
+    }
+
+    void LinearCompiler::EmitMatchSet(MatchSetNode* setNode)
+    {
+        const uint firstRange = (uint)ranges.Count() / 2;
+        uint nextLower = 0;
+        uint searchStart = 0;
+        Char lower, upper;
+        while (searchStart <= MaxUChar && setNode->set.GetNextRange(UTC(searchStart), &lower, &upper))
+        {
+            if (setNode->isNegation)
+            {
+                if (CTU(lower) > nextLower)
+                {
+                    ranges.Add(UTC(nextLower));
+                    ranges.Add(UTC(CTU(lower) - 1));
+                }
+            }
+            else
+            {
+                ranges.Add(lower);
+                ranges.Add(upper);
+            }
+            nextLower = CTU(upper) + 1;
+            searchStart = CTU(upper) + 1;
+        }
+        if (setNode->isNegation && nextLower <= MaxUChar)
+        {
+            ranges.Add(UTC(nextLower));
+            ranges.Add(UTC(MaxUChar));
+        }
+
+        LinearInst* const inst = Emit(LinearInst::MatchSet);
+        inst->firstRange = firstRange;
+        inst->numRanges = (uint)ranges.Count() / 2 - firstRange;
+    }
+
+    // ----------------------------------------------------------------------
+    // LinearMatcher
+    // ----------------------------------------------------------------------
+
+    LinearMatcher::LinearMatcher(Recycler* recycler, const LinearProgram* program, StandardChars<Char>* standardChars)
+        : program(program)
+        , standardChars(standardChars)
+    {
+        const uint numInsts = program->numInsts;
+        const uint numSlots = program->numSlots;
+        for (uint i = 0; i < _countof(lists); i++)
+        {
+            lists[i].labels = RecyclerNewArrayLeafZ(recycler, uint, numInsts);
+            lists[i].indexes = RecyclerNewArrayLeafZ(recycler, uint, numInsts);
+            lists[i].slots = RecyclerNewArrayLeafZ(recycler, CharCount, numInsts * numSlots);
+            lists[i].count = 0;
+        }
+
+        // Each instruction is followed at most once per AddThread, and backing out of it restores at most all the slots
+        pending = RecyclerNewArrayLeafZ(recycler, PendingEntry, numInsts * (numSlots + 1) + 1);
+        threadSlots = RecyclerNewArrayLeafZ(recycler, CharCount, numSlots);
+        matchSlots = RecyclerNewArrayLeafZ(recycler, CharCount, numSlots);
+    }
+
+    LinearMatcher* LinearMatcher::New(Recycler* recycler, const LinearProgram* program, StandardChars<Char>* standardChars)
+    {
+        return RecyclerNew(recycler, LinearMatcher, recycler, program, standardChars);
+    }
+
+    inline bool LinearMatcher::MatchesChar(const LinearInst& inst, const Char c) const
+    {
+        if (inst.tag == LinearInst::MatchChar)
+        {
+            for (int i = 0; i < inst.numChars; i++)
+            {
+                if (inst.cs[i] == c)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        Assert(inst.tag == LinearInst::MatchSet);
+        const Char* const ranges = program->ranges + inst.firstRange * 2;
+        uint lo = 0;
+        uint hi = inst.numRanges;
+        while (lo < hi)
+        {
+            const uint mid = lo + (hi - lo) / 2;
+            if (c < ranges[mid * 2])
+            {
+                hi = mid;
+            }
+            else if (c > ranges[mid * 2 + 1])
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void LinearMatcher::AddThread(ThreadList& list, uint label, const Char* const input, const CharCount inputLength, const CharCount inputOffset)
+    {
+        // Follow the empty transitions from label depth first, higher priority paths first, with the thread's slots in
+        // threadSlots. A thread is added for every instruction reached that consumes or succeeds, unless a thread of
+        // higher priority got there first.
+        const uint numSlots = program->numSlots;
+        uint numPending = 0;
+        pending[numPending].labelOrSlot = label;
+        pending[numPending].restoreValue = PendingInstruction;
+        numPending++;
+
+        while (numPending != 0)
+        {
+            const PendingEntry entry = pending[--numPending];
+            if (entry.restoreValue != PendingInstruction)
+            {
+                threadSlots[entry.labelOrSlot] = entry.restoreValue;
+                continue;
+            }
+
+            uint currLabel = entry.labelOrSlot;
+            while (!list.Contains(currLabel))
+            {
+                list.indexes[currLabel] = list.count;
+                list.labels[list.count++] = currLabel;
+
+                const LinearInst& inst = program->insts[currLabel];
+                bool follow;
+                switch (inst.tag)
+                {
+                case LinearInst::Jump:
+                    currLabel = inst.target;
+                    continue;
+
+                case LinearInst::Split:
+                    pending[numPending].labelOrSlot = inst.target;
+                    pending[numPending].restoreValue = PendingInstruction;
+                    numPending++;
+                    currLabel++;
+                    continue;
+
+                case LinearInst::LazySplit:
+                    pending[numPending].labelOrSlot = currLabel + 1;
+                    pending[numPending].restoreValue = PendingInstruction;
+                    numPending++;
+                    currLabel = inst.target;
+                    continue;
+
+                case LinearInst::Save:
+                    pending[numPending].labelOrSlot = inst.slot;
+                    pending[numPending].restoreValue = threadSlots[inst.slot];
+                    numPending++;
+                    threadSlots[inst.slot] = inputOffset;
+                    currLabel++;
+                    continue;
+
+                case LinearInst::ResetGroups:
+                    for (uint slot = inst.minGroupId * 2; slot <= (uint)inst.maxGroupId * 2 + 1; slot++)
+                    {
+                        if (threadSlots[slot] != CharCountFlag)
+                        {
+                            pending[numPending].labelOrSlot = slot;
+                            pending[numPending].restoreValue = threadSlots[slot];
+                            numPending++;
+                            threadSlots[slot] = CharCountFlag;
+                        }
+                    }
+                    currLabel++;
+                    continue;
+
+                case LinearInst::BOITest:
+                    follow = inputOffset == 0;
+                    break;
+
+                case LinearInst::EOITest:
+                    follow = inputOffset == inputLength;
+                    break;
+
+                case LinearInst::BOLTest:
+                    follow = inputOffset == 0 || standardChars->IsNewline(input[inputOffset - 1]);
+                    break;
+
+                case LinearInst::EOLTest:
+                    follow = inputOffset == inputLength || standardChars->IsNewline(input[inputOffset]);
+                    break;
+
+                case LinearInst::WordBoundaryTest:
+                case LinearInst::NotWordBoundaryTest:
+                {
+                    const bool prev = inputOffset > 0 && standardChars->IsWord(input[inputOffset - 1]);
+                    const bool curr = inputOffset < inputLength && standardChars->IsWord(input[inputOffset]);
+                    follow = (prev != curr) == (inst.tag == LinearInst::WordBoundaryTest);
+                    break;
+                }
+
+                default:
+                    // A thread waits here for the next character, or has matched
+                    js_memcpy_s(list.slots + currLabel * numSlots, numSlots * sizeof(CharCount), threadSlots, numSlots * sizeof(CharCount));
+                    follow = false;
+                    break;
+                }
+
+                if (!follow)
+                {
+                    break;
+                }
+                currLabel++;
+            }
+        }
+    }
+
+    bool LinearMatcher::Match(Matcher& matcher, const Char* const input, const CharCount inputLength, CharCount& matchStart, bool tryLaterOffsets, GroupInfo* groupInfos, uint& qcTicks)
+    {
+        const uint numSlots = program->numSlots;
+        ThreadList* currList = &lists[0];
+        ThreadList* nextList = &lists[1];
+        currList->count = 0;
+        bool isMatched = false;
+
+        for (CharCount inputOffset = matchStart; ; inputOffset++)
+        {
+            if (!isMatched && (inputOffset == matchStart || tryLaterOffsets))
+            {
+                // A thread starting here has lower priority than the ones that started earlier
+                for (uint i = 0; i < numSlots; i++)
+                {
+                    threadSlots[i] = CharCountFlag;
+                }
+                AddThread(*currList, 0, input, inputLength, inputOffset);
+            }
+
+            nextList->count = 0;
+            for (uint i = 0; i < currList->count; i++)
+            {
+                const uint label = currList->labels[i];
+                const LinearInst& inst = program->insts[label];
+                const CharCount* const slots = currList->slots + label * numSlots;
+                if (inst.tag == LinearInst::Succ)
+                {
+                    // Threads of lower priority can't change the match
+                    js_memcpy_s(matchSlots, numSlots * sizeof(CharCount), slots, numSlots * sizeof(CharCount));
+                    isMatched = true;
+                    break;
+                }
+                if ((inst.tag == LinearInst::MatchChar || inst.tag == LinearInst::MatchSet) &&
+                    inputOffset < inputLength &&
+                    MatchesChar(inst, input[inputOffset]))
+                {
+                    js_memcpy_s(threadSlots, numSlots * sizeof(CharCount), slots, numSlots * sizeof(CharCount));
+                    AddThread(*nextList, label + 1, input, inputLength, inputOffset + 1);
+                }
+            }
+
+            ThreadList* const list = currList;
+            currList = nextList;
+            nextList = list;
+
+            if (inputOffset >= inputLength || (currList->count == 0 && (isMatched || !tryLaterOffsets)))
+            {
+                break;
+            }
+
+            // As Matcher::QueryContinue, once per input character
+            if (!PHASE_OFF1(Js::RegexQcPhase) && (++qcTicks & Matcher::TicksPerQcTimeCheck - 1) == 0)
+            {
+                matcher.DoQueryContinue(qcTicks);
+            }
+        }
+
+        if (!isMatched)
+        {
+            groupInfos[0].Reset();
+            return false;
+        }
+
+        for (uint groupId = 0; groupId < numSlots / 2; groupId++)
+        {
+            const CharCount start = matchSlots[groupId * 2];
+            const CharCount end = matchSlots[groupId * 2 + 1];
+            if (start == CharCountFlag || end == CharCountFlag)
+            {
+                groupInfos[groupId].Reset();
+            }
+            else
+            {
+                groupInfos[groupId].offset = start;
+                groupInfos[groupId].length = end - start;
+            }
+        }
+        matchStart = matchSlots[0];
+        return true;
+    }
+}
@@ -0,0 +1,162 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // LinearProgram
+    // ----------------------------------------------------------------------
+
+    // A Thompson NFA for a pattern with no back-references and no lookarounds. LinearMatcher runs it by keeping every
+    // live thread in lock step over the input (a Pike VM), so a match takes time proportional to the input length
+    // times the program size, however much the backtracking matcher would have backtracked on the same pattern.
+    // Threads are kept in priority order, so the match and its groups are the ones the backtracking matcher finds.
+    struct LinearInst
+    {
+        enum InstTag : uint8
+        {
+            MatchChar,          // consume one of cs[0..numChars)
+            MatchSet,           // consume a character in one of the ranges [firstRange, firstRange + numRanges)
+            Split,              // continue with the next instruction, then, at lower priority, with target
+            LazySplit,          // continue with target, then, at lower priority, with the next instruction
+            Jump,               // continue with target
+            Save,               // record the input offset in slot
+            ResetGroups,        // undefine groups [minGroupId, maxGroupId], at the start of each iteration of a loop
+            BOITest,
+            EOITest,
+            BOLTest,
+            EOLTest,
+            WordBoundaryTest,
+            NotWordBoundaryTest,
+            Succ
+        };
+
+        InstTag tag;
+        uint8 numChars;
+        char16 cs[CaseInsensitive::EquivClassSize];
+        union
+        {
+            uint target;
+            uint slot;
+            uint firstRange;
+            int minGroupId;
+        };
+        union
+        {
+            uint numRanges;
+            int maxGroupId;
+        };
+    };
+
+    class LinearProgram
+    {
+        friend class LinearCompiler;
+        friend class LinearMatcher;
+
+    private:
+        // In recycler, never null
+        LinearInst* insts;
+        uint numInsts;
+        // Inclusive character ranges of the MatchSet instructions, as pairs of lower and upper bounds
+        char16* ranges;
+        uint numRanges;
+        // Two slots, start and end, per group
+        uint numSlots;
+
+        LinearProgram() : insts(nullptr), numInsts(0), ranges(nullptr), numRanges(0), numSlots(0) {}
+
+    public:
+        uint GetNumInsts() const { return numInsts; }
+    };
+
+    // ----------------------------------------------------------------------
+    // LinearCompiler
+    // ----------------------------------------------------------------------
+
+    class LinearCompiler : private Chars<char16>
+    {
+    public:
+        // Bounds on the size of a program, and so on the memory its matcher needs
+        static const uint MaxInsts = 4096;
+        static const uint MaxThreadSlots = 1 << 18;
+
+    private:
+        Js::ScriptContext* const scriptContext;
+        const Program* const program;
+        JsUtil::List<LinearInst, ArenaAllocator> insts;
+        JsUtil::List<Char, ArenaAllocator> ranges;
+        bool isSupported;
+
+        LinearCompiler(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Program* program);
+
+        uint CurrentLabel() const { return (uint)insts.Count(); }
+        LinearInst* Emit(LinearInst::InstTag tag);
+        void EmitNode(Node* node);
+        void EmitLoop(LoopNode* loop);
+        void EmitLoopBody(LoopNode* loop, int minGroupId, int maxGroupId);
+        void EmitMatchSet(MatchSetNode* setNode);
+        void EmitMatchChars(const Char* cs, bool isEquivClass);
+
+    public:
+        // Whether the features of a pattern allow it to run in linear time. Compile may still fail on its loops or size.
+        static bool MayCompile(Node* root);
+        // Returns null if the pattern can't be run in linear time or its program would be too large
+        static LinearProgram* Compile(Js::ScriptContext* scriptContext, ArenaAllocator* ctAllocator, const Program* program, Node* root);
+    };
+
+    // ----------------------------------------------------------------------
+    // LinearMatcher
+    // ----------------------------------------------------------------------
+
+    class LinearMatcher : private Chars<char16>
+    {
+    private:
+        // The threads at one input offset, in priority order, at most one per instruction
+        struct ThreadList
+        {
+            uint* labels;       // in priority order
+            uint* indexes;      // of each label in labels, if it is there
+            CharCount* slots;   // numSlots per instruction, for the instructions that have a thread
+            uint count;
+
+            inline bool Contains(uint label) const
+            {
+                const uint index = indexes[label];
+                return index < count && labels[index] == label;
+            }
+        };
+
+        // Entries of the stack AddThread works with: an instruction to follow, or a slot to restore when backing out of a
+        // path
+        struct PendingEntry
+        {
+            uint labelOrSlot;
+            CharCount restoreValue;     // PendingInstruction for an instruction
+        };
+
+        static const CharCount PendingInstruction = CharCountFlag - 1;
+
+        const LinearProgram* const program;
+        StandardChars<Char>* const standardChars;
+
+        ThreadList lists[2];
+        PendingEntry* pending;
+        CharCount* threadSlots;
+        CharCount* matchSlots;
+
+        LinearMatcher(Recycler* recycler, const LinearProgram* program, StandardChars<Char>* standardChars);
+
+        void AddThread(ThreadList& list, uint label, const Char* const input, const CharCount inputLength, const CharCount inputOffset);
+        inline bool MatchesChar(const LinearInst& inst, const Char c) const;
+
+    public:
+        static LinearMatcher* New(Recycler* recycler, const LinearProgram* program, StandardChars<Char>* standardChars);
+
+        // Looks for the first match starting at matchStart or, if tryLaterOffsets, after it. On success, sets matchStart
+        // and the groups.
+        bool Match(Matcher& matcher, const Char* const input, const CharCount inputLength, CharCount& matchStart, bool tryLaterOffsets, GroupInfo* groupInfos, uint& qcTicks);
+    };
+}
@@ -0,0 +1,1227 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+#if ENABLE_REGEX_NATIVE_CODE
+namespace UnifiedRegex
+{
+    // Register assignment, fixed for the whole function:
+    //   rcx   NativeMatchState*
+    //   r8    input
+    //   r9d   inputLength
+    //   r10d  input offset
+    //   r11   top of the backtrack stack
+    // eax, edx and xmm0-xmm3 are scratch. Only volatile registers are used and the stack pointer never moves, so the
+    // function is a leaf that needs neither a prologue nor unwind data.
+
+#define STATE_OFFSET(field) static_cast<BYTE>(offsetof(NativeMatchState, field))
+
+    CompileAssert(sizeof(GroupInfo) == 2 * sizeof(CharCount));
+
+    static inline uint32 GroupOffsetDisplacement(int groupId)
+    {
+        return (uint32)(groupId * sizeof(GroupInfo));
+    }
+
+    static inline uint32 GroupLengthDisplacement(int groupId)
+    {
+        return (uint32)(groupId * sizeof(GroupInfo) + sizeof(CharCount));
+    }
+
+    NativeCompiler::NativeCompiler(ArenaAllocator* allocator, const Program* program, StandardChars<char16>* standardChars)
+        : allocator(allocator)
+        , program(program)
+        , standardChars(standardChars)
+        , code(allocator)
+        , labelOffsets(allocator)
+        , fixups(allocator)
+        , stubs(allocator)
+        , bitmaps(allocator)
+        , instLabels(nullptr)
+        , resetGroupStubs(nullptr)
+        , failLabel(-1)
+        , noMatchLabel(-1)
+        , immediateFailLabel(-1)
+        , bailOutLabel(-1)
+        , successLabel(-1)
+        , wordBitmapLabel(-1)
+        , newlineBitmapLabel(-1)
+        , stubTableLabel(-1)
+        , numBacktrackEntries(0)
+        , isSupported(true)
+    {
+    }
+
+    size_t NativeCompiler::GetInstSize(Inst::InstTag tag)
+    {
+        switch (tag)
+        {
+#define MBase(TagName, ClassName) case Inst::TagName: return sizeof(ClassName);
+#define M(TagName) MBase(TagName, TagName##Inst)
+#define MTemplate(TagName, TemplateDeclaration, GenericClassName, SpecializedClassName) MBase(TagName, SpecializedClassName)
+#include "RegexOpCodes.h"
+#undef MBase
+#undef M
+#undef MTemplate
+        default:
+            Assert(false);
+            return 0;
+        }
+    }
+
+    bool NativeCompiler::Compile()
+    {
+        const uint8* const insts = program->rep.insts.insts;
+        const CharCount instsLen = program->rep.insts.instsLen;
+
+        instLabels = AnewArray(allocator, CodeLabel, instsLen);
+        for (CharCount i = 0; i < instsLen; i++)
+        {
+            instLabels[i] = -1;
+        }
+        resetGroupStubs = AnewArray(allocator, int, program->numGroups);
+        for (int i = 0; i < program->numGroups; i++)
+        {
+            resetGroupStubs[i] = -1;
+        }
+
+        // Every instruction gets a code label up front, since jumps go to later instructions
+        for (Label label = 0; label < instsLen; )
+        {
+            const size_t instSize = GetInstSize(((const Inst*)(insts + label))->tag);
+            if (instSize == 0)
+            {
+                return false;
+            }
+            instLabels[label] = NewLabel();
+            label += (Label)instSize;
+        }
+
+        failLabel = NewLabel();
+        noMatchLabel = NewLabel();
+        immediateFailLabel = NewLabel();
+        bailOutLabel = NewLabel();
+        successLabel = NewLabel();
+        stubTableLabel = NewLabel();
+        const CodeLabel badEntryLabel = NewLabel();
+
+#ifndef _WIN32
+        // The System V ABI passes the first argument in rdi
+        Emit(0x48, 0x89, 0xF9);                                     // mov rcx, rdi
+#endif
+        Emit(0x4C, 0x8B, 0x41, STATE_OFFSET(input));                // mov r8, [rcx + input]
+        Emit(0x4C, 0x8B, 0x59, STATE_OFFSET(backtrackStack));       // mov r11, [rcx + backtrackStack]
+        Emit(0x44, 0x8B, 0x49, STATE_OFFSET(inputLength));          // mov r9d, [rcx + inputLength]
+        Emit(0x44, 0x8B, 0x51, STATE_OFFSET(matchStart));           // mov r10d, [rcx + matchStart]
+
+        for (Label label = 0; label < instsLen; )
+        {
+            const Inst* const inst = (const Inst*)(insts + label);
+            const Label nextLabel = label + (Label)GetInstSize(inst->tag);
+            BindLabel(instLabels[label]);
+            if (!CompileInst(inst, label, nextLabel) || !isSupported)
+            {
+                return false;
+            }
+            label = nextLabel;
+        }
+
+        // Backtrack to the choice on top of the backtrack stack, or give up on this start offset if there is none
+        BindLabel(failLabel);
+        Emit(0x4C, 0x3B, 0x59, STATE_OFFSET(backtrackStack));       // cmp r11, [rcx + backtrackStack]
+        EmitJumpIf(ConditionE, noMatchLabel);
+        Emit(0x83, 0x69, STATE_OFFSET(backtrackBudget), 0x01);      // sub dword [rcx + backtrackBudget], 1
+        EmitJumpIf(ConditionB, bailOutLabel);
+        Emit(0x49, 0x83, 0xEB, (BYTE)BacktrackEntrySize);           // sub r11, BacktrackEntrySize
+        // The instructions, and so all the pushes, have been compiled, so the number of stubs is final
+        Emit(0x41, 0x8B, 0x03);                                     // mov eax, [r11]
+        EmitCompareEax((uint32)stubs.Count());
+        EmitJumpIf(ConditionAE, badEntryLabel);
+        Emit(0x48, 0x8D, 0x15);                                     // lea rdx, [rip + stubTable]
+        AddFixup(stubTableLabel);
+        Emit(0x48, 0x63, 0x04, 0x82);                               // movsxd rax, dword [rdx + rax * 4]
+        Emit(0x48, 0x01, 0xD0);                                     // add rax, rdx
+        Emit(0xFF, 0xE0);                                           // jmp rax
+
+        // Only a corrupted backtrack stack gets here
+        BindLabel(badEntryLabel);
+        Emit(0xCC);                                                 // int 3
+
+        BindLabel(noMatchLabel);
+        Emit(0x33, 0xC0);                                           // xor eax, eax
+        Emit(0xC3);                                                 // ret
+
+        // No later start offset can match either
+        BindLabel(immediateFailLabel);
+        Emit(0x44, 0x89, 0x49, STATE_OFFSET(matchStart));           // mov [rcx + matchStart], r9d
+        Emit(0x33, 0xC0);                                           // xor eax, eax
+        Emit(0xC3);                                                 // ret
+
+        BindLabel(bailOutLabel);
+        Emit(0xB8);                                                 // mov eax, NativeResultBailOut
+        Emit32(NativeResultBailOut);
+        Emit(0xC3);                                                 // ret
+
+        BindLabel(successLabel);
+        EmitLoadGroupInfos();
+        Emit(0x8B, 0x41, STATE_OFFSET(matchStart));                 // mov eax, [rcx + matchStart]
+        Emit(0x89, 0x02);                                           // mov [rdx], eax
+        Emit(0x44, 0x89, 0xD0);                                     // mov eax, r10d
+        Emit(0x2B, 0x41, STATE_OFFSET(matchStart));                 // sub eax, [rcx + matchStart]
+        Emit(0x89, 0x42, (BYTE)sizeof(CharCount));                  // mov [rdx + 4], eax
+        Emit(0xB8);                                                 // mov eax, NativeResultMatch
+        Emit32(NativeResultMatch);
+        Emit(0xC3);                                                 // ret
+
+        EmitStubs();
+        EmitData();
+        Resolve();
+        return isSupported;
+    }
+
+    bool NativeCompiler::CompileInst(const Inst* inst, Label label, Label nextLabel)
+    {
+        switch (inst->tag)
+        {
+        case Inst::Fail:
+            EmitJump(failLabel);
+            return true;
+
+        case Inst::Succ:
+            EmitJump(successLabel);
+            return true;
+
+        case Inst::Jump:
+            EmitJump(GetInstLabel(label, ((const JumpInst*)inst)->targetLabel));
+            return true;
+
+        case Inst::JumpIfNotChar:
+        case Inst::MatchCharOrJump:
+        {
+            // Both instructions have the same layout
+            const JumpIfNotCharInst* const jumpInst = (const JumpIfNotCharInst*)inst;
+            const CodeLabel target = GetInstLabel(label, jumpInst->targetLabel);
+            EmitJumpIfAtEnd(target);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&jumpInst->c, 1), false, target);
+            if (inst->tag == Inst::MatchCharOrJump)
+            {
+                EmitInputOffsetIncrement(1);
+            }
+            return true;
+        }
+
+        case Inst::JumpIfNotSet:
+        case Inst::MatchSetOrJump:
+        {
+            const JumpIfNotSetInst* const jumpInst = (const JumpIfNotSetInst*)inst;
+            const CodeLabel target = GetInstLabel(label, jumpInst->targetLabel);
+            EmitJumpIfAtEnd(target);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&jumpInst->set, false), false, target);
+            if (inst->tag == Inst::MatchSetOrJump)
+            {
+                EmitInputOffsetIncrement(1);
+            }
+            return true;
+        }
+
+        case Inst::Switch10:
+            EmitSwitch(*(const Switch10Inst*)inst, label, false);
+            return true;
+
+        case Inst::Switch20:
+            EmitSwitch(*(const Switch20Inst*)inst, label, false);
+            return true;
+
+        case Inst::SwitchAndConsume10:
+            EmitSwitch(*(const SwitchAndConsume10Inst*)inst, label, true);
+            return true;
+
+        case Inst::SwitchAndConsume20:
+            EmitSwitch(*(const SwitchAndConsume20Inst*)inst, label, true);
+            return true;
+
+        case Inst::BOITest:
+            Emit(0x45, 0x85, 0xD2);                                 // test r10d, r10d
+            EmitJumpIf(ConditionNE, ((const BOITestInst*)inst)->canHardFail ? immediateFailLabel : failLabel);
+            return true;
+
+        case Inst::EOITest:
+            Emit(0x45, 0x39, 0xCA);                                 // cmp r10d, r9d
+            EmitJumpIf(ConditionB, ((const EOITestInst*)inst)->canHardFail ? noMatchLabel : failLabel);
+            return true;
+
+        case Inst::BOLTest:
+        {
+            const CodeLabel atLineStart = NewLabel();
+            Emit(0x45, 0x85, 0xD2);                                 // test r10d, r10d
+            EmitJumpIf(ConditionE, atLineStart);
+            EmitLoadChar(-1);
+            EmitNewlineTest(atLineStart);
+            EmitJump(failLabel);
+            BindLabel(atLineStart);
+            return true;
+        }
+
+        case Inst::EOLTest:
+        {
+            const CodeLabel atLineEnd = NewLabel();
+            Emit(0x45, 0x39, 0xCA);                                 // cmp r10d, r9d
+            EmitJumpIf(ConditionAE, atLineEnd);
+            EmitLoadChar(0);
+            EmitNewlineTest(atLineEnd);
+            EmitJump(failLabel);
+            BindLabel(atLineEnd);
+            return true;
+        }
+
+        case Inst::WordBoundaryTest:
+        {
+            if (wordBitmapLabel == -1)
+            {
+                wordBitmapLabel = AddBitmap(nullptr, &StandardChars<char16>::IsWord);
+            }
+
+            // edx = previous character is a word character
+            const CodeLabel previousDone = NewLabel();
+            Emit(0x33, 0xD2);                                       // xor edx, edx
+            Emit(0x45, 0x85, 0xD2);                                 // test r10d, r10d
+            EmitJumpIf(ConditionE, previousDone);
+            EmitLoadChar(-1);
+            EmitCompareEax(CharSetNode::directSize);
+            EmitJumpIf(ConditionAE, previousDone);
+            Emit(0x0F, 0xA3, 0x05);                                 // bt [rip + wordBitmap], eax
+            AddFixup(wordBitmapLabel);
+            Emit(0x0F, 0x92, 0xC2);                                 // setc dl
+            BindLabel(previousDone);
+
+            // eax = current character is a word character
+            const CodeLabel currentNotWord = NewLabel();
+            const CodeLabel currentDone = NewLabel();
+            EmitJumpIfAtEnd(currentNotWord);
+            EmitLoadChar(0);
+            EmitCompareEax(CharSetNode::directSize);
+            EmitJumpIf(ConditionAE, currentNotWord);
+            Emit(0x0F, 0xA3, 0x05);                                 // bt [rip + wordBitmap], eax
+            AddFixup(wordBitmapLabel);
+            Emit(0x0F, 0x92, 0xC0);                                 // setc al
+            Emit(0x0F, 0xB6, 0xC0);                                 // movzx eax, al
+            EmitJump(currentDone);
+            BindLabel(currentNotWord);
+            Emit(0x33, 0xC0);                                       // xor eax, eax
+            BindLabel(currentDone);
+
+            Emit(0x39, 0xD0);                                       // cmp eax, edx
+            EmitJumpIf(((const WordBoundaryTestInst*)inst)->isNegation ? ConditionNE : ConditionE, failLabel);
+            return true;
+        }
+
+        case Inst::MatchChar:
+            EmitJumpIfAtEnd(failLabel);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&((const MatchCharInst*)inst)->c, 1), false, failLabel);
+            EmitInputOffsetIncrement(1);
+            return true;
+
+        case Inst::MatchChar2:
+            EmitJumpIfAtEnd(failLabel);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(((const MatchChar2Inst*)inst)->cs, 2), false, failLabel);
+            EmitInputOffsetIncrement(1);
+            return true;
+
+        case Inst::MatchChar3:
+            EmitJumpIfAtEnd(failLabel);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(((const MatchChar3Inst*)inst)->cs, 3), false, failLabel);
+            EmitInputOffsetIncrement(1);
+            return true;
+
+        case Inst::MatchChar4:
+            EmitJumpIfAtEnd(failLabel);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(((const MatchChar4Inst*)inst)->cs, 4), false, failLabel);
+            EmitInputOffsetIncrement(1);
+            return true;
+
+        case Inst::MatchSet:
+        case Inst::MatchNegatedSet:
+            EmitJumpIfAtEnd(failLabel);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&((const MatchSetInst<false>*)inst)->set, inst->tag == Inst::MatchNegatedSet), false, failLabel);
+            EmitInputOffsetIncrement(1);
+            return true;
+
+        case Inst::MatchLiteral:
+        {
+            const MatchLiteralInst* const literalInst = (const MatchLiteralInst*)inst;
+            if (literalInst->length == 0 || literalInst->length > MaxLiteralLength)
+            {
+                return false;
+            }
+            Emit(0x44, 0x89, 0xC8);                                 // mov eax, r9d
+            Emit(0x44, 0x29, 0xD0);                                 // sub eax, r10d
+            EmitCompareEax(literalInst->length);
+            EmitJumpIf(ConditionB, failLabel);
+            EmitLiteralCompare(program->rep.insts.litbuf + literalInst->offset, literalInst->length, 0, failLabel);
+            EmitInputOffsetIncrement(literalInst->length);
+            return true;
+        }
+
+        case Inst::OptMatchChar:
+        case Inst::OptMatchSet:
+        {
+            const CodeLabel skip = NewLabel();
+            EmitJumpIfAtEnd(skip);
+            EmitLoadChar(0);
+            if (inst->tag == Inst::OptMatchChar)
+            {
+                EmitCharTest(CharTest(&((const OptMatchCharInst*)inst)->c, 1), false, skip);
+            }
+            else
+            {
+                EmitCharTest(CharTest(&((const OptMatchSetInst*)inst)->set, false), false, skip);
+            }
+            EmitInputOffsetIncrement(1);
+            BindLabel(skip);
+            return true;
+        }
+
+        case Inst::SyncToCharAndContinue:
+        case Inst::SyncToChar2SetAndContinue:
+        case Inst::SyncToSetAndContinue:
+        case Inst::SyncToNegatedSetAndContinue:
+        {
+            // Whether or not the character is found, matching continues from there (or from the end of the input)
+            const CodeLabel synced = NewLabel();
+            switch (inst->tag)
+            {
+            case Inst::SyncToCharAndContinue:
+                EmitScanForChars(&((const SyncToCharAndContinueInst*)inst)->c, 1, synced, synced);
+                break;
+            case Inst::SyncToChar2SetAndContinue:
+                EmitScanForChars(((const SyncToChar2SetAndContinueInst*)inst)->cs, 2, synced, synced);
+                break;
+            default:
+                EmitScanForCharTest(
+                    CharTest(&((const SyncToSetAndContinueInst<false>*)inst)->set, inst->tag == Inst::SyncToNegatedSetAndContinue),
+                    synced,
+                    synced);
+                break;
+            }
+            BindLabel(synced);
+            EmitSetMatchStart();
+            return true;
+        }
+
+        case Inst::SyncToCharAndConsume:
+        case Inst::SyncToChar2SetAndConsume:
+        case Inst::SyncToSetAndConsume:
+        case Inst::SyncToNegatedSetAndConsume:
+        {
+            const CodeLabel found = NewLabel();
+            switch (inst->tag)
+            {
+            case Inst::SyncToCharAndConsume:
+                EmitScanForChars(&((const SyncToCharAndConsumeInst*)inst)->c, 1, found, immediateFailLabel);
+                break;
+            case Inst::SyncToChar2SetAndConsume:
+                EmitScanForChars(((const SyncToChar2SetAndConsumeInst*)inst)->cs, 2, found, immediateFailLabel);
+                break;
+            default:
+                EmitScanForCharTest(
+                    CharTest(&((const SyncToSetAndConsumeInst<false>*)inst)->set, inst->tag == Inst::SyncToNegatedSetAndConsume),
+                    found,
+                    immediateFailLabel);
+                break;
+            }
+            BindLabel(found);
+            EmitSetMatchStart();
+            EmitInputOffsetIncrement(1);
+            return true;
+        }
+
+        case Inst::SyncToChar2LiteralAndContinue:
+        case Inst::SyncToChar2LiteralAndConsume:
+        case Inst::SyncToLiteralAndContinue:
+        case Inst::SyncToLiteralAndConsume:
+        case Inst::SyncToLinearLiteralAndContinue:
+        case Inst::SyncToLinearLiteralAndConsume:
+        {
+            const Char* literal;
+            CharCount length;
+            bool consume;
+            switch (inst->tag)
+            {
+            case Inst::SyncToChar2LiteralAndContinue:
+            case Inst::SyncToChar2LiteralAndConsume:
+                // Both instructions have the same layout
+                literal = ((const SyncToChar2LiteralAndContinueInst*)inst)->cs;
+                length = 2;
+                consume = inst->tag == Inst::SyncToChar2LiteralAndConsume;
+                break;
+            case Inst::SyncToLiteralAndContinue:
+                GetLiteral(*(const SyncToLiteralAndContinueInst*)inst, &literal, &length);
+                consume = false;
+                break;
+            case Inst::SyncToLiteralAndConsume:
+                GetLiteral(*(const SyncToLiteralAndConsumeInst*)inst, &literal, &length);
+                consume = true;
+                break;
+            case Inst::SyncToLinearLiteralAndContinue:
+                GetLiteral(*(const SyncToLinearLiteralAndContinueInst*)inst, &literal, &length);
+                consume = false;
+                break;
+            default:
+                GetLiteral(*(const SyncToLinearLiteralAndConsumeInst*)inst, &literal, &length);
+                consume = true;
+                break;
+            }
+            if (length == 0 || length > MaxLiteralLength)
+            {
+                return false;
+            }
+
+            const CodeLabel found = NewLabel();
+            EmitScanForLiteral(literal, length, found, immediateFailLabel);
+            BindLabel(found);
+            EmitSetMatchStart();
+            if (consume)
+            {
+                EmitInputOffsetIncrement(length);
+            }
+            return true;
+        }
+
+        case Inst::BeginDefineGroup:
+            EmitLoadGroupInfos();
+            Emit(0x44, 0x89, 0x92);                                 // mov [rdx + group.offset], r10d
+            Emit32(GroupOffsetDisplacement(((const BeginDefineGroupInst*)inst)->groupId));
+            return true;
+
+        case Inst::EndDefineGroup:
+        {
+            const EndDefineGroupInst* const groupInst = (const EndDefineGroupInst*)inst;
+            if (!groupInst->noNeedToSave)
+            {
+                EmitPush(ResetGroupStub, failLabel, groupInst->groupId, false);
+            }
+            EmitLoadGroupInfos();
+            Emit(0x44, 0x89, 0xD0);                                 // mov eax, r10d
+            Emit(0x2B, 0x82);                                       // sub eax, [rdx + group.offset]
+            Emit32(GroupOffsetDisplacement(groupInst->groupId));
+            Emit(0x89, 0x82);                                       // mov [rdx + group.length], eax
+            Emit32(GroupLengthDisplacement(groupInst->groupId));
+            return true;
+        }
+
+        case Inst::DefineGroupFixed:
+        {
+            const DefineGroupFixedInst* const groupInst = (const DefineGroupFixedInst*)inst;
+            if (!groupInst->noNeedToSave)
+            {
+                EmitPush(ResetGroupStub, failLabel, groupInst->groupId, false);
+            }
+            EmitLoadGroupInfos();
+            Emit(0x44, 0x89, 0xD0);                                 // mov eax, r10d
+            Emit(0x2D);                                             // sub eax, length
+            Emit32(groupInst->length);
+            Emit(0x89, 0x82);                                       // mov [rdx + group.offset], eax
+            Emit32(GroupOffsetDisplacement(groupInst->groupId));
+            Emit(0xC7, 0x82);                                       // mov dword [rdx + group.length], length
+            Emit32(GroupLengthDisplacement(groupInst->groupId));
+            Emit32(groupInst->length);
+            return true;
+        }
+
+        case Inst::LoopSet:
+        {
+            const LoopSetInst* const loopInst = (const LoopSetInst*)inst;
+            if (loopInst->hasOuterLoops)
+            {
+                // An outer loop would have to save and restore this loop's state
+                return false;
+            }
+
+            EmitGreedyRun(CharTest(&loopInst->set, false), loopInst->repeats);
+
+            // Nothing to give back when the run is at the lower bound already, otherwise the follow is retried with one
+            // character fewer until it is
+            const CodeLabel follow = NewLabel();
+            Emit(0x44, 0x89, 0xD0);                                 // mov eax, r10d
+            Emit(0x41, 0x2B, 0x43, 0x0C);                           // sub eax, [r11 + 12]
+            EmitCompareEax(loopInst->repeats.lower);
+            EmitJumpIf(ConditionB, failLabel);
+            EmitJumpIf(ConditionE, follow);
+            Emit(0x45, 0x89, 0x53, 0x08);                           // mov [r11 + 8], r10d
+            if (loopInst->repeats.lower != 0)
+            {
+                Emit(0x41, 0x81, 0x43, 0x0C);                       // add dword [r11 + 12], lower
+                Emit32(loopInst->repeats.lower);
+            }
+            EmitPush(RewindLoopSetStub, follow, 0, false);
+            BindLabel(follow);
+            return true;
+        }
+
+        case Inst::ChompCharStar:
+        case Inst::ChompCharPlus:
+        {
+            const CountDomain repeats(inst->tag == Inst::ChompCharPlus ? 1 : 0, CharCountFlag);
+            EmitGreedyRun(CharTest(&((const ChompCharInst<ChompMode::Star>*)inst)->c, 1), repeats);
+            return true;
+        }
+
+        case Inst::ChompSetStar:
+        case Inst::ChompSetPlus:
+        {
+            const CountDomain repeats(inst->tag == Inst::ChompSetPlus ? 1 : 0, CharCountFlag);
+            EmitGreedyRun(CharTest(&((const ChompSetInst<ChompMode::Star>*)inst)->set, false), repeats);
+            return true;
+        }
+
+        case Inst::ChompCharBounded:
+        {
+            const ChompCharBoundedInst* const chompInst = (const ChompCharBoundedInst*)inst;
+            EmitGreedyRun(CharTest(&chompInst->c, 1), chompInst->repeats);
+            return true;
+        }
+
+        case Inst::ChompSetBounded:
+        {
+            const ChompSetBoundedInst* const chompInst = (const ChompSetBoundedInst*)inst;
+            EmitGreedyRun(CharTest(&chompInst->set, false), chompInst->repeats);
+            return true;
+        }
+
+        case Inst::Try:
+            EmitPush(ResumeStub, GetInstLabel(label, ((const TryInst*)inst)->failLabel), 0, true);
+            return true;
+
+        case Inst::TryIfChar:
+        case Inst::TryMatchChar:
+        {
+            // Both instructions have the same layout
+            const TryIfCharInst* const tryInst = (const TryIfCharInst*)inst;
+            const CodeLabel target = GetInstLabel(label, tryInst->failLabel);
+            EmitJumpIfAtEnd(target);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&tryInst->c, 1), false, target);
+            EmitPush(ResumeStub, target, 0, true);
+            if (inst->tag == Inst::TryMatchChar)
+            {
+                EmitInputOffsetIncrement(1);
+            }
+            return true;
+        }
+
+        case Inst::TryIfSet:
+        case Inst::TryMatchSet:
+        {
+            const TryIfSetInst* const tryInst = (const TryIfSetInst*)inst;
+            const CodeLabel target = GetInstLabel(label, tryInst->failLabel);
+            EmitJumpIfAtEnd(target);
+            EmitLoadChar(0);
+            EmitCharTest(CharTest(&tryInst->set, false), false, target);
+            EmitPush(ResumeStub, target, 0, true);
+            if (inst->tag == Inst::TryMatchSet)
+            {
+                EmitInputOffsetIncrement(1);
+            }
+            return true;
+        }
+
+        default:
+            // Loops with state, assertions, back-references, case-insensitive literals, tries and the SyncTo...AndBackup
+            // family stay interpreted
+            return false;
+        }
+    }
+
+    void NativeCompiler::GetLiteral(const LiteralMixin& literalInst, const Char** literal, CharCount* length) const
+    {
+        *literal = program->rep.insts.litbuf + literalInst.offset;
+        *length = literalInst.length;
+    }
+
+    template <int n>
+    void NativeCompiler::EmitSwitch(const SwitchMixin<n>& switchInst, Label label, bool consume)
+    {
+        EmitJumpIfAtEnd(failLabel);
+        EmitLoadChar(0);
+        for (int i = 0; i < switchInst.numCases; i++)
+        {
+            const SwitchCase& switchCase = switchInst.cases[i];
+            const CodeLabel target = GetInstLabel(label, switchCase.targetLabel);
+            EmitCompareEax(CTU(switchCase.c));
+            if (consume)
+            {
+                const CodeLabel nextCase = NewLabel();
+                EmitJumpIf(ConditionNE, nextCase);
+                EmitInputOffsetIncrement(1);
+                EmitJump(target);
+                BindLabel(nextCase);
+            }
+            else
+            {
+                EmitJumpIf(ConditionE, target);
+            }
+        }
+        // No case matched: continue with the next instruction
+    }
+
+    NativeCompiler::CodeLabel NativeCompiler::GetInstLabel(Label fromLabel, Label targetLabel)
+    {
+        // Only forward jumps to the start of an instruction are compiled; see the class comment for why
+        if (targetLabel <= fromLabel || targetLabel >= program->rep.insts.instsLen || instLabels[targetLabel] == -1)
+        {
+            isSupported = false;
+            return failLabel;
+        }
+        return instLabels[targetLabel];
+    }
+
+    NativeCompiler::CodeLabel NativeCompiler::NewLabel()
+    {
+        return labelOffsets.Add(-1);
+    }
+
+    void NativeCompiler::BindLabel(CodeLabel label)
+    {
+        Assert(labelOffsets.Item(label) == -1);
+        labelOffsets.Item(label, code.Count());
+    }
+
+    void NativeCompiler::AddFixup(CodeLabel label)
+    {
+        Fixup fixup;
+        fixup.codeOffset = code.Count();
+        fixup.label = label;
+        fixups.Add(fixup);
+        Emit32(0);
+    }
+
+    void NativeCompiler::Resolve()
+    {
+        for (int i = 0; i < fixups.Count(); i++)
+        {
+            const Fixup& fixup = fixups.Item(i);
+            const int targetOffset = labelOffsets.Item(fixup.label);
+            Assert(targetOffset != -1);
+
+            // All references are relative to the end of the 32-bit displacement, which ends the instruction
+            const uint32 displacement = (uint32)(targetOffset - (fixup.codeOffset + (int)sizeof(uint32)));
+            for (int b = 0; b < (int)sizeof(uint32); b++)
+            {
+                code.Item(fixup.codeOffset + b, (BYTE)(displacement >> (b * 8)));
+            }
+        }
+    }
+
+    void NativeCompiler::Emit(BYTE b0)
+    {
+        code.Add(b0);
+    }
+
+    void NativeCompiler::Emit(BYTE b0, BYTE b1)
+    {
+        code.Add(b0);
+        code.Add(b1);
+    }
+
+    void NativeCompiler::Emit(BYTE b0, BYTE b1, BYTE b2)
+    {
+        code.Add(b0);
+        code.Add(b1);
+        code.Add(b2);
+    }
+
+    void NativeCompiler::Emit(BYTE b0, BYTE b1, BYTE b2, BYTE b3)
+    {
+        code.Add(b0);
+        code.Add(b1);
+        code.Add(b2);
+        code.Add(b3);
+    }
+
+    void NativeCompiler::Emit16(uint16 value)
+    {
+        Emit((BYTE)value, (BYTE)(value >> 8));
+    }
+
+    void NativeCompiler::Emit32(uint32 value)
+    {
+        Emit((BYTE)value, (BYTE)(value >> 8), (BYTE)(value >> 16), (BYTE)(value >> 24));
+    }
+
+    void NativeCompiler::EmitJump(CodeLabel target)
+    {
+        Emit(0xE9);                                                 // jmp rel32
+        AddFixup(target);
+    }
+
+    void NativeCompiler::EmitJumpIf(Condition condition, CodeLabel target)
+    {
+        Emit(0x0F, (BYTE)(0x80 | condition));                       // jcc rel32
+        AddFixup(target);
+    }
+
+    void NativeCompiler::EmitJumpIfAtEnd(CodeLabel target)
+    {
+        Emit(0x45, 0x39, 0xCA);                                     // cmp r10d, r9d
+        EmitJumpIf(ConditionAE, target);
+    }
+
+    void NativeCompiler::EmitLoadChar(int charDisplacement)
+    {
+        if (charDisplacement == 0)
+        {
+            Emit(0x43, 0x0F, 0xB7, 0x04);                           // movzx eax, word [r8 + r10 * 2]
+            Emit(0x50);
+        }
+        else
+        {
+            Assert(charDisplacement >= -64 && charDisplacement < 64);
+            Emit(0x43, 0x0F, 0xB7, 0x44);                           // movzx eax, word [r8 + r10 * 2 + disp8]
+            Emit(0x50, (BYTE)(charDisplacement * (int)sizeof(Char)));
+        }
+    }
+
+    void NativeCompiler::EmitCompareEax(uint32 value)
+    {
+        Emit(0x3D);                                                 // cmp eax, imm32
+        Emit32(value);
+    }
+
+    void NativeCompiler::EmitInputOffsetIncrement(CharCount count)
+    {
+        if (count == 1)
+        {
+            Emit(0x41, 0xFF, 0xC2);                                 // inc r10d
+        }
+        else
+        {
+            Emit(0x41, 0x81, 0xC2);                                 // add r10d, imm32
+            Emit32(count);
+        }
+    }
+
+    void NativeCompiler::EmitSetMatchStart()
+    {
+        Emit(0x44, 0x89, 0x51, STATE_OFFSET(matchStart));           // mov [rcx + matchStart], r10d
+    }
+
+    void NativeCompiler::EmitLoadGroupInfos()
+    {
+        Emit(0x48, 0x8B, 0x51, STATE_OFFSET(groupInfos));           // mov rdx, [rcx + groupInfos]
+    }
+
+    void NativeCompiler::EmitCharTest(const CharTest& test, bool jumpIfMatch, CodeLabel target)
+    {
+        if (test.set != nullptr)
+        {
+            EmitSetTest(*test.set, jumpIfMatch != test.isNegation, target);
+            return;
+        }
+
+        Assert(test.numChars >= 1);
+        if (jumpIfMatch)
+        {
+            for (int i = 0; i < test.numChars; i++)
+            {
+                EmitCompareEax(CTU(test.chars[i]));
+                EmitJumpIf(ConditionE, target);
+            }
+            return;
+        }
+
+        const CodeLabel matched = NewLabel();
+        for (int i = 0; i < test.numChars - 1; i++)
+        {
+            EmitCompareEax(CTU(test.chars[i]));
+            EmitJumpIf(ConditionE, matched);
+        }
+        EmitCompareEax(CTU(test.chars[test.numChars - 1]));
+        EmitJumpIf(ConditionNE, target);
+        BindLabel(matched);
+    }
+
+    void NativeCompiler::EmitSetTest(const RuntimeCharSet<char16>& set, bool jumpIfMember, CodeLabel target)
+    {
+        // Characters below CharSetNode::directSize are looked up in a bitmap, the few ranges above it are compared one by one
+        Char lowers[MaxHighRanges];
+        Char uppers[MaxHighRanges];
+        int numHighRanges = 0;
+        uint searchStart = CharSetNode::directSize;
+        Char lower, upper;
+        while (searchStart <= MaxUChar && set.GetNextHighRange(UTC(searchStart), &lower, &upper))
+        {
+            if (numHighRanges == MaxHighRanges)
+            {
+                isSupported = false;
+                return;
+            }
+            lowers[numHighRanges] = lower;
+            uppers[numHighRanges] = upper;
+            numHighRanges++;
+            searchStart = CTU(upper) + 1;
+        }
+
+        const CodeLabel bitmap = AddBitmap(&set, nullptr);
+        const CodeLabel done = NewLabel();
+        const CodeLabel member = jumpIfMember ? target : done;
+        const CodeLabel nonMember = jumpIfMember ? done : target;
+        const CodeLabel high = numHighRanges == 0 ? nonMember : NewLabel();
+
+        EmitCompareEax(CharSetNode::directSize);
+        EmitJumpIf(ConditionAE, high);
+        Emit(0x0F, 0xA3, 0x05);                                     // bt [rip + bitmap], eax
+        AddFixup(bitmap);
+        EmitJumpIf(jumpIfMember ? ConditionB : ConditionAE, target); // jc / jnc
+        if (numHighRanges != 0)
+        {
+            EmitJump(done);
+            BindLabel(high);
+            for (int i = 0; i < numHighRanges; i++)
+            {
+                Emit(0x8D, 0x90);                                   // lea edx, [rax - lower]
+                Emit32((uint32)-(int32)CTU(lowers[i]));
+                Emit(0x81, 0xFA);                                   // cmp edx, upper - lower
+                Emit32(CTU(uppers[i]) - CTU(lowers[i]));
+                EmitJumpIf(ConditionBE, member);
+            }
+            if (nonMember != done)
+            {
+                EmitJump(nonMember);
+            }
+        }
+        BindLabel(done);
+    }
+
+    void NativeCompiler::EmitNewlineTest(CodeLabel newlineTarget)
+    {
+        if (newlineBitmapLabel == -1)
+        {
+            newlineBitmapLabel = AddBitmap(nullptr, &StandardChars<char16>::IsNewline);
+        }
+
+        const CodeLabel high = NewLabel();
+        const CodeLabel done = NewLabel();
+        EmitCompareEax(CharSetNode::directSize);
+        EmitJumpIf(ConditionAE, high);
+        Emit(0x0F, 0xA3, 0x05);                                     // bt [rip + newlineBitmap], eax
+        AddFixup(newlineBitmapLabel);
+        EmitJumpIf(ConditionB, newlineTarget);                      // jc
+        EmitJump(done);
+
+        // The only newlines above the bitmap are U+2028 and U+2029
+        BindLabel(high);
+        Emit(0x89, 0xC2);                                           // mov edx, eax
+        Emit(0x83, 0xCA, 0x01);                                     // or edx, 1
+        Emit(0x81, 0xFA);                                           // cmp edx, 0x2029
+        Emit32(0x2029);
+        EmitJumpIf(ConditionE, newlineTarget);
+        BindLabel(done);
+    }
+
+    NativeCompiler::CodeLabel NativeCompiler::AddBitmap(const RuntimeCharSet<char16>* set, bool (StandardChars<char16>::*classifier)(char16) const)
+    {
+        Bitmap bitmap;
+        bitmap.label = NewLabel();
+        for (uint i = 0; i < _countof(bitmap.bits); i++)
+        {
+            bitmap.bits[i] = 0;
+        }
+        for (uint c = 0; c < CharSetNode::directSize; c++)
+        {
+            if (set != nullptr ? set->Get(UTC(c)) : (standardChars->*classifier)(UTC(c)))
+            {
+                bitmap.bits[c / 32] |= 1u << (c % 32);
+            }
+        }
+        bitmaps.Add(bitmap);
+        return bitmap.label;
+    }
+
+    void NativeCompiler::EmitLiteralCompare(const Char* literal, CharCount length, int firstIndex, CodeLabel mismatchTarget)
+    {
+        for (CharCount i = firstIndex; i < length; i++)
+        {
+            const uint32 displacement = i * sizeof(Char);
+            if (displacement < 0x80)
+            {
+                Emit(0x66, 0x43, 0x81, 0x7C);                       // cmp word [r8 + r10 * 2 + disp8], imm16
+                Emit(0x50, (BYTE)displacement);
+            }
+            else
+            {
+                Emit(0x66, 0x43, 0x81, 0xBC);                       // cmp word [r8 + r10 * 2 + disp32], imm16
+                Emit(0x50);
+                Emit32(displacement);
+            }
+            Emit16(CTU(literal[i]));
+            EmitJumpIf(ConditionNE, mismatchTarget);
+        }
+    }
+
+    void NativeCompiler::EmitScanForChars(const Char* chars, int numChars, CodeLabel foundTarget, CodeLabel notFoundTarget)
+    {
+        // Compare 8 characters at a time with SSE2, which every x64 processor has, then finish one by one. The input
+        // offset is left at the first occurrence, or at the end of the input if there is none.
+        Assert(numChars == 1 || numChars == 2);
+
+        Emit(0xB8);                                                 // mov eax, c0 in both halves
+        Emit32(CTU(chars[0]) * 0x10001);
+        Emit(0x66, 0x0F, 0x6E, 0xC8);                               // movd xmm1, eax
+        Emit(0x66, 0x0F, 0x70, 0xC9);                               // pshufd xmm1, xmm1, 0
+        Emit(0x00);
+        if (numChars == 2)
+        {
+            Emit(0xB8);                                             // mov eax, c1 in both halves
+            Emit32(CTU(chars[1]) * 0x10001);
+            Emit(0x66, 0x0F, 0x6E, 0xD0);                           // movd xmm2, eax
+            Emit(0x66, 0x0F, 0x70, 0xD2);                           // pshufd xmm2, xmm2, 0
+            Emit(0x00);
+        }
+
+        const CodeLabel blockLoop = NewLabel();
+        const CodeLabel blockHit = NewLabel();
+        const CodeLabel tailLoop = NewLabel();
+        const uint32 charsPerBlock = 16 / sizeof(Char);
+
+        BindLabel(blockLoop);
+        Emit(0x44, 0x89, 0xC8);                                     // mov eax, r9d
+        Emit(0x44, 0x29, 0xD0);                                     // sub eax, r10d
+        EmitCompareEax(charsPerBlock);
+        EmitJumpIf(ConditionB, tailLoop);
+        Emit(0xF3, 0x43, 0x0F, 0x6F);                               // movdqu xmm0, [r8 + r10 * 2]
+        Emit(0x04, 0x50);
+        if (numChars == 2)
+        {
+            Emit(0x66, 0x0F, 0x6F, 0xD8);                           // movdqa xmm3, xmm0
+            Emit(0x66, 0x0F, 0x75, 0xDA);                           // pcmpeqw xmm3, xmm2
+        }
+        Emit(0x66, 0x0F, 0x75, 0xC1);                               // pcmpeqw xmm0, xmm1
+        if (numChars == 2)
+        {
+            Emit(0x66, 0x0F, 0xEB, 0xC3);                           // por xmm0, xmm3
+        }
+        Emit(0x66, 0x0F, 0xD7, 0xC0);                               // pmovmskb eax, xmm0
+        Emit(0x85, 0xC0);                                           // test eax, eax
+        EmitJumpIf(ConditionNE, blockHit);
+        Emit(0x41, 0x83, 0xC2, (BYTE)charsPerBlock);                // add r10d, 8
+        EmitJump(blockLoop);
+
+        // The mask has two bits per character
+        BindLabel(blockHit);
+        Emit(0x0F, 0xBC, 0xC0);                                     // bsf eax, eax
+        Emit(0xD1, 0xE8);                                           // shr eax, 1
+        Emit(0x41, 0x01, 0xC2);                                     // add r10d, eax
+        EmitJump(foundTarget);
+
+        BindLabel(tailLoop);
+        EmitJumpIfAtEnd(notFoundTarget);
+        EmitLoadChar(0);
+        EmitCharTest(CharTest(chars, numChars), true, foundTarget);
+        EmitInputOffsetIncrement(1);
+        EmitJump(tailLoop);
+    }
+
+    void NativeCompiler::EmitScanForCharTest(const CharTest& test, CodeLabel foundTarget, CodeLabel notFoundTarget)
+    {
+        const CodeLabel loop = NewLabel();
+        BindLabel(loop);
+        EmitJumpIfAtEnd(notFoundTarget);
+        EmitLoadChar(0);
+        EmitCharTest(test, true, foundTarget);
+        EmitInputOffsetIncrement(1);
+        EmitJump(loop);
+    }
+
+    void NativeCompiler::EmitScanForLiteral(const Char* literal, CharCount length, CodeLabel foundTarget, CodeLabel notFoundTarget)
+    {
+        // Scan for the first character, then compare the rest in place. The input offset is left at the occurrence if
+        // there is one, and is undefined otherwise.
+        const CodeLabel scan = NewLabel();
+        const CodeLabel candidate = NewLabel();
+        const CodeLabel mismatch = NewLabel();
+
+        BindLabel(scan);
+        EmitScanForChars(literal, 1, candidate, notFoundTarget);
+        BindLabel(candidate);
+        Emit(0x44, 0x89, 0xC8);                                     // mov eax, r9d
+        Emit(0x44, 0x29, 0xD0);                                     // sub eax, r10d
+        EmitCompareEax(length);
+        EmitJumpIf(ConditionB, notFoundTarget);
+        EmitLiteralCompare(literal, length, 1, mismatch);
+        EmitJump(foundTarget);
+        BindLabel(mismatch);
+        EmitInputOffsetIncrement(1);
+        EmitJump(scan);
+    }
+
+    void NativeCompiler::EmitGreedyRun(const CharTest& test, const CountDomain& repeats)
+    {
+        // The top entry of the backtrack stack is free to use as scratch: the run starts at [r11 + 12] and, if bounded,
+        // may not go past [r11 + 8]
+        Emit(0x45, 0x89, 0x53, 0x0C);                               // mov [r11 + 12], r10d
+
+        const bool isBounded = !repeats.IsUnbounded();
+        if (isBounded)
+        {
+            const CodeLabel useInputLength = NewLabel();
+            const CodeLabel store = NewLabel();
+            Emit(0x44, 0x89, 0xC8);                                 // mov eax, r9d
+            Emit(0x44, 0x29, 0xD0);                                 // sub eax, r10d
+            EmitCompareEax(repeats.upper);
+            EmitJumpIf(ConditionBE, useInputLength);
+            Emit(0x44, 0x89, 0xD0);                                 // mov eax, r10d
+            Emit(0x05);                                             // add eax, upper
+            Emit32(repeats.upper);
+            EmitJump(store);
+            BindLabel(useInputLength);
+            Emit(0x44, 0x89, 0xC8);                                 // mov eax, r9d
+            BindLabel(store);
+            Emit(0x41, 0x89, 0x43, 0x08);                           // mov [r11 + 8], eax
+        }
+
+        const CodeLabel loop = NewLabel();
+        const CodeLabel done = NewLabel();
+        BindLabel(loop);
+        if (isBounded)
+        {
+            Emit(0x45, 0x3B, 0x53, 0x08);                           // cmp r10d, [r11 + 8]
+        }
+        else
+        {
+            Emit(0x45, 0x39, 0xCA);                                 // cmp r10d, r9d
+        }
+        EmitJumpIf(ConditionAE, done);
+        EmitLoadChar(0);
+        EmitCharTest(test, false, done);
+        EmitInputOffsetIncrement(1);
+        EmitJump(loop);
+        BindLabel(done);
+
+        if (repeats.lower != 0)
+        {
+            Emit(0x44, 0x89, 0xD0);                                 // mov eax, r10d
+            Emit(0x41, 0x2B, 0x43, 0x0C);                           // sub eax, [r11 + 12]
+            EmitCompareEax(repeats.lower);
+            EmitJumpIf(ConditionB, failLabel);
+        }
+    }
+
+    void NativeCompiler::EmitPush(StubKind kind, CodeLabel target, int groupId, bool saveInputOffset)
+    {
+        int stubIndex = -1;
+        if (kind == ResetGroupStub)
+        {
+            // One stub per group serves every instruction that defines it
+            stubIndex = resetGroupStubs[groupId];
+        }
+        if (stubIndex == -1)
+        {
+            Stub stub;
+            stub.kind = kind;
+            stub.entry = NewLabel();
+            stub.target = target;
+            stub.groupId = groupId;
+            stubIndex = stubs.Add(stub);
+            if (kind == ResetGroupStub)
+            {
+                resetGroupStubs[groupId] = stubIndex;
+            }
+        }
+
+        // Each instruction pushes at most one entry, and holds at most one entry on the stack at a time
+        numBacktrackEntries++;
+
+        Emit(0x41, 0xC7, 0x03);                                     // mov dword [r11], stubIndex
+        Emit32((uint32)stubIndex);
+        if (saveInputOffset)
+        {
+            Emit(0x45, 0x89, 0x53, 0x08);                           // mov [r11 + 8], r10d
+        }
+        Emit(0x49, 0x83, 0xC3, (BYTE)BacktrackEntrySize);           // add r11, BacktrackEntrySize
+    }
+
+    void NativeCompiler::EmitStubs()
+    {
+        // A stub is entered from the fail code with r11 pointing at its (already popped) entry
+        for (int i = 0; i < stubs.Count(); i++)
+        {
+            const Stub& stub = stubs.Item(i);
+            BindLabel(stub.entry);
+            switch (stub.kind)
+            {
+            case ResumeStub:
+                Emit(0x45, 0x8B, 0x53, 0x08);                       // mov r10d, [r11 + 8]
+                EmitJump(stub.target);
+                break;
+
+            case ResetGroupStub:
+                EmitLoadGroupInfos();
+                Emit(0xC7, 0x82);                                   // mov dword [rdx + group.length], CharCountFlag
+                Emit32(GroupLengthDisplacement(stub.groupId));
+                Emit32(CharCountFlag);
+                EmitJump(failLabel);
+                break;
+
+            case RewindLoopSetStub:
+            {
+                // [r11 + 8] is the end of the run and [r11 + 12] the shortest end the loop accepts. The entry stays on the
+                // stack until the run is down to that.
+                const CodeLabel popped = NewLabel();
+                Emit(0x41, 0x8B, 0x43, 0x08);                       // mov eax, [r11 + 8]
+                Emit(0xFF, 0xC8);                                   // dec eax
+                Emit(0x41, 0x89, 0xC2);                             // mov r10d, eax
+                Emit(0x41, 0x3B, 0x43, 0x0C);                       // cmp eax, [r11 + 12]
+                EmitJumpIf(ConditionE, popped);
+                Emit(0x41, 0x89, 0x43, 0x08);                       // mov [r11 + 8], eax
+                Emit(0x49, 0x83, 0xC3, (BYTE)BacktrackEntrySize);   // add r11, BacktrackEntrySize
+                BindLabel(popped);
+                EmitJump(stub.target);
+                break;
+            }
+
+            default:
+                Assert(false);
+                break;
+            }
+        }
+    }
+
+    void NativeCompiler::EmitData()
+    {
+        while (code.Count() % 16 != 0)
+        {
+            Emit(0xCC);                                             // int 3
+        }
+        for (int i = 0; i < bitmaps.Count(); i++)
+        {
+            const Bitmap& bitmap = bitmaps.Item(i);
+            BindLabel(bitmap.label);
+            for (uint j = 0; j < _countof(bitmap.bits); j++)
+            {
+                Emit32(bitmap.bits[j]);
+            }
+        }
+
+        // Offset of each stub from the start of the table, by stub index. The stubs are all bound by now.
+        BindLabel(stubTableLabel);
+        const int stubTableOffset = code.Count();
+        for (int i = 0; i < stubs.Count(); i++)
+        {
+            const int stubOffset = labelOffsets.Item(stubs.Item(i).entry);
+            Assert(stubOffset != -1);
+            Emit32((uint32)(stubOffset - stubTableOffset));
+        }
+    }
+
+#undef STATE_OFFSET
+}
+#endif
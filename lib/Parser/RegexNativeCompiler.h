@@ -0,0 +1,201 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_REGEX_NATIVE_CODE
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // NativeMatchState
+    // ----------------------------------------------------------------------
+
+    // Passed to the native code of a program for one attempt to match at one start offset
+    struct NativeMatchState
+    {
+        const char16* input;
+        GroupInfo* groupInfos;
+        // Backtrack entries are 16 bytes: the index of the stub that undoes the choice, padding, then two 32-bit operands
+        uint8* backtrackStack;
+        CharCount inputLength;
+        // In: offset to match at. Out: where the SyncTo instructions moved the start of the match, or inputLength if no
+        // later start offset can match.
+        CharCount matchStart;
+        // Number of backtracks left before the code gives up and returns NativeResultBailOut
+        uint backtrackBudget;
+    };
+
+    enum NativeMatchResult : int
+    {
+        NativeResultNoMatch = 0,
+        NativeResultMatch = 1,
+        // The backtrack budget ran out, the interpreter must redo this start offset
+        NativeResultBailOut = 2
+    };
+
+    // ----------------------------------------------------------------------
+    // NativeCompiler
+    // ----------------------------------------------------------------------
+
+    // Translates the instructions of a program into x64 code that behaves as Matcher::MatchHere does for one start
+    // offset. Programs are compiled whole or not at all: any instruction without a translation, or a jump backwards,
+    // leaves the program to the interpreter.
+    //
+    // Since all jumps go forwards, an instruction is executed at most once between two backtracks, so the backtrack
+    // stack never holds more entries than there are instructions that push one. Its size is fixed at compile time and
+    // the code never checks for overflow.
+    //
+    // The backtrack stack is writable data, so it holds stub indices rather than code addresses. The fail code checks the
+    // index against the number of stubs and jumps through a table of offsets that is part of the read-only code.
+    class NativeCompiler : private Chars<char16>
+    {
+    public:
+        // Backtracks allowed per start offset. Past this the interpreter takes over, since it checks in with the host
+        // while backtracking and the native code doesn't.
+        static const uint BacktrackBudget = 0x10000;
+        static const uint BacktrackEntrySize = 16;
+
+    private:
+        typedef int CodeLabel;
+
+        // Condition codes of the jcc instructions used
+        enum Condition : uint8
+        {
+            ConditionB = 0x2,
+            ConditionAE = 0x3,
+            ConditionE = 0x4,
+            ConditionNE = 0x5,
+            ConditionBE = 0x6,
+        };
+
+        // A test of the character in eax
+        struct CharTest
+        {
+            const char16* chars; // compared one by one, if set is null
+            int numChars;
+            const RuntimeCharSet<char16>* set;
+            bool isNegation;
+
+            CharTest(const char16* chars, int numChars) : chars(chars), numChars(numChars), set(nullptr), isNegation(false) {}
+            CharTest(const RuntimeCharSet<char16>* set, bool isNegation) : chars(nullptr), numChars(0), set(set), isNegation(isNegation) {}
+        };
+
+        struct Fixup
+        {
+            int codeOffset;     // of a rel32 that ends the instruction
+            CodeLabel label;
+        };
+
+        enum StubKind
+        {
+            ResumeStub,         // restore the input offset and continue at target
+            ResetGroupStub,     // undefine group groupId and keep backtracking
+            RewindLoopSetStub   // give back one character of a LoopSet and continue at target
+        };
+
+        struct Stub
+        {
+            StubKind kind;
+            CodeLabel entry;
+            CodeLabel target;
+            int groupId;
+        };
+
+        struct Bitmap
+        {
+            CodeLabel label;
+            uint32 bits[256 / 32];
+        };
+
+        // High ranges tested one by one after the bitmap for the first 256 characters of a set
+        static const int MaxHighRanges = 8;
+        // Longest literal compared inline
+        static const CharCount MaxLiteralLength = 256;
+
+        ArenaAllocator* const allocator;
+        const Program* const program;
+        StandardChars<char16>* const standardChars;
+
+        JsUtil::List<BYTE, ArenaAllocator> code;
+        JsUtil::List<int, ArenaAllocator> labelOffsets;
+        JsUtil::List<Fixup, ArenaAllocator> fixups;
+        JsUtil::List<Stub, ArenaAllocator> stubs;
+        JsUtil::List<Bitmap, ArenaAllocator> bitmaps;
+
+        // Code label of each instruction, indexed by instruction label (-1 between instructions)
+        CodeLabel* instLabels;
+        // Index in stubs of the stub that undefines each group, or -1
+        int* resetGroupStubs;
+
+        CodeLabel failLabel;
+        CodeLabel noMatchLabel;
+        CodeLabel immediateFailLabel;
+        CodeLabel bailOutLabel;
+        CodeLabel successLabel;
+        CodeLabel wordBitmapLabel;
+        CodeLabel newlineBitmapLabel;
+        CodeLabel stubTableLabel;
+
+        uint numBacktrackEntries;
+        bool isSupported;
+
+    public:
+        NativeCompiler(ArenaAllocator* allocator, const Program* program, StandardChars<char16>* standardChars);
+
+        // Returns false if the program has to stay interpreted
+        bool Compile();
+
+        const BYTE* GetCode() const { return code.GetBuffer(); }
+        size_t GetCodeSize() const { return code.Count(); }
+
+        // Size in bytes of the backtrack stack the code needs
+        size_t GetBacktrackStackSize() const { return (numBacktrackEntries + 1) * BacktrackEntrySize; }
+
+    private:
+        static size_t GetInstSize(Inst::InstTag tag);
+
+        bool CompileInst(const Inst* inst, Label label, Label nextLabel);
+        CodeLabel GetInstLabel(Label fromLabel, Label targetLabel);
+        void GetLiteral(const LiteralMixin& literalInst, const char16** literal, CharCount* length) const;
+        template <int n>
+        void EmitSwitch(const SwitchMixin<n>& switchInst, Label label, bool consume);
+
+        CodeLabel NewLabel();
+        void BindLabel(CodeLabel label);
+        void AddFixup(CodeLabel label);
+        void Resolve();
+
+        void Emit(BYTE b0);
+        void Emit(BYTE b0, BYTE b1);
+        void Emit(BYTE b0, BYTE b1, BYTE b2);
+        void Emit(BYTE b0, BYTE b1, BYTE b2, BYTE b3);
+        void Emit16(uint16 value);
+        void Emit32(uint32 value);
+
+        void EmitJump(CodeLabel target);
+        void EmitJumpIf(Condition condition, CodeLabel target);
+        void EmitJumpIfAtEnd(CodeLabel target);
+        void EmitLoadChar(int displacement);
+        void EmitCompareEax(uint32 value);
+        void EmitInputOffsetIncrement(CharCount count);
+        void EmitSetMatchStart();
+        void EmitLoadGroupInfos();
+
+        void EmitCharTest(const CharTest& test, bool jumpIfMatch, CodeLabel target);
+        void EmitSetTest(const RuntimeCharSet<char16>& set, bool jumpIfMember, CodeLabel target);
+        void EmitNewlineTest(CodeLabel newlineTarget);
+        CodeLabel AddBitmap(const RuntimeCharSet<char16>* set, bool (StandardChars<char16>::*classifier)(char16) const);
+
+        void EmitLiteralCompare(const char16* literal, CharCount length, int firstIndex, CodeLabel mismatchTarget);
+        void EmitScanForChars(const char16* chars, int numChars, CodeLabel foundTarget, CodeLabel notFoundTarget);
+        void EmitScanForCharTest(const CharTest& test, CodeLabel foundTarget, CodeLabel notFoundTarget);
+        void EmitScanForLiteral(const char16* literal, CharCount length, CodeLabel foundTarget, CodeLabel notFoundTarget);
+        void EmitGreedyRun(const CharTest& test, const CountDomain& repeats);
+        void EmitPush(StubKind kind, CodeLabel target, int groupId, bool saveInputOffset);
+
+        void EmitStubs();
+        void EmitData();
+    };
+}
+#endif
@@ -2899,6 +2899,20 @@ namespace UnifiedRegex
             return nullptr;
         }
 
+        // The same literal may have been compiled already, here or in another script context of this thread
+        ThreadContext* threadContext = this->scriptContext->GetThreadContext();
+        Program* sharedProgram = threadContext->GetSharedRegexProgram(RegexKey(program->source, program->sourceLen, flags));
+        if (sharedProgram != nullptr)
+        {
+#ifdef PROFILE_EXEC
+            this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+            RegexPattern* sharedPattern = RegexPattern::New(this->scriptContext, sharedProgram, true);
+            sharedPattern->hasSharedProgram = true;
+            return sharedPattern;
+        }
+        ArenaAllocator* sharedAllocator = threadContext->GetSharedRegexProgramAllocator();
+
         RegexPattern* pattern = RegexPattern::New(this->scriptContext, program, true);
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -2919,7 +2933,7 @@ namespace UnifiedRegex
             this->scriptContext->GetRegexStatsDatabase()->BeginProfile();
 #endif
 
-        ArenaAllocator* rtAllocator = this->scriptContext->RegexAllocator();
+        ArenaAllocator* rtAllocator = sharedAllocator != nullptr ? sharedAllocator : this->scriptContext->RegexAllocator();
         Compiler::Compile
             ( this->scriptContext
               , ctAllocator
@@ -2940,6 +2954,12 @@ namespace UnifiedRegex
             this->scriptContext->GetRegexStatsDatabase()->EndProfile(stats, RegexStats::Compile);
 #endif
 
+        if (sharedAllocator != nullptr && program->IsShareable())
+        {
+            threadContext->AddSharedRegexProgram(RegexKey(program->source, program->sourceLen, flags), program);
+            pattern->hasSharedProgram = true;
+        }
+
 #ifdef PROFILE_EXEC
         this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
 #endif
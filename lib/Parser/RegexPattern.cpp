@@ -7,11 +7,14 @@
 namespace UnifiedRegex
 {
     RegexPattern::RegexPattern(Js::JavascriptLibrary *const library, Program* program, bool isLiteral)
-        : library(library), isLiteral(isLiteral), isShallowClone(false)
+        : library(library), isLiteral(isLiteral), isShallowClone(false), hasSharedProgram(false)
     {
         rep.unified.program = program;
         rep.unified.matcher = 0;
         rep.unified.trigramInfo = 0;
+#if ENABLE_REGEX_NATIVE_CODE
+        rep.unified.nativeCode = nullptr;
+#endif
     }
 
     RegexPattern *RegexPattern::New(Js::ScriptContext *scriptContext, Program* program, bool isLiteral)
@@ -50,6 +53,17 @@ namespace UnifiedRegex
         if(isShallowClone)
             return;
 
+#if ENABLE_REGEX_NATIVE_CODE
+        if(rep.unified.nativeCode != nullptr)
+        {
+            scriptContext->FreeRegexNativeCode(rep.unified.nativeCode);
+            rep.unified.nativeCode = nullptr;
+        }
+#endif
+
+        if(hasSharedProgram)
+            return;
+
         rep.unified.program->FreeBody(scriptContext->RegexAllocator());
     }
 
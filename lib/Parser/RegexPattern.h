@@ -23,12 +23,18 @@ namespace UnifiedRegex
             Program* program;
             Matcher* matcher;
             TrigramInfo* trigramInfo;
+#if ENABLE_REGEX_NATIVE_CODE
+            // Native code the matcher compiled for the program once it became hot, owned by this pattern
+            void* nativeCode;
+#endif
         };
 
         Js::JavascriptLibrary *const library;
 
         bool isLiteral : 1;
         bool isShallowClone : 1;
+        // The program is shared by the script contexts of the thread, which owns its body
+        bool hasSharedProgram : 1;
 
         union Rep
         {
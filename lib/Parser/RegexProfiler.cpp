@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+namespace UnifiedRegex
+{
+    RegexProfileEntry::RegexProfileEntry(const char16* source, CharCount sourceLen, RegexFlags flags)
+        : source(source)
+        , sourceLen(sourceLen)
+        , flags(flags)
+        , compileCount(0)
+        , compileTicks(0)
+        , executionCount(0)
+        , sampledExecutionCount(0)
+        , sampledMatchTicks(0)
+        , sampledBacktrackCount(0)
+        , peakContStackSize(0)
+    {
+    }
+
+    RegexProfiler::RegexProfiler(PageAllocator* pageAllocator, uint id, uint sampleInterval)
+        : allocator(_u("RegexProfiler"), pageAllocator, Js::Throw::OutOfMemory)
+        , entries(&allocator)
+        , id(id)
+        , sampleInterval(sampleInterval)
+        , matchesUntilSample(sampleInterval)
+        , isCollecting(true)
+        , ticksPerMillisecond(1)
+    {
+        Assert(id != 0);
+        Assert(sampleInterval != 0);
+
+        LARGE_INTEGER frequency;
+        if (QueryPerformanceFrequency(&frequency) && frequency.QuadPart >= 1000)
+        {
+            ticksPerMillisecond = frequency.QuadPart / 1000;
+        }
+    }
+
+    RegexProfiler::Ticks RegexProfiler::Now()
+    {
+        LARGE_INTEGER now;
+        return QueryPerformanceCounter(&now) ? now.QuadPart : 0;
+    }
+
+    RegexProfileEntry* RegexProfiler::GetEntry(const Program* program)
+    {
+        RegexProfileEntry* entry = nullptr;
+        if (entries.TryGetValue(RegexKey(program->source, program->sourceLen, program->flags), &entry))
+        {
+            return entry;
+        }
+        if ((uint)entries.Count() >= MaxEntries)
+        {
+            return nullptr;
+        }
+
+        // Programs may be freed while the profile is kept, so the entry has its own copy of the source
+        char16* source = AnewArray(&allocator, char16, program->sourceLen + 1);
+        js_wmemcpy_s(source, program->sourceLen + 1, program->source, program->sourceLen + 1);
+        entry = Anew(&allocator, RegexProfileEntry, source, program->sourceLen, program->flags);
+        entries.Add(RegexKey(source, program->sourceLen, program->flags), entry);
+        return entry;
+    }
+
+    RegexProfileEntry* RegexProfiler::GetEntry(Matcher* matcher)
+    {
+        // The matcher remembers its entry, so that a match needs no lookup
+        if (matcher->profilerId != id)
+        {
+            matcher->profileEntry = GetEntry(matcher->program);
+            matcher->profilerId = id;
+        }
+        return matcher->profileEntry;
+    }
+
+    void RegexProfiler::RecordCompile(const Program* program, Ticks ticks)
+    {
+        Assert(isCollecting);
+
+        RegexProfileEntry* entry = GetEntry(program);
+        if (entry != nullptr)
+        {
+            entry->compileCount++;
+            entry->compileTicks += ticks;
+        }
+    }
+
+    bool RegexProfiler::BeginMatch(Matcher* matcher, Ticks& startTicks)
+    {
+        Assert(isCollecting);
+        Assert(!matcher->isSampled);
+
+        RegexProfileEntry* entry = GetEntry(matcher);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        entry->executionCount++;
+        if (--matchesUntilSample != 0)
+        {
+            return false;
+        }
+        matchesUntilSample = sampleInterval;
+
+        matcher->isSampled = true;
+        matcher->sampledBacktrackCount = 0;
+        matcher->sampledContStackSize = 0;
+        startTicks = Now();
+        return true;
+    }
+
+    void RegexProfiler::EndMatch(Matcher* matcher, Ticks startTicks)
+    {
+        const Ticks ticks = Now() - startTicks;
+        Assert(matcher->isSampled);
+        matcher->isSampled = false;
+
+        // The profiler may have been restarted while the match ran, in which case the match isn't this profiler's
+        if (!isCollecting || matcher->profilerId != id)
+        {
+            return;
+        }
+
+        RegexProfileEntry* entry = matcher->profileEntry;
+        Assert(entry != nullptr);
+        entry->sampledExecutionCount++;
+        entry->sampledMatchTicks += ticks;
+        entry->sampledBacktrackCount += matcher->sampledBacktrackCount;
+        if (matcher->sampledContStackSize > entry->peakContStackSize)
+        {
+            entry->peakContStackSize = matcher->sampledContStackSize;
+        }
+    }
+
+    AutoClearSampledMatch::~AutoClearSampledMatch()
+    {
+        matcher->isSampled = false;
+    }
+}
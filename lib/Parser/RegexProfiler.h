@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace UnifiedRegex
+{
+    class Matcher;
+
+    // ----------------------------------------------------------------------
+    // RegexProfileEntry
+    // ----------------------------------------------------------------------
+
+    // What the regex profiler knows about the regexes with one source and set of flags
+    struct RegexProfileEntry
+    {
+        typedef uint64 Ticks;
+
+        // Copy of the source, null terminated, in the profiler's allocator
+        const char16* source;
+        CharCount sourceLen;
+        RegexFlags flags;
+
+        uint compileCount;
+        Ticks compileTicks;
+        // Every match is counted, the sampled ones are also timed and have their backtracking measured
+        uint64 executionCount;
+        uint64 sampledExecutionCount;
+        Ticks sampledMatchTicks;
+        uint64 sampledBacktrackCount;
+        // Continuation stack high-water mark over the sampled matches, in bytes
+        size_t peakContStackSize;
+
+        RegexProfileEntry(const char16* source, CharCount sourceLen, RegexFlags flags);
+    };
+
+    // ----------------------------------------------------------------------
+    // RegexProfiler
+    // ----------------------------------------------------------------------
+
+    // Per-pattern statistics a host collects for a thread context, in any build. While the profiler collects, each match
+    // costs a counter increment, and one match in every sampleInterval is timed and run by the interpreter, which counts
+    // backtracks and measures the continuation stack. Unlike RegexStats, this needs no config options and prints nothing.
+    class RegexProfiler
+    {
+    public:
+        typedef RegexProfileEntry::Ticks Ticks;
+
+        // Bound on the number of patterns profiled, so that scripts that make many distinct regexes can't make the
+        // profile grow without limit. Patterns seen after that are not profiled.
+        static const uint MaxEntries = 4096;
+
+    private:
+        typedef JsUtil::BaseDictionary<RegexKey, RegexProfileEntry*, ArenaAllocator, PowerOf2SizePolicy> EntryMap;
+
+        ArenaAllocator allocator;
+        EntryMap entries;
+        // Tells this profiler's entries cached by matchers from those of earlier profilers
+        const uint id;
+        const uint sampleInterval;
+        uint matchesUntilSample;
+        bool isCollecting;
+        Ticks ticksPerMillisecond;
+
+        RegexProfileEntry* GetEntry(const Program* program);
+        RegexProfileEntry* GetEntry(Matcher* matcher);
+
+    public:
+        RegexProfiler(PageAllocator* pageAllocator, uint id, uint sampleInterval);
+
+        static Ticks Now();
+
+        inline bool IsCollecting() const { return isCollecting; }
+        inline void StopCollecting() { isCollecting = false; }
+
+        void RecordCompile(const Program* program, Ticks ticks);
+
+        // Counts a match about to be run by matcher. Returns true if the match is sampled, in which case EndMatch must be
+        // called after it with the start ticks.
+        bool BeginMatch(Matcher* matcher, Ticks& startTicks);
+        void EndMatch(Matcher* matcher, Ticks startTicks);
+
+        inline double TicksToMilliseconds(Ticks ticks) const
+        {
+            return (double)ticks / (double)ticksPerMillisecond;
+        }
+
+        // Calls fn with each entry, in the order the patterns were first seen
+        template <typename Fn>
+        void Map(Fn fn) const
+        {
+            entries.Map([&](const RegexKey& key, RegexProfileEntry* const entry)
+            {
+                fn(*entry);
+            });
+        }
+    };
+
+    // Clears the sampled state of a matcher when a sampled match doesn't reach EndMatch because it threw, so that the
+    // matcher's later matches aren't counted as sampled
+    class AutoClearSampledMatch
+    {
+    private:
+        Matcher* const matcher;
+
+    public:
+        AutoClearSampledMatch(Matcher* matcher) : matcher(matcher) {}
+        ~AutoClearSampledMatch();
+    };
+}
@@ -596,6 +596,7 @@ namespace UnifiedRegex
     ScannerInfo* ScannersMixin::Add(Recycler *recycler, Program *program, CharCount offset, CharCount length, bool isEquivClass)
     {
         Assert(numLiterals < MaxNumSyncLiterals);
+        hasOnlyExactLiterals = hasOnlyExactLiterals && !isEquivClass;
         return program->AddScannerForSyncToLiterals(recycler, numLiterals++, offset, length, isEquivClass);
     }
 
@@ -644,6 +645,109 @@ namespace UnifiedRegex
     }
 #endif
 
+    // ----------------------------------------------------------------------
+    // ScanRangesMixin
+    // ----------------------------------------------------------------------
+
+    void ScanRangesMixin::SetupRanges(const RuntimeCharSet<char16>& set, bool isNegation)
+    {
+        // The scan stops at characters in the set, or at those not in it for a negated set
+        const uint maxUChar = Chars<char16>::MaxUChar;
+        uint count = 0;
+        auto addRange = [&](uint lower, uint upper) -> bool
+        {
+            if (count != 0 && (uint)ranges[count * 2 - 1] + 1 == lower)
+            {
+                ranges[count * 2 - 1] = (char16)upper;
+                return true;
+            }
+            if (count == Js::StringUtilities::MaxRanges)
+            {
+                return false;
+            }
+            ranges[count * 2] = (char16)lower;
+            ranges[count * 2 + 1] = (char16)upper;
+            count++;
+            return true;
+        };
+
+        numRanges = 0;
+        uint rangeStart = 0;
+        bool inRange = false;
+        for (uint c = 0; c < CharSetNode::directSize; c++)
+        {
+            const bool stopsAt = set.Get((char16)c) != isNegation;
+            if (stopsAt && !inRange)
+            {
+                rangeStart = c;
+            }
+            else if (!stopsAt && inRange && !addRange(rangeStart, c - 1))
+            {
+                return;
+            }
+            inRange = stopsAt;
+        }
+        if (inRange && !addRange(rangeStart, CharSetNode::directSize - 1))
+        {
+            return;
+        }
+
+        uint nextUnset = CharSetNode::directSize;
+        char16 lower, upper;
+        for (uint searchStart = CharSetNode::directSize;
+            searchStart <= maxUChar && set.GetNextHighRange((char16)searchStart, &lower, &upper);
+            searchStart = (uint)upper + 1)
+        {
+            if (isNegation)
+            {
+                if ((uint)lower > nextUnset && !addRange(nextUnset, (uint)lower - 1))
+                {
+                    return;
+                }
+                nextUnset = (uint)upper + 1;
+            }
+            else if (!addRange(lower, upper))
+            {
+                return;
+            }
+        }
+        if (isNegation && nextUnset <= maxUChar && !addRange(nextUnset, maxUChar))
+        {
+            return;
+        }
+
+        numRanges = (uint8)count;
+    }
+
+#if !ENABLE_REGEX_CONFIG_OPTIONS
+    // Offset of the first character at or after inputOffset that a SyncToSet instruction stops at, or inputLength if
+    // there is none. Sets with few ranges are scanned with the vectorized string kernels.
+    template<bool IsNegation>
+    static inline CharCount NextOffsetInSet
+        ( const RuntimeCharSet<char16>& set
+        , const ScanRangesMixin& scanRanges
+        , const char16* const input
+        , const CharCount inputLength
+        , CharCount inputOffset )
+    {
+        if (scanRanges.numRanges == 0)
+        {
+            while (inputOffset < inputLength && set.Get(input[inputOffset]) == IsNegation)
+            {
+                inputOffset++;
+            }
+            return inputOffset;
+        }
+
+        if (inputOffset >= inputLength)
+        {
+            return inputOffset;
+        }
+        int index = Js::StringUtilities::IndexOfCharInRanges(input + inputOffset, inputLength - inputOffset, scanRanges.ranges, scanRanges.numRanges);
+        return index == -1 ? inputLength : inputOffset + index;
+    }
+#endif
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     void HardFailMixin::Print(DebugWriter* w, const char16* litbuf) const
     {
@@ -1646,6 +1750,30 @@ namespace UnifiedRegex
     }
 #endif
 
+#if !ENABLE_REGEX_CONFIG_OPTIONS
+    // Offset of the first occurrence of c at or after inputOffset, or inputLength if there is none.
+    // These scan with the vectorized string kernels; with regex stats enabled every comparison is counted instead.
+    static inline CharCount NextOffsetOfChar(const Char* const input, const CharCount inputLength, const CharCount inputOffset, const Char c)
+    {
+        if (inputOffset >= inputLength)
+        {
+            return inputOffset;
+        }
+        int index = Js::StringUtilities::IndexOfChar(input + inputOffset, inputLength - inputOffset, c);
+        return index == -1 ? inputLength : inputOffset + index;
+    }
+
+    static inline CharCount NextOffsetOfEitherChar(const Char* const input, const CharCount inputLength, const CharCount inputOffset, const Char c0, const Char c1)
+    {
+        if (inputOffset >= inputLength)
+        {
+            return inputOffset;
+        }
+        int index = Js::StringUtilities::IndexOfEitherChar(input + inputOffset, inputLength - inputOffset, c0, c1);
+        return index == -1 ? inputLength : inputOffset + index;
+    }
+#endif
+
     // ----------------------------------------------------------------------
     // SyncToCharAndContinueInst (optimized instruction)
     // ----------------------------------------------------------------------
@@ -1655,14 +1783,14 @@ namespace UnifiedRegex
         const Char matchC = c;
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
-#endif
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetOfChar(input, inputLength, inputOffset, matchC);
+#endif
 
         matchStart = inputOffset;
         instPointer += sizeof(*this);
@@ -1689,14 +1817,14 @@ namespace UnifiedRegex
         const Char matchC1 = cs[1];
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
-#endif
         while (inputOffset < inputLength && input[inputOffset] != matchC0 && input[inputOffset] != matchC1)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetOfEitherChar(input, inputLength, inputOffset, matchC0, matchC1);
+#endif
 
         matchStart = inputOffset;
         instPointer += sizeof(*this);
@@ -1721,18 +1849,17 @@ namespace UnifiedRegex
     template<bool IsNegation>
     inline bool SyncToSetAndContinueInst<IsNegation>::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const RuntimeCharSet<Char>& matchSet = this->set;
 #if ENABLE_REGEX_CONFIG_OPTIONS
+        const RuntimeCharSet<Char>& matchSet = this->set;
         matcher.CompStats();
-#endif
-
         while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetInSet<IsNegation>(this->set, *this, input, inputLength, inputOffset);
+#endif
 
         matchStart = inputOffset;
         instPointer += sizeof(*this);
@@ -1792,14 +1919,14 @@ namespace UnifiedRegex
         const Char matchC = c;
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
-#endif
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetOfChar(input, inputLength, inputOffset, matchC);
+#endif
 
         if (inputOffset >= inputLength)
             return matcher.HardFail(HARDFAIL_PARAMETERS(ImmediateFail));
@@ -1829,14 +1956,14 @@ namespace UnifiedRegex
         const Char matchC1 = cs[1];
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
-#endif
         while (inputOffset < inputLength && (input[inputOffset] != matchC0 && input[inputOffset] != matchC1))
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetOfEitherChar(input, inputLength, inputOffset, matchC0, matchC1);
+#endif
 
         if (inputOffset >= inputLength)
             return matcher.HardFail(HARDFAIL_PARAMETERS(ImmediateFail));
@@ -1863,17 +1990,17 @@ namespace UnifiedRegex
     template<bool IsNegation>
     inline bool SyncToSetAndConsumeInst<IsNegation>::Exec(REGEX_INST_EXEC_PARAMETERS) const
     {
-        const RuntimeCharSet<Char>& matchSet = this->set;
 #if ENABLE_REGEX_CONFIG_OPTIONS
+        const RuntimeCharSet<Char>& matchSet = this->set;
         matcher.CompStats();
-#endif
         while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetInSet<IsNegation>(this->set, *this, input, inputLength, inputOffset);
+#endif
 
         if (inputOffset >= inputLength)
             return matcher.HardFail(HARDFAIL_PARAMETERS(ImmediateFail));
@@ -1951,13 +2078,15 @@ namespace UnifiedRegex
             inputOffset = matchStart + backup.lower;
 
         const Char matchC = c;
+#if ENABLE_REGEX_CONFIG_OPTIONS
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetOfChar(input, inputLength, inputOffset, matchC);
+#endif
 
         if (inputOffset >= inputLength)
             return matcher.HardFail(HARDFAIL_PARAMETERS(ImmediateFail));
@@ -2013,14 +2142,16 @@ namespace UnifiedRegex
             // No use looking for match until minimum backup is possible
             inputOffset = matchStart + backup.lower;
 
+#if ENABLE_REGEX_CONFIG_OPTIONS
         const RuntimeCharSet<Char>& matchSet = this->set;
         while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
         {
-#if ENABLE_REGEX_CONFIG_OPTIONS
             matcher.CompStats();
-#endif
             inputOffset++;
         }
+#else
+        inputOffset = NextOffsetInSet<IsNegation>(this->set, *this, input, inputLength, inputOffset);
+#endif
 
         if (inputOffset >= inputLength)
             return matcher.HardFail(HARDFAIL_PARAMETERS(ImmediateFail));
@@ -2141,63 +2272,89 @@ namespace UnifiedRegex
         int besti = -1;
         CharCount bestMatchOffset = 0;
 
-        if (matcher.literalNextSyncInputOffsets == nullptr)
-        {
-            Assert(numLiterals <= MaxNumSyncLiterals);
-            matcher.literalNextSyncInputOffsets =
-                RecyclerNewArrayLeaf(matcher.recycler, CharCount, ScannersMixin::MaxNumSyncLiterals);
-        }
-        CharCount* literalNextSyncInputOffsets = matcher.literalNextSyncInputOffsets;
-
-        if (firstIteration)
+#if !ENABLE_REGEX_CONFIG_OPTIONS
+        if (hasOnlyExactLiterals)
         {
+            // Look for all the literals in one pass, which finds the earliest one directly
+            const Char* literals[MaxNumSyncLiterals];
+            CharCount literalLengths[MaxNumSyncLiterals];
             for (int i = 0; i < numLiterals; i++)
             {
-                literalNextSyncInputOffsets[i] = inputOffset;
+                literals[i] = matcher.program->rep.insts.litbuf + infos[i]->offset;
+                literalLengths[i] = infos[i]->length;
             }
-        }
 
-        for (int i = 0; i < numLiterals; i++)
+            uint foundLiteral;
+            const int index = inputOffset < inputLength
+                ? Js::StringUtilities::IndexOfAny(input + inputOffset, inputLength - inputOffset, literals, literalLengths, numLiterals, &foundLiteral)
+                : -1;
+            if (index != -1)
+            {
+                besti = (int)foundLiteral;
+                bestMatchOffset = inputOffset + index;
+            }
+        }
+        else
+#endif
         {
-            CharCount thisMatchOffset = literalNextSyncInputOffsets[i];
-            if (inputOffset > thisMatchOffset)
+            if (matcher.literalNextSyncInputOffsets == nullptr)
             {
-                thisMatchOffset = inputOffset;
+                Assert(numLiterals <= MaxNumSyncLiterals);
+                matcher.literalNextSyncInputOffsets =
+                    RecyclerNewArrayLeaf(matcher.recycler, CharCount, ScannersMixin::MaxNumSyncLiterals);
             }
+            CharCount* literalNextSyncInputOffsets = matcher.literalNextSyncInputOffsets;
 
-            if (infos[i]->isEquivClass ?
-                    (infos[i]->scanner.Match<CaseInsensitive::EquivClassSize>
-                    ( input
-                    , inputLength
-                    , thisMatchOffset
-                    , matcher.program->rep.insts.litbuf + infos[i]->offset
-                    , infos[i]->length
+            if (firstIteration)
+            {
+                for (int i = 0; i < numLiterals; i++)
+                {
+                    literalNextSyncInputOffsets[i] = inputOffset;
+                }
+            }
+
+            for (int i = 0; i < numLiterals; i++)
+            {
+                CharCount thisMatchOffset = literalNextSyncInputOffsets[i];
+                if (inputOffset > thisMatchOffset)
+                {
+                    thisMatchOffset = inputOffset;
+                }
+
+                if (infos[i]->isEquivClass ?
+                        (infos[i]->scanner.Match<CaseInsensitive::EquivClassSize>
+                        ( input
+                        , inputLength
+                        , thisMatchOffset
+                        , matcher.program->rep.insts.litbuf + infos[i]->offset
+                        , infos[i]->length
 #if ENABLE_REGEX_CONFIG_OPTIONS
-                    , matcher.stats
+                        , matcher.stats
 #endif
-                    )) :
-                    (infos[i]->scanner.Match<1>
-                    ( input
-                    , inputLength
-                    , thisMatchOffset
-                    , matcher.program->rep.insts.litbuf + infos[i]->offset
-                    , infos[i]->length
+                        )) :
+                        (infos[i]->scanner.Match<1>
+                        ( input
+                        , inputLength
+                        , thisMatchOffset
+                        , matcher.program->rep.insts.litbuf + infos[i]->offset
+                        , infos[i]->length
 #if ENABLE_REGEX_CONFIG_OPTIONS
-                    , matcher.stats
+                        , matcher.stats
 #endif
-                    )))
-            {
-                if (besti < 0 || thisMatchOffset < bestMatchOffset)
+                        )))
                 {
-                    besti = i;
-                    bestMatchOffset = thisMatchOffset;
-                }
+                    if (besti < 0 || thisMatchOffset < bestMatchOffset)
+                    {
+                        besti = i;
+                        bestMatchOffset = thisMatchOffset;
+                    }
 
-                literalNextSyncInputOffsets[i] = thisMatchOffset;
-            }
-            else
-            {
-                literalNextSyncInputOffsets[i] = inputLength;
+                    literalNextSyncInputOffsets[i] = thisMatchOffset;
+                }
+                else
+                {
+                    literalNextSyncInputOffsets[i] = inputLength;
+                }
             }
         }
 
@@ -4409,11 +4566,25 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+#if ENABLE_REGEX_NATIVE_CODE
+        , nativeCode(nullptr)
+        , nativeBacktrackStack(nullptr)
+        , matchesUntilNativeCode(0)
+#endif
+        , linearMatcher(nullptr)
+        , backtracksUntilLinear(0)
+        , profileEntry(nullptr)
+        , profilerId(0)
+        , isSampled(false)
+        , sampledBacktrackCount(0)
+        , sampledContStackSize(0)
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
 #endif
     {
+        memset(engineUseCounts, 0, sizeof(engineUseCounts));
+
         // Don't need to zero out - the constructor for GroupInfo should take care of it
         groupInfos = RecyclerNewArrayLeaf(recycler, GroupInfo, program->numGroups);
 
@@ -4421,6 +4592,20 @@ namespace UnifiedRegex
         {
             loopInfos = RecyclerNewArrayLeafZ(recycler, LoopInfo, program->numLoops);
         }
+
+#if ENABLE_REGEX_NATIVE_CODE
+        // Shallow clones share the program but don't own native code, see RegexPattern::Finalize
+        if ((program->tag == Program::InstructionsTag ||
+                program->tag == Program::BOIInstructionsTag ||
+                program->tag == Program::BOIInstructionsForStickyFlagTag) &&
+            !pattern->isShallowClone &&
+            !PHASE_OFF1(Js::RegexJitPhase) &&
+            !scriptContext->IsInterpreted())
+        {
+            const int threshold = CONFIG_FLAG(RegexJitThreshold);
+            matchesUntilNativeCode = threshold > 0 ? (uint)threshold : 0;
+        }
+#endif
     }
 
     Matcher *Matcher::New(Js::ScriptContext* scriptContext, RegexPattern* pattern)
@@ -4526,7 +4711,22 @@ namespace UnifiedRegex
     {
         if (!contStack.IsEmpty())
         {
-            if (!RunContStack(input, inputOffset, instPointer, contStack, assertionStack, qcTicks))
+            if (isSampled)
+            {
+                // Continuations are only popped by backtracking, so the stack is at its highest since the last backtrack now
+                sampledBacktrackCount++;
+                if (contStack.Position() > sampledContStackSize)
+                    sampledContStackSize = contStack.Position();
+            }
+
+            // If the linear program turns out to be unsupported, keep backtracking, there's no limit from here on
+            if (backtracksUntilLinear != 0 && --backtracksUntilLinear == 0 && EnsureLinearProgram())
+            {
+                // Backtracking too much: give up, Match redoes the search with the linear matcher
+                contStack.Clear();
+                assertionStack.Clear();
+            }
+            else if (!RunContStack(input, inputOffset, instPointer, contStack, assertionStack, qcTicks))
             {
                 return false;
             }
@@ -4643,9 +4843,70 @@ namespace UnifiedRegex
         Run(input, inputLength, matchStart, nextSyncInputOffset, contStack, assertionStack, qcTicks, firstIteration);
         // Leave the continuation and assertion stack memory in place so we don't have to alloc next time
 
+        if (isSampled && contStack.Position() > sampledContStackSize)
+            sampledContStackSize = contStack.Position();
+
         return WasLastMatchSuccessful();
     }
 
+#if ENABLE_REGEX_NATIVE_CODE
+    void Matcher::CompileNativeCode(Js::ScriptContext* scriptContext)
+    {
+        Assert(nativeCode == nullptr);
+
+        if (pattern->rep.unified.nativeCode != nullptr)
+        {
+            // Another matcher of the pattern, created while this one was running, already owns the code. Leave this one
+            // interpreted rather than compile a second copy.
+            return;
+        }
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("RegexNativeCompiler"));
+        {
+            NativeCompiler compiler(tempAllocator, program, standardChars);
+            if (compiler.Compile())
+            {
+                uint8* const backtrackStack = RecyclerNewArrayLeaf(recycler, uint8, compiler.GetBacktrackStackSize());
+                void* const code = scriptContext->AllocateRegexNativeCode(compiler.GetCode(), compiler.GetCodeSize());
+                if (code != nullptr)
+                {
+                    pattern->rep.unified.nativeCode = code;
+                    nativeCode = (NativeMatchFunction)code;
+                    nativeBacktrackStack = backtrackStack;
+                }
+            }
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+    }
+
+    inline int Matcher::MatchNative(const Char* const input, const CharCount inputLength, CharCount &matchStart, uint &qcTicks, uint &backtracks)
+    {
+        NativeMatchState state;
+        state.input = input;
+        state.groupInfos = groupInfos;
+        state.backtrackStack = nativeBacktrackStack;
+        state.inputLength = inputLength;
+        state.matchStart = matchStart;
+        state.backtrackBudget = NativeCompiler::BacktrackBudget;
+
+        ResetInnerGroups(0, program->numGroups - 1);
+        const int result = nativeCode(&state);
+        QueryContinue(qcTicks);
+
+        if (result != NativeResultBailOut)
+        {
+            matchStart = state.matchStart;
+            backtracks = NativeCompiler::BacktrackBudget - state.backtrackBudget;
+        }
+        else
+        {
+            // The budget wrapped around when it ran out
+            backtracks = NativeCompiler::BacktrackBudget;
+        }
+        return result;
+    }
+#endif
+
     inline bool Matcher::MatchSingleCharCaseInsensitive(const Char* const input, const CharCount inputLength, CharCount offset, const Char c)
     {
         CaseInsensitive::MappingSource mappingSource = program->GetCaseMappingSource();
@@ -4922,6 +5183,34 @@ namespace UnifiedRegex
         return false;
     }
 
+    bool Matcher::EnsureLinearProgram()
+    {
+        // The program is shared with the pattern and its other matchers, which see the result too
+        Program* const linearProgramOwner = pattern->rep.unified.program;
+        Assert(linearProgramOwner == program);
+        if (linearProgramOwner->rep.insts.linearProgramState == Program::LinearProgramNotCompiled)
+        {
+            LinearProgram* const linearProgram = Compiler::CompileLinearProgram(pattern->GetScriptContext(), program);
+            linearProgramOwner->rep.insts.linearProgram = linearProgram;
+            linearProgramOwner->rep.insts.linearProgramState =
+                linearProgram != nullptr ? Program::LinearProgramCompiled : Program::LinearProgramUnsupported;
+        }
+        return linearProgramOwner->rep.insts.linearProgramState == Program::LinearProgramCompiled;
+    }
+
+    inline bool Matcher::MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, bool tryLaterOffsets, uint &qcTicks)
+    {
+        const LinearProgram* const linearProgram = program->rep.insts.linearProgram;
+        Assert(linearProgram != nullptr);
+
+        if (linearMatcher == nullptr)
+        {
+            linearMatcher = LinearMatcher::New(recycler, linearProgram, standardChars);
+        }
+
+        return linearMatcher->Match(*this, input, inputLength, offset, tryLaterOffsets, groupInfos, qcTicks);
+    }
+
     bool Matcher::Match
         ( const Char* const input
         , const CharCount inputLength
@@ -4940,6 +5229,7 @@ namespace UnifiedRegex
 
         Assert(offset <= inputLength);
         bool res;
+        MatchEngine engine = SpecializedEngine;
         bool loopMatchHere = true;
         Program const *prog = this->program;
         bool isStickyPresent = this->pattern->IsSticky();
@@ -4964,6 +5254,22 @@ namespace UnifiedRegex
 
         case Program::InstructionsTag:
             {
+                // Every match contains the required literal, so there is nothing to try if the rest of the input doesn't
+                if (loopMatchHere && prog->rep.insts.requiredLiteralLength != 0
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                    && stats == nullptr && w == nullptr
+#endif
+                    && Js::StringUtilities::IndexOf(
+                        input + offset,
+                        inputLength - offset,
+                        prog->rep.insts.litbuf + prog->rep.insts.requiredLiteralOffset,
+                        prog->rep.insts.requiredLiteralLength) == -1)
+                {
+                    groupInfos[0].Reset();
+                    res = false;
+                    break;
+                }
+
                 previousQcTime = 0;
                 uint qcTicks = 0;
 
@@ -4974,16 +5280,113 @@ namespace UnifiedRegex
 
                 RegexStacks * regexStacks = scriptContext->RegexStacks();
 
+#if ENABLE_REGEX_NATIVE_CODE
+                if (matchesUntilNativeCode != 0 && --matchesUntilNativeCode == 0)
+                {
+                    CompileNativeCode(scriptContext);
+                }
+                bool useNativeCode = nativeCode != nullptr;
+                // Matches sampled by the regex profiler are interpreted, since only the interpreter measures backtracking
+                useNativeCode = useNativeCode && !isSampled;
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                // Tracing and statistics need the interpreter
+                useNativeCode = useNativeCode && stats == nullptr && w == nullptr;
+#endif
+#endif
+
+                // Patterns that have a linear program switch to it after too much backtracking, or use it right away if
+                // the limit is 0
+                bool useLinear = false;
+                backtracksUntilLinear = 0;
+                if (prog->rep.insts.linearProgramState != Program::LinearProgramUnsupported)
+                {
+                    const int backtrackLimit = CONFIG_FLAG(RegexBacktrackLimit);
+                    if (backtrackLimit <= 0)
+                    {
+                        useLinear = EnsureLinearProgram();
+                    }
+                    else
+                    {
+                        backtracksUntilLinear = (uint)backtrackLimit;
+                    }
+                }
+
                 // Need to continue matching even if matchStart == inputLim since some patterns may match an empty string at the end
                 // of the input. For instance: /a*$/.exec("b")
                 bool firstIteration = true;
-                do
+                while (!useLinear)
                 {
+#if ENABLE_REGEX_NATIVE_CODE
+                    if (useNativeCode)
+                    {
+                        const CharCount matchNativeOffset = offset;
+                        uint nativeBacktracks;
+                        const int result = MatchNative(input, inputLength, offset, qcTicks, nativeBacktracks);
+
+                        // Native backtracks count towards the limit too, or a pattern that stays under the native budget at
+                        // every start offset would never reach the linear matcher
+                        if (backtracksUntilLinear != 0)
+                        {
+                            if (nativeBacktracks < backtracksUntilLinear)
+                            {
+                                backtracksUntilLinear -= nativeBacktracks;
+                            }
+                            else
+                            {
+                                backtracksUntilLinear = 0;
+                                if (result != NativeResultMatch && EnsureLinearProgram())
+                                {
+                                    // Same as the interpreter below: redo the search from this start offset
+                                    offset = matchNativeOffset;
+                                    useLinear = true;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (result != NativeResultBailOut)
+                        {
+                            res = result == NativeResultMatch;
+                            engine = NativeEngine;
+                            firstIteration = false;
+                            if (res || !loopMatchHere || ++offset > inputLength)
+                            {
+                                break;
+                            }
+                            continue;
+                        }
+
+                        // Too much backtracking for the native code, which doesn't check in with the host. Let the
+                        // interpreter redo this start offset and the rest.
+                        useNativeCode = false;
+                    }
+#endif
+
                     // Let there be only one call to MatchHere(), as that call expands the interpreter loop in-place. Having
                     // multiple calls to MatchHere() would bloat the code.
+                    const CharCount matchHereOffset = offset;
                     res = MatchHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration);
+                    engine = BacktrackingEngine;
                     firstIteration = false;
-                } while(!res && loopMatchHere && ++offset <= inputLength);
+                    if (!res && backtracksUntilLinear == 0 && prog->rep.insts.linearProgramState == Program::LinearProgramCompiled)
+                    {
+                        // The backtrack limit was reached somewhere from this offset on. Start offsets skipped by
+                        // synchronization can't match, so redoing them is only wasted work.
+                        offset = matchHereOffset;
+                        useLinear = true;
+                        break;
+                    }
+                    if (res || !loopMatchHere || ++offset > inputLength)
+                    {
+                        break;
+                    }
+                }
+
+                if (useLinear)
+                {
+                    res = MatchLinear(input, inputLength, offset, loopMatchHere, qcTicks);
+                    engine = LinearEngine;
+                }
 
                 break;
             }
@@ -5021,7 +5424,11 @@ namespace UnifiedRegex
             __assume(false);
         }
 
+        engineUseCounts[engine]++;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
+        if (stats != 0)
+            stats->engineCounts[engine]++;
         this->stats = 0;
         this->w = 0;
 #endif
@@ -5111,6 +5518,10 @@ namespace UnifiedRegex
         rep.insts.litbuf = 0;
         rep.insts.litbufLen = 0;
         rep.insts.scannersForSyncToLiterals = 0;
+        rep.insts.requiredLiteralOffset = 0;
+        rep.insts.requiredLiteralLength = 0;
+        rep.insts.linearProgram = 0;
+        rep.insts.linearProgramState = LinearProgramUnsupported;
     }
 
     Program *Program::New(Recycler *recycler, RegexFlags flags)
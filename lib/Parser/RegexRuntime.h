@@ -17,6 +17,14 @@ namespace UnifiedRegex
     class ContStack;
     class AssertionStack;
     class OctoquadMatcher;
+    class LinearProgram;
+    class LinearMatcher;
+    struct RegexProfileEntry;
+#if ENABLE_REGEX_NATIVE_CODE
+    class NativeCompiler;
+    struct NativeMatchState;
+    typedef int (*NativeMatchFunction)(NativeMatchState* state);
+#endif
 
     enum class ChompMode : uint8
     {
@@ -31,6 +39,10 @@ namespace UnifiedRegex
     struct Program : private Chars<char16>
     {
         friend class Compiler;
+        friend class LinearCompiler;
+#if ENABLE_REGEX_NATIVE_CODE
+        friend class NativeCompiler;
+#endif
         friend struct MatchLiteralNode;
         friend struct AltNode;
         friend class Matcher;
@@ -78,6 +90,15 @@ namespace UnifiedRegex
 
         ProgramTag tag;
 
+        enum LinearProgramState : uint8
+        {
+            // The pattern can't be matched in linear time, or compiling its linear program failed
+            LinearProgramUnsupported,
+            // The linear program is compiled the first time a match of the pattern backtracks too much
+            LinearProgramNotCompiled,
+            LinearProgramCompiled
+        };
+
         struct Instructions
         {
             // Instruction array, in run-time allocator, owned by program, never null
@@ -92,6 +113,15 @@ namespace UnifiedRegex
             // ever be only one of those instructions per program. Since scanners are large (> 1 KB), for that instruction they
             // are allocated on the recycler with pointers stored here to reference them.
             ScannerInfo **scannersForSyncToLiterals;
+
+            // A literal in litbuf that every match contains, looked for before matching if requiredLiteralLength is not 0
+            CharCount requiredLiteralOffset;
+            CharCount requiredLiteralLength;
+
+            // The program as an automaton LinearMatcher can run, for when the instructions backtrack too much. In recycler,
+            // 0 unless linearProgramState is LinearProgramCompiled.
+            LinearProgram* linearProgram;
+            LinearProgramState linearProgramState;
         };
 
         struct SingleChar
@@ -153,6 +183,9 @@ namespace UnifiedRegex
 
         void FreeBody(ArenaAllocator* rtAllocator);
 
+        // Octoquad programs depend on trigram state kept by the pattern they were compiled for
+        inline bool IsShareable() const { return tag != OctoquadTag; }
+
         inline CaseInsensitive::MappingSource GetCaseMappingSource() const
         {
             return (flags & UnicodeRegexFlag) != 0
@@ -358,6 +391,30 @@ namespace UnifiedRegex
 #endif
     };
 
+    struct ScanRangesMixin
+    {
+        // The characters a scan stops at, as inclusive (lower, upper) pairs, if there are few enough ranges of them to
+        // compare against in bulk. Otherwise numRanges is 0 and each character is looked up in the set.
+        char16 ranges[Js::StringUtilities::MaxRanges * 2];
+        uint8 numRanges;
+
+        inline ScanRangesMixin() : numRanges(0) {}
+
+        // Only used at compile time
+        void SetupRanges(const RuntimeCharSet<char16>& set, bool isNegation);
+    };
+
+    template<bool IsNegation>
+    struct ScanSetMixin : SetMixin<IsNegation>, ScanRangesMixin
+    {
+        // Only used at compile time
+        inline void CloneSetFrom(ArenaAllocator* rtAllocator, const CharSet<char16>& other)
+        {
+            this->set.CloneFrom(rtAllocator, other);
+            SetupRanges(this->set, IsNegation);
+        }
+    };
+
     struct Char2LiteralScannerMixin : Char2Mixin
     {
         // scanner must be setup
@@ -424,10 +481,12 @@ namespace UnifiedRegex
 
         int numLiterals;
         ScannerInfo** infos;
+        // True if no literal is an equivalence class, so they can all be looked for in one pass
+        bool hasOnlyExactLiterals;
 
         // scanner mixins must be added
         inline ScannersMixin(Recycler *const recycler, Program *const program)
-            : numLiterals(0), infos(program->CreateScannerArrayForSyncToLiterals(recycler))
+            : numLiterals(0), infos(program->CreateScannerArrayForSyncToLiterals(recycler)), hasOnlyExactLiterals(true)
         {
         }
 
@@ -895,7 +954,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndContinueInst : Inst, SetMixin<IsNegation>
+    struct SyncToSetAndContinueInst : Inst, ScanSetMixin<IsNegation>
     {
         // set must always be cloned from source
         inline SyncToSetAndContinueInst() : Inst(IsNegation ? SyncToNegatedSetAndContinue : SyncToSetAndContinue) {}
@@ -970,7 +1029,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndConsumeInst : Inst, SetMixin<IsNegation>
+    struct SyncToSetAndConsumeInst : Inst, ScanSetMixin<IsNegation>
     {
         // set must always be cloned from source
         inline SyncToSetAndConsumeInst() : Inst(IsNegation ? SyncToNegatedSetAndConsume : SyncToSetAndConsume) {}
@@ -1038,7 +1097,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndBackupInst : Inst, SetMixin<IsNegation>, BackupMixin
+    struct SyncToSetAndBackupInst : Inst, ScanSetMixin<IsNegation>, BackupMixin
     {
         // set must always be cloned from source
         inline SyncToSetAndBackupInst(const CountDomain& backup) : Inst(IsNegation ? SyncToNegatedSetAndBackup : SyncToSetAndBackup), BackupMixin(backup) {}
@@ -1685,6 +1744,16 @@ namespace UnifiedRegex
         AssertionStack assertionStack;
     };
 
+    // The ways Matcher::Match may find the result of a match
+    enum MatchEngine
+    {
+        SpecializedEngine,      // programs other than instructions, and instructions ruled out by their required literal
+        BacktrackingEngine,     // the interpreter
+        NativeEngine,           // native code of the instructions
+        LinearEngine,           // LinearMatcher, after too much backtracking
+        NumMatchEngines
+    };
+
     enum HardFailMode
     {
         BacktrackAndLater,
@@ -1719,6 +1788,9 @@ namespace UnifiedRegex
 
         friend GroupInfo;
         friend LoopInfo;
+        friend class LinearMatcher;
+        friend class RegexProfiler;
+        friend class AutoClearSampledMatch;
 
     public:
         static const uint TicksPerQc;
@@ -1751,6 +1823,30 @@ namespace UnifiedRegex
 
         uint previousQcTime;
 
+#if ENABLE_REGEX_NATIVE_CODE
+        // Native code of the program, once it is compiled, and the backtrack stack it runs with
+        NativeMatchFunction nativeCode;
+        uint8* nativeBacktrackStack;
+        // Number of calls to Match left until the one that compiles the program, or 0 if it never will be
+        uint matchesUntilNativeCode;
+#endif
+
+        // Created on the first match that needs it
+        LinearMatcher* linearMatcher;
+        // Number of backtracks left in the current match before it switches to the linear matcher, or 0 if it won't
+        uint backtracksUntilLinear;
+        // Number of matches completed by each engine
+        uint engineUseCounts[NumMatchEngines];
+
+        // Entry of the pattern in the regex profiler with id profilerId, or null if the pattern isn't profiled
+        RegexProfileEntry* profileEntry;
+        uint profilerId;
+        // Set while the regex profiler samples a match. Sampled matches are interpreted, and count their backtracks and
+        // keep the continuation stack's high-water mark (in bytes).
+        bool isSampled;
+        uint64 sampledBacktrackCount;
+        size_t sampledContStackSize;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         RegexStats* stats;
         DebugWriter* w;
@@ -1771,6 +1867,12 @@ namespace UnifiedRegex
 #endif
             );
 
+        inline uint GetEngineUseCount(MatchEngine engine) const
+        {
+            Assert(engine >= 0 && engine < NumMatchEngines);
+            return engineUseCounts[engine];
+        }
+
         inline bool WasLastMatchSuccessful() const
         {
             return !groupInfos[0].IsUndefined();
@@ -1815,6 +1917,16 @@ namespace UnifiedRegex
 
         inline void Run(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
         inline bool MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
+        // Compiles the linear program of the pattern if that hasn't been tried yet. Returns true if there is one.
+        bool EnsureLinearProgram();
+
+#if ENABLE_REGEX_NATIVE_CODE
+        void CompileNativeCode(Js::ScriptContext* scriptContext);
+        // Returns a NativeMatchResult
+        inline int MatchNative(const Char* const input, const CharCount inputLength, CharCount &matchStart, uint &qcTicks, uint &backtracks);
+#endif
+
+        inline bool MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, bool tryLaterOffsets, uint &qcTicks);
 
         // Return true if assertion succeeded
         inline bool PopAssertion(CharCount &inputOffset, const uint8 *&instPointer, ContStack &contStack, AssertionStack &assertionStack, bool isFailed);
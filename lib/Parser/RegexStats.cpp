@@ -10,6 +10,7 @@ namespace UnifiedRegex
 {
     const char16* RegexStats::PhaseNames[RegexStats::NumPhases] = { _u("parse"), _u("compile"), _u("execute") };
     const char16* RegexStats::UseNames[RegexStats::NumUses] = { _u("match"), _u("exec"), _u("test"), _u("replace"), _u("split"), _u("search") };
+    const char16* RegexStats::EngineNames[NumMatchEngines] = { _u("specialized"), _u("backtracking"), _u("native"), _u("linear") };
 
     RegexStats::RegexStats(RegexPattern* pattern)
         : pattern(pattern)
@@ -24,6 +25,8 @@ namespace UnifiedRegex
             phaseTicks[i] = 0;
         for (int i = 0; i < NumUses; i++)
             useCounts[i] = 0;
+        for (int i = 0; i < NumMatchEngines; i++)
+            engineCounts[i] = 0;
     }
 
     void RegexStats::Print(DebugWriter* w, RegexStats* totals, Ticks ticksPerMillisecond)
@@ -61,6 +64,20 @@ namespace UnifiedRegex
             }
         }
 
+        for (int i = 0; i < NumMatchEngines; i++)
+        {
+            if (engineCounts[i] > 0)
+            {
+                if (totals == 0 || totals->engineCounts[i] == 0)
+                    w->PrintEOL(_u("#%-11s: %10I64u"), EngineNames[i], engineCounts[i]);
+                else
+                {
+                    double pc = (double)engineCounts[i] * 100.0 / (double)totals->engineCounts[i];
+                    w->PrintEOL(_u("#%-11s: %10I64u   (%10.4f%%)"), EngineNames[i], engineCounts[i], pc);
+                }
+            }
+        }
+
         if (inputLength > 0)
         {
             double r = (double)numCompares * 100.0 / (double)inputLength;
@@ -122,6 +139,8 @@ namespace UnifiedRegex
             phaseTicks[i] += other->phaseTicks[i];
         for (int i = 0; i < NumUses; i++)
             useCounts[i] += other->useCounts[i];
+        for (int i = 0; i < NumMatchEngines; i++)
+            engineCounts[i] += other->engineCounts[i];
         inputLength += other->inputLength;
         numCompares += other->numCompares;
         numPushes += other->numPushes;
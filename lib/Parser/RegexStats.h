@@ -34,6 +34,8 @@ namespace UnifiedRegex
 
         static const char16* UseNames[NumUses];
 
+        static const char16* EngineNames[NumMatchEngines];
+
         RegexPattern* pattern; // null => total record
 
         // Time spent on regex
@@ -52,6 +54,8 @@ namespace UnifiedRegex
         uint64 stackHWM;
         // Number of instructions executed
         uint64 numInsts;
+        // Number of matches completed by each engine
+        uint64 engineCounts[NumMatchEngines];
 
         RegexStats(RegexPattern* pattern);
 
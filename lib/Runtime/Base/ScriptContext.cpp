@@ -103,6 +103,9 @@ namespace Js
 #if DYNAMIC_INTERPRETER_THUNK
         interpreterThunkEmitter(nullptr),
 #endif
+#if ENABLE_REGEX_NATIVE_CODE
+        regexCodeBufferManager(nullptr),
+#endif
 #ifdef ASMJS_PLAT
         asmJsInterpreterThunkEmitter(nullptr),
         asmJsCodeGenerator(nullptr),
@@ -128,6 +131,7 @@ namespace Js
         registeredPrototypeChainEnsuredToHaveOnlyWritableDataPropertiesScriptContext(nullptr),
         cache(nullptr),
         firstInterpreterFrameReturnAddress(nullptr),
+        dynamicCodeCacheBuffers(nullptr),
         builtInLibraryFunctions(nullptr),
         m_remoteScriptContextAddr(nullptr),
         isWeakReferenceDictionaryListCleared(false)
@@ -253,6 +257,8 @@ namespace Js
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
+        byteCodeBigramHistogram = Configuration::Global.flags.BytecodeBigramHist ?
+            HeapNewArrayZ(uint, ByteCodeBigramOpCount * ByteCodeBigramOpCount) : nullptr;
 #endif
 
         memset(propertyStrings, 0, sizeof(PropertyStringMap*)* 80);
@@ -397,6 +403,14 @@ namespace Js
         }
 #endif
 
+#if DBG_DUMP
+        if (byteCodeBigramHistogram != nullptr)
+        {
+            HeapDeleteArray(ByteCodeBigramOpCount * ByteCodeBigramOpCount, byteCodeBigramHistogram);
+            byteCodeBigramHistogram = nullptr;
+        }
+#endif
+
         // TODO: Can we move this on Close()?
         ClearHostScriptContext();
 
@@ -489,6 +503,14 @@ namespace Js
         }
 #endif
 
+#if ENABLE_REGEX_NATIVE_CODE
+        if (this->regexCodeBufferManager != nullptr)
+        {
+            HeapDelete(regexCodeBufferManager);
+            this->regexCodeBufferManager = nullptr;
+        }
+#endif
+
 #ifdef ASMJS_PLAT
         if (this->asmJsInterpreterThunkEmitter != nullptr)
         {
@@ -1010,7 +1032,7 @@ namespace Js
         Output::Print(_u("    Object Lit Cache Hits......... %d\n"), objectLiteralCacheCount);
         Output::Print(_u("    Object Lit Branch count....... %d\n"), objectLiteralBranchCount);
 
-        for (int i = 0; i < TypePath::MaxPathTypeHandlerLength; i++)
+        for (int i = 0; i < TypePath::MaxTinyDictionaryPathLength; i++)
         {
             if (objectLiteralCount[i] != 0)
             {
@@ -1174,6 +1196,46 @@ namespace Js
         regexStacks = stacks;
     }
 
+#if ENABLE_REGEX_NATIVE_CODE
+    void* ScriptContext::AllocateRegexNativeCode(const BYTE* code, size_t size)
+    {
+#ifdef ENABLE_OOP_NATIVE_CODEGEN
+        if (JITManager::GetJITManager()->IsOOPJITEnabled())
+        {
+            // The code pages aren't writable from this process
+            return nullptr;
+        }
+#endif
+
+        if (this->regexCodeBufferManager == nullptr)
+        {
+            // Regex code is only written from the script thread, like the interpreter thunks whose code pages it shares
+            this->regexCodeBufferManager = HeapNew(EmitBufferManager<>, RegexAllocator(), this->GetThreadContext()->GetThunkPageAllocators(), nullptr, _u("Regex code buffer"), GetCurrentProcess());
+        }
+
+        BYTE* buffer;
+        EmitBufferAllocation* allocation = this->regexCodeBufferManager->AllocateBuffer(size, &buffer);
+        if (allocation == nullptr)
+        {
+            return nullptr;
+        }
+        if (!this->regexCodeBufferManager->CommitBuffer(allocation, buffer, size, code))
+        {
+            Js::Throw::OutOfMemory();
+        }
+
+        // Call to set VALID flag for CFG check
+        this->GetThreadContext()->SetValidCallTargetForCFG(buffer);
+        return buffer;
+    }
+
+    void ScriptContext::FreeRegexNativeCode(void* address)
+    {
+        Assert(this->regexCodeBufferManager != nullptr);
+        this->regexCodeBufferManager->FreeAllocation(address);
+    }
+#endif
+
     Js::TempArenaAllocatorObject* ScriptContext::GetTemporaryAllocator(LPCWSTR name)
     {
         return this->threadContext->GetTemporaryAllocator(name);
@@ -1808,7 +1870,8 @@ namespace Js
         // TODO: yongqu handle non-global code.
         ULONG grfscr = fscrGlobalCode | ((loadScriptFlag & LoadScriptFlag_Expression) == LoadScriptFlag_Expression ? fscrReturnExpression : 0);
         if(((loadScriptFlag & LoadScriptFlag_disableDeferredParse) != LoadScriptFlag_disableDeferredParse) &&
-            (length > Parser::GetDeferralThreshold(sourceContextInfo->IsSourceProfileLoaded())))
+            ((loadScriptFlag & LoadScriptFlag_ForceDeferParse) == LoadScriptFlag_ForceDeferParse ||
+             length > Parser::GetDeferralThreshold(sourceContextInfo->IsSourceProfileLoaded())))
         {
             grfscr |= fscrDeferFncParse;
         }
@@ -1930,6 +1993,202 @@ namespace Js
         }
     }
 
+    static size_t CountLineTerminators(LPCUTF8 text, size_t cb)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < cb; i++)
+        {
+            if (text[i] == '\n' || (text[i] == '\r' && (i + 1 == cb || text[i + 1] != '\n')))
+            {
+                count++;
+            }
+            else if (text[i] == 0xE2 && i + 2 < cb && text[i + 1] == 0x80 && (text[i + 2] == 0xA8 || text[i + 2] == 0xA9))
+            {
+                // U+2028 LINE SEPARATOR, U+2029 PARAGRAPH SEPARATOR
+                count++;
+            }
+        }
+        return count;
+    }
+
+    static bool IsAsciiIdentifierChar(utf8char_t c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+    }
+
+    static bool MayChangeLexicalDeclarations(LPCUTF8 text, size_t cb, size_t start, size_t end)
+    {
+        // Functions refer to global let/const/class bindings by name, but the byte code generator uses what it
+        // knows about them (e.g. assignments to a const). Treat any of the keywords as a word of its own in the
+        // edited text as a changed declaration. The edit is widened to the words it touches, so that e.g. turning
+        // "lettuce" into "let" counts. Non-ASCII characters end a word, which only makes the check more
+        // conservative; comments and strings are not told apart either.
+        while (start > 0 && IsAsciiIdentifierChar(text[start - 1]))
+        {
+            start--;
+        }
+        while (end < cb && IsAsciiIdentifierChar(text[end]))
+        {
+            end++;
+        }
+
+        static const char * const keywords[] = { "let", "const", "class" };
+        size_t i = start;
+        while (i < end)
+        {
+            if (!IsAsciiIdentifierChar(text[i]))
+            {
+                i++;
+                continue;
+            }
+
+            size_t wordStart = i;
+            while (i < end && IsAsciiIdentifierChar(text[i]))
+            {
+                i++;
+            }
+            for (const char * keyword : keywords)
+            {
+                if (i - wordStart == strlen(keyword) && memcmp(text + wordStart, keyword, i - wordStart) == 0)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Replace the nested functions of a freshly loaded global script with the already compiled functions of a
+    // previous load of the same script whose text, and therefore byte code, did not change. Only the global
+    // function's direct children are considered: they reach the rest of the script through the global object,
+    // by name, so their byte code doesn't depend on the surrounding code. Functions before the edit keep their
+    // offsets; functions after it are only reused when the edit didn't add or remove lines, so the line numbers
+    // recorded against the previous source stay correct. Profile data and native code come along with the body.
+    uint ScriptContext::ReuseUnchangedFunctions(FunctionBody * globalBody, FunctionBody * previousGlobalBody)
+    {
+        Assert(globalBody && previousGlobalBody);
+
+        if (PHASE_OFF1(Js::ScriptReloadPhase) ||
+            this->IsScriptContextInSourceRundownOrDebugMode() ||
+            previousGlobalBody->GetScriptContext() != this ||
+            !globalBody->GetIsGlobalFunc() || !previousGlobalBody->GetIsGlobalFunc() ||
+            globalBody->GetIsStrictMode() != previousGlobalBody->GetIsStrictMode() ||
+            globalBody->GetNestedCount() == 0 || previousGlobalBody->GetNestedCount() == 0)
+        {
+            return 0;
+        }
+
+#if ENABLE_TTD
+        if (this->IsTTDRecordModeEnabled() || this->ShouldPerformReplayAction())
+        {
+            return 0;
+        }
+#endif
+
+        Utf8SourceInfo * sourceInfo = globalBody->GetUtf8SourceInfo();
+        Utf8SourceInfo * previousSourceInfo = previousGlobalBody->GetUtf8SourceInfo();
+        if (sourceInfo == previousSourceInfo)
+        {
+            return 0;
+        }
+
+        LPCUTF8 source = sourceInfo->GetSource(_u("ScriptContext::ReuseUnchangedFunctions"));
+        size_t cbSource = sourceInfo->GetCbLength(_u("ScriptContext::ReuseUnchangedFunctions"));
+        LPCUTF8 previousSource = previousSourceInfo->GetSource(_u("ScriptContext::ReuseUnchangedFunctions"));
+        size_t cbPreviousSource = previousSourceInfo->GetCbLength(_u("ScriptContext::ReuseUnchangedFunctions"));
+
+        size_t cbCommon = min(cbSource, cbPreviousSource);
+        size_t cbPrefix = 0;
+        while (cbPrefix < cbCommon && source[cbPrefix] == previousSource[cbPrefix])
+        {
+            cbPrefix++;
+        }
+        size_t cbSuffix = 0;
+        while (cbSuffix < cbCommon - cbPrefix && source[cbSource - 1 - cbSuffix] == previousSource[cbPreviousSource - 1 - cbSuffix])
+        {
+            cbSuffix++;
+        }
+
+        size_t cbEdit = cbSource - cbSuffix - cbPrefix;
+        size_t cbPreviousEdit = cbPreviousSource - cbSuffix - cbPrefix;
+        if (MayChangeLexicalDeclarations(source, cbSource, cbPrefix, cbPrefix + cbEdit) ||
+            MayChangeLexicalDeclarations(previousSource, cbPreviousSource, cbPrefix, cbPrefix + cbPreviousEdit))
+        {
+            return 0;
+        }
+        bool canReuseSuffix = CountLineTerminators(source + cbPrefix, cbEdit) == CountLineTerminators(previousSource + cbPrefix, cbPreviousEdit);
+
+        ArenaAllocator tempArena(_u("ScriptReload"), this->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
+        JsUtil::BaseDictionary<uint, FunctionBody *, ArenaAllocator> previousFunctions(&tempArena);
+        for (uint i = 0; i < previousGlobalBody->GetNestedCount(); i++)
+        {
+            FunctionProxy * proxy = previousGlobalBody->GetNestedFunctionProxy(i);
+            if (proxy != nullptr && proxy->IsFunctionBody() &&
+                !proxy->IsLambda() && !proxy->IsClassConstructor() && !proxy->IsClassMethod() && !proxy->HasSuperReference())
+            {
+                FunctionBody * function = proxy->GetFunctionBody();
+                previousFunctions.Item(function->StartOffset(), function);
+            }
+        }
+
+        uint reused = 0;
+        for (uint i = 0; i < globalBody->GetNestedCount(); i++)
+        {
+            FunctionProxy * proxy = globalBody->GetNestedFunctionProxy(i);
+            if (proxy == nullptr || proxy->IsDeferredDeserializeFunction())
+            {
+                continue;
+            }
+
+            ParseableFunctionInfo * function = proxy->GetParseableFunctionInfo();
+            size_t cbStart = function->StartOffset();
+            size_t cbEnd = cbStart + function->LengthInBytes();
+            size_t cbPreviousStart;
+            if (cbEnd <= cbPrefix)
+            {
+                cbPreviousStart = cbStart;
+            }
+            else if (canReuseSuffix && cbStart >= cbSource - cbSuffix)
+            {
+                cbPreviousStart = cbStart - cbSource + cbPreviousSource;
+
+                // The function's column numbers only survive if its first line starts after the edit.
+                if (CountLineTerminators(previousSource + cbPreviousSource - cbSuffix, cbPreviousStart - (cbPreviousSource - cbSuffix)) == 0)
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                continue;
+            }
+
+            FunctionBody * previousFunction = nullptr;
+            if (!previousFunctions.TryGetValue((uint)cbPreviousStart, &previousFunction) ||
+                previousFunction->LengthInBytes() != function->LengthInBytes() ||
+                previousFunction->GetIsStrictMode() != function->GetIsStrictMode() ||
+                previousFunction->GetIsDeclaration() != function->GetIsDeclaration() ||
+                previousFunction->GetDisplayNameLength() != function->GetDisplayNameLength() ||
+                wmemcmp(previousFunction->GetDisplayName(), function->GetDisplayName(), function->GetDisplayNameLength()) != 0 ||
+                memcmp(previousSource + cbPreviousStart, source + cbStart, function->LengthInBytes()) != 0)
+            {
+                continue;
+            }
+
+            if (function->IsDeferredParseFunction() && function->GetIsDeclaration() && !globalBody->GetSourceContextInfo()->IsDynamic())
+            {
+                sourceInfo->StopTrackingDeferredFunction(function->GetLocalFunctionId());
+            }
+            globalBody->SetNestedFunc(previousFunction->GetFunctionInfo(), i, fscrNil);
+            reused++;
+        }
+
+        OUTPUT_TRACE(Js::ScriptReloadPhase, _u("Script reload: reused %u of %u top-level functions (edit at byte %u, %u -> %u bytes)\n"),
+            reused, globalBody->GetNestedCount(), (uint)cbPrefix, (uint)cbPreviousEdit, (uint)cbEdit);
+
+        return reused;
+    }
+
     JavascriptFunction* ScriptContext::GenerateRootFunction(ParseNodePtr parseTree, uint sourceIndex, Parser* parser, uint32 grfscr, CompileScriptException * pse, const char16 *rootDisplayName)
     {
         HRESULT hr;
@@ -2301,6 +2560,29 @@ namespace Js
         }
     }
 
+    byte * ScriptContext::GetDynamicCodeCacheBufferCopy(uint64 key, const byte * buffer, DWORD size)
+    {
+        if (this->dynamicCodeCacheBuffers == nullptr)
+        {
+            this->dynamicCodeCacheBuffers = Anew(this->SourceCodeAllocator(), DynamicCodeCacheBufferMap, this->SourceCodeAllocator());
+        }
+
+        DynamicCodeCacheBuffer copy;
+        if (this->dynamicCodeCacheBuffers->TryGetValue(key, &copy) &&
+            copy.size == size &&
+            memcmp(copy.buffer, buffer, size) == 0)
+        {
+            return copy.buffer;
+        }
+
+        // The host replaced its entry. Functions deserialized from the previous copy still point into it, so it is kept.
+        copy.buffer = AnewArray(this->SourceCodeAllocator(), byte, size);
+        copy.size = size;
+        js_memcpy_s(copy.buffer, size, buffer, size);
+        this->dynamicCodeCacheBuffers->Item(key, copy);
+        return copy.buffer;
+    }
+
     void ScriptContext::EnsureDynamicSourceContextInfoMap()
     {
         if (this->cache->dynamicSourceContextInfoMap == nullptr)
@@ -5068,6 +5350,62 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("Unique opcodes: %d\n"), unique);
         }
 
+        if (byteCodeBigramHistogram != nullptr)
+        {
+            // Top pairs of adjacent one byte opcodes, the candidates for SuperInstructionList.h.
+            // Prefixed (extended or medium/large layout) ops are counted under their prefix.
+            const uint bigramCount = ByteCodeBigramOpCount * ByteCodeBigramOpCount;
+            const uint maxBigramsPrinted = 50;
+
+            Output::Print(_u("ByteCode Bigram Histogram\n"));
+            Output::Print(_u("\n"));
+
+            uint64 total = 0;
+            for (uint j = 0; j < bigramCount; j++)
+            {
+                total += byteCodeBigramHistogram[j];
+            }
+            Output::Print(_u("%9llu                     Total executed pairs\n"), total);
+            Output::Print(_u("\n"));
+
+            uint max = UINT_MAX;
+            uint printed = 0;
+            double pctcume = 0.0;
+            while (printed < maxBigramsPrinted && total != 0)
+            {
+                uint upper = 0;
+                for (uint j = 0; j < bigramCount; j++)
+                {
+                    if (byteCodeBigramHistogram[j] > upper && byteCodeBigramHistogram[j] < max)
+                    {
+                        upper = byteCodeBigramHistogram[j];
+                    }
+                }
+
+                if (upper == 0)
+                {
+                    break;
+                }
+
+                max = upper;
+                for (uint j = 0; j < bigramCount && printed < maxBigramsPrinted; j++)
+                {
+                    if (byteCodeBigramHistogram[j] == max)
+                    {
+                        OpCode first = (OpCode)(j / ByteCodeBigramOpCount);
+                        OpCode second = (OpCode)(j % ByteCodeBigramOpCount);
+                        double pct = ((double)max) / total;
+                        pctcume += pct;
+                        printed++;
+
+                        Output::Print(_u("%9u  %5.1lf  %5.1lf  %s, %s\n"), max, pct * 100, pctcume * 100,
+                            OpCodeUtil::GetOpCodeName(first), OpCodeUtil::GetOpCodeName(second));
+                    }
+                }
+            }
+            Output::Print(_u("\n"));
+        }
+
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
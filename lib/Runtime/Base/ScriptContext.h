@@ -82,7 +82,8 @@ enum LoadScriptFlag
     LoadScriptFlag_isFunction = 0x20,                   // input script is in a function scope, not global code.
     LoadScriptFlag_Utf8Source = 0x40,                   // input buffer is utf8 encoded.
     LoadScriptFlag_LibraryCode = 0x80,                  // for debugger, indicating 'not my code'
-    LoadScriptFlag_ExternalArrayBuffer = 0x100          // for ExternalArrayBuffer
+    LoadScriptFlag_ExternalArrayBuffer = 0x100,         // for ExternalArrayBuffer
+    LoadScriptFlag_ForceDeferParse = 0x200              // defer-parse all function bodies regardless of the script size (reloads).
 };
 
 class HostScriptContext
@@ -544,6 +545,17 @@ namespace Js
         PropIdSetForConstProp * intConstPropsOnGlobalUserObject;
 
         void * firstInterpreterFrameReturnAddress;
+
+        // The copies of the buffers returned by the host's dynamic code cache that deserialized functions point into,
+        // one per key, so that evaluating the same code again doesn't make another copy
+        struct DynamicCodeCacheBuffer
+        {
+            byte * buffer;
+            DWORD size;
+        };
+        typedef JsUtil::BaseDictionary<uint64, DynamicCodeCacheBuffer, ArenaAllocator> DynamicCodeCacheBufferMap;
+        DynamicCodeCacheBufferMap * dynamicCodeCacheBuffers;
+
 #ifdef SEPARATE_ARENA
         ArenaAllocator sourceCodeAllocator;
         ArenaAllocator regexAllocator;
@@ -612,7 +624,8 @@ public:
 #ifdef  PROFILE_OBJECT_LITERALS
         int objectLiteralInstanceCount;
         int objectLiteralPathCount;
-        int objectLiteralCount[TypePath::MaxPathTypeHandlerLength];
+        // Literals with MaxTinyDictionaryPathLength properties or more are counted in the last entry
+        int objectLiteralCount[TypePath::MaxTinyDictionaryPathLength];
         int objectLiteralSimpleDictionaryCount;
         uint32 objectLiteralMaxLength;
         int objectLiteralPromoteCount;
@@ -624,6 +637,10 @@ public:
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
+        // Counts of adjacent (previous, current) one byte opcodes, indexed by previous * ByteCodeBigramOpCount + current.
+        // Only allocated with -BytecodeBigramHist.
+        static const uint ByteCodeBigramOpCount = static_cast<uint>(OpCode::MaxByteSizedOpcodes) + 1;
+        uint * byteCodeBigramHistogram;
         uint32 forinCache;
         uint32 forinNoCache;
 #endif
@@ -758,6 +775,9 @@ private:
         InterpreterThunkEmitter* interpreterThunkEmitter;
 #endif
         BackgroundParser *backgroundParser;
+#if ENABLE_REGEX_NATIVE_CODE
+        EmitBufferManager<>* regexCodeBufferManager;
+#endif
 #ifdef ASMJS_PLAT
         InterpreterThunkEmitter* asmJsInterpreterThunkEmitter;
         AsmJsCodeGenerator* asmJsCodeGenerator;
@@ -989,6 +1009,13 @@ private:
         UnifiedRegex::RegexStacks *SaveRegexStacks();
         void RestoreRegexStacks(UnifiedRegex::RegexStacks *const contStack);
 
+#if ENABLE_REGEX_NATIVE_CODE
+        // Executable copies of regex programs compiled by UnifiedRegex::NativeCompiler. Returns nullptr if the code
+        // can't be placed, in which case the program stays interpreted.
+        void* AllocateRegexNativeCode(const BYTE* code, size_t size);
+        void FreeRegexNativeCode(void* address);
+#endif
+
         void InitializeGlobalObject();
         bool IsIntlEnabled();
         JavascriptLibrary* GetLibrary() const { return javascriptLibrary; }
@@ -1208,12 +1235,18 @@ private:
             const char16 *rootDisplayName, LoadScriptFlag loadScriptFlag,
             Js::Var scriptSource = nullptr);
 
+        uint ReuseUnchangedFunctions(FunctionBody * globalBody, FunctionBody * previousGlobalBody);
+
         ArenaAllocator* GeneralAllocator() { return &generalAllocator; }
 
 #ifdef ENABLE_BASIC_TELEMETRY
         ArenaAllocator* TelemetryAllocator() { return &telemetryAllocator; }
 #endif
 
+        // Returns this script context's copy of a buffer from the host's dynamic code cache, which lives as long as the
+        // script context. The copy made for the key earlier is reused when the host returned the same bytes again.
+        byte * GetDynamicCodeCacheBufferCopy(uint64 key, const byte * buffer, DWORD size);
+
 #ifdef SEPARATE_ARENA
         ArenaAllocator* SourceCodeAllocator() { return &sourceCodeAllocator; }
         ArenaAllocator* RegexAllocator() { return &regexAllocator; }
@@ -7,6 +7,7 @@
 #include "BackendApi.h"
 #include "ThreadServiceWrapper.h"
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #include "Debug/DebuggingFlags.h"
 #include "Debug/DiagProbe.h"
 #include "Debug/DebugManager.h"
@@ -15,11 +16,14 @@
 #include "CharSet.h"
 #include "CharMap.h"
 #include "StandardChars.h"
+#include "RegexFlags.h"
+#include "RegexProfiler.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
 #include "Language/SourceDynamicProfileManager.h"
 #include "Language/CodeGenRecyclableData.h"
 #include "Language/InterpreterStackFrame.h"
+#include "Language/InterpreterStack.h"
 #include "Language/JavascriptStackWalker.h"
 #include "Base/ScriptMemoryDumper.h"
 
@@ -120,6 +124,9 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     jobProcessor(nullptr),
 #endif
     interruptPoller(nullptr),
+    interpreterStack(nullptr),
+    megamorphicPropertyCache(nullptr),
+    dynamicCodeCache(nullptr),
     expirableCollectModeGcCount(-1),
     expirableObjectList(nullptr),
     expirableObjectDisposeList(nullptr),
@@ -159,6 +166,9 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     prototypeChainEnsuredToHaveOnlyWritableDataPropertiesAllocator(_u("TC-ProtoWritableProp"), GetPageAllocator(), Js::Throw::OutOfMemory),
     standardUTF8Chars(0),
     standardUnicodeChars(0),
+    regexProfiler(nullptr),
+    activeRegexProfiler(nullptr),
+    regexProfilerCount(0),
     hasUnhandledException(FALSE),
     hasCatchHandler(FALSE),
     disableImplicitFlags(DisableImplicitNoFlag),
@@ -417,6 +427,14 @@ ThreadContext::~ThreadContext()
         interruptPoller = nullptr;
     }
 
+    // The profile's arena is on the page allocator closed below
+    if (regexProfiler != nullptr)
+    {
+        HeapDelete(regexProfiler);
+        regexProfiler = nullptr;
+        activeRegexProfiler = nullptr;
+    }
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -453,6 +471,7 @@ ThreadContext::~ThreadContext()
 
         this->recyclableData->sourceProfileManagersByUrl = nullptr;
         this->recyclableData->oldEntryPointInfo = nullptr;
+        this->recyclableData->sharedRegexPrograms = nullptr;
 
         if (this->recyclableData->symbolRegistrationMap != nullptr)
         {
@@ -515,7 +534,24 @@ ThreadContext::~ThreadContext()
 
         Assert(this->debugManager == nullptr);
 
+        if (this->interpreterStack != nullptr)
+        {
+            HeapDelete(this->interpreterStack);
+            this->interpreterStack = nullptr;
+        }
+
         HeapDelete(recycler);
+
+        if (this->megamorphicPropertyCache != nullptr)
+        {
+            if (PHASE_STATS1(Js::MegamorphicPropertyCachePhase))
+            {
+                this->megamorphicPropertyCache->PrintStats();
+                Output::Flush();
+            }
+            HeapDelete(this->megamorphicPropertyCache);
+            this->megamorphicPropertyCache = nullptr;
+        }
     }
 
 #if ENABLE_NATIVE_CODEGEN
@@ -909,6 +945,22 @@ ThreadContext::FindPropertyRecord(const char16 * propertyName, int propertyNameL
     return propertyRecord;
 }
 
+const Js::PropertyRecord *
+ThreadContext::FindBoundPropertyRecordConcurrent(const char16 * propertyName, int propertyNameLength)
+{
+    Js::HashedCharacterBuffer<char16> key(propertyName, propertyNameLength);
+
+    propertyMapLock.EnterLookup(key.GetHashCode());
+    Js::PropertyRecord const * propertyRecord = propertyMap->LookupWithKey(key);
+    if (propertyRecord != nullptr && !propertyRecord->IsBound() && !Js::IsBuiltInPropertyId(propertyRecord->GetPropertyId()))
+    {
+        propertyRecord = nullptr;
+    }
+    propertyMapLock.LeaveLookup(key.GetHashCode());
+
+    return propertyRecord;
+}
+
 Js::PropertyRecord const *
 ThreadContext::UncheckedAddPropertyId(__in LPCWSTR propertyName, __in int propertyNameLength, bool bind, bool isSymbol)
 {
@@ -1006,7 +1058,10 @@ ThreadContext::UncheckedAddPropertyId(JsUtil::CharacterBuffer<WCHAR> const& prop
     }
 #endif
 
-    this->propertyMap->EnsureCapacity();
+    {
+        PropertyMapLock::AutoUpdate autoUpdate(&propertyMapLock);
+        this->propertyMap->EnsureCapacity();
+    }
 
     // Automatically bind direct (single-character) property names, so that they can be
     // stored in the direct property table
@@ -1100,7 +1155,10 @@ ThreadContext::AddPropertyRecordInternal(const Js::PropertyRecord * propertyReco
 #endif
 
     // Add to the map
-    propertyMap->Add(propertyRecord);
+    {
+        PropertyMapLock::AutoUpdate autoUpdate(&propertyMapLock);
+        propertyMap->Add(propertyRecord);
+    }
 
 #if ENABLE_NATIVE_CODEGEN
     if (m_jitNumericProperties)
@@ -1272,7 +1330,10 @@ void ThreadContext::InvalidatePropertyRecord(const Js::PropertyRecord * property
         m_jitNeedsPropertyUpdate = true;
     }
 #endif
-    this->propertyMap->Remove(propertyRecord);
+    {
+        PropertyMapLock::AutoUpdate autoUpdate(&propertyMapLock);
+        this->propertyMap->Remove(propertyRecord);
+    }
     PropertyRecordTrace(_u("Reclaimed property '%s' at 0x%08x, pid = %d\n"),
         propertyRecord->GetBuffer(), propertyRecord, propertyRecord->GetPropertyId());
 }
@@ -2510,6 +2571,10 @@ ThreadContext::PreCollectionCallBack(CollectionFlags flags)
 
     // Clean up unused memory before we start collecting
     this->CleanNoCasePropertyMap();
+    if (this->interpreterStack != nullptr)
+    {
+        this->interpreterStack->ClearUnused();
+    }
     this->TryEnterExpirableCollectMode();
 
     const BOOL concurrent = flags & CollectMode_Concurrent;
@@ -2537,6 +2602,26 @@ ThreadContext::PreCollectionCallBack(CollectionFlags flags)
     CollectionCallBack(callBackFlags);
 }
 
+Js::InterpreterStack *
+ThreadContext::GetInterpreterStack()
+{
+    if (this->interpreterStack == nullptr)
+    {
+        this->interpreterStack = HeapNew(Js::InterpreterStack, this->GetRecycler());
+    }
+    return this->interpreterStack;
+}
+
+Js::MegamorphicPropertyCache *
+ThreadContext::EnsureMegamorphicPropertyCache()
+{
+    if (this->megamorphicPropertyCache == nullptr)
+    {
+        this->megamorphicPropertyCache = HeapNew(Js::MegamorphicPropertyCache);
+    }
+    return this->megamorphicPropertyCache;
+}
+
 void
 ThreadContext::PreSweepCallback()
 {
@@ -2552,6 +2637,11 @@ ThreadContext::PreSweepCallback()
 
     ClearForInCaches();
 
+    if (this->megamorphicPropertyCache != nullptr)
+    {
+        this->megamorphicPropertyCache->ClearUnusedTypes(this->GetRecycler());
+    }
+
     this->dynamicObjectEnumeratorCacheMap.Clear();
 }
 
@@ -4231,6 +4321,20 @@ const Js::PropertyRecord* ThreadContext::AddSymbolToRegistrationMap(const char16
     return propertyRecord;
 }
 
+#if ENABLE_COPYONACCESS_ARRAY
+Js::SparseArraySegmentBase* ThreadContext::GetCopyOnAccessArraySegment(hash_t contentHash) const
+{
+    RecyclerWeakReference<Js::SparseArraySegmentBase>* weakRef = this->recyclableData->copyOnAccessArraySegments[contentHash % CopyOnAccessArraySegmentTableSize];
+    return weakRef != nullptr ? weakRef->Get() : nullptr;
+}
+
+void ThreadContext::SetCopyOnAccessArraySegment(hash_t contentHash, Js::SparseArraySegmentBase* segment)
+{
+    // This may evict another segment from the slot. That segment stays alive as long as the caches that use it do.
+    this->recyclableData->copyOnAccessArraySegments[contentHash % CopyOnAccessArraySegmentTableSize] = this->recycler->CreateWeakReferenceHandle(segment);
+}
+#endif
+
 void ThreadContext::ClearImplicitCallFlags()
 {
     SetImplicitCallFlags(Js::ImplicitCall_None);
@@ -4410,6 +4514,75 @@ UnifiedRegex::StandardChars<char16>* ThreadContext::GetStandardChars(__inout_opt
     return standardUnicodeChars;
 }
 
+bool ThreadContext::IsSharingRegexPrograms() const
+{
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    // Tracing and statistics are collected per pattern as it is compiled
+    if (REGEX_CONFIG_FLAG(RegexDebug) || REGEX_CONFIG_FLAG(RegexProfile) || REGEX_CONFIG_FLAG(RegexTracing))
+    {
+        return false;
+    }
+#endif
+    return CONFIG_FLAG(RegexProgramCacheSize) > 0;
+}
+
+UnifiedRegex::Program* ThreadContext::GetSharedRegexProgram(const UnifiedRegex::RegexKey& key) const
+{
+    UnifiedRegex::Program* program = nullptr;
+    if (IsSharingRegexPrograms() && this->recyclableData->sharedRegexPrograms != nullptr)
+    {
+        this->recyclableData->sharedRegexPrograms->TryGetValue(key, &program);
+    }
+    return program;
+}
+
+ArenaAllocator* ThreadContext::GetSharedRegexProgramAllocator()
+{
+    // Any script context may be the last to use a shared program, so its body lives as long as the thread context does.
+    // Programs are never evicted, which keeps that memory bounded by the cache size.
+    if (!IsSharingRegexPrograms() ||
+        (this->recyclableData->sharedRegexPrograms != nullptr &&
+            this->recyclableData->sharedRegexPrograms->Count() >= CONFIG_FLAG(RegexProgramCacheSize)))
+    {
+        return nullptr;
+    }
+    return GetThreadAlloc();
+}
+
+void ThreadContext::AddSharedRegexProgram(const UnifiedRegex::RegexKey& key, UnifiedRegex::Program* program)
+{
+    Assert(IsSharingRegexPrograms());
+
+    if (this->recyclableData->sharedRegexPrograms == nullptr)
+    {
+        this->recyclableData->sharedRegexPrograms = RecyclerNew(GetRecycler(), RegexProgramMap, GetRecycler());
+    }
+    this->recyclableData->sharedRegexPrograms->Item(key, program);
+}
+
+void ThreadContext::StartRegexProfiling(uint sampleInterval)
+{
+    Assert(sampleInterval != 0);
+
+    // Matchers remember their entry in the profile by the profiler's id, so a new profile gets a new id
+    UnifiedRegex::RegexProfiler* newProfiler = HeapNew(UnifiedRegex::RegexProfiler, GetPageAllocator(), ++regexProfilerCount, sampleInterval);
+    if (regexProfiler != nullptr)
+    {
+        HeapDelete(regexProfiler);
+    }
+    regexProfiler = newProfiler;
+    activeRegexProfiler = newProfiler;
+}
+
+void ThreadContext::StopRegexProfiling()
+{
+    if (regexProfiler != nullptr)
+    {
+        regexProfiler->StopCollecting();
+    }
+    activeRegexProfiler = nullptr;
+}
+
 void ThreadContext::CheckScriptInterrupt()
 {
     if (TestThreadContextFlag(ThreadContextFlagCanDisableExecution))
@@ -10,6 +10,9 @@ namespace Js
     struct InlineCache;
     class DebugManager;
     class CodeGenRecyclableData;
+    class InterpreterStack;
+    class MegamorphicPropertyCache;
+    class SparseArraySegmentBase;
     struct ReturnedValue;
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
 }
@@ -206,6 +209,19 @@ public:
 #endif
 #endif
 
+// Optional host-provided store for the serialized byte code of dynamic code (Function constructor and
+// global-scope eval). Entries are keyed by a hash of the source and the flags it was compiled with; the
+// source is passed along so the host can reject hash collisions. The store outlives script contexts,
+// so the host may persist it across processes.
+class DynamicCodeCache
+{
+public:
+    virtual bool TryGetByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte ** buffer, DWORD * bufferSize) = 0;
+    // Whether StoreByteCode keeps anything, so that code isn't serialized for a store that drops it
+    virtual bool CanStoreByteCode() const = 0;
+    virtual void StoreByteCode(uint64 key, LPCUTF8 utf8Source, size_t cbSource, const byte * buffer, DWORD bufferSize) = 0;
+};
+
 #ifdef NTBUILD
 struct ThreadContextWatsonTelemetryBlock
 {
@@ -475,6 +491,49 @@ public:
         Js::PropertyRecordStringHashComparer, JsUtil::SimpleHashedEntry, JsUtil::AsymetricResizeLock> PropertyMap;
     PropertyMap * propertyMap;
 
+private:
+    // Lets other threads look up names in the property map while the main thread changes it. A lookup holds the one stripe
+    // picked by the hash of the name, so lookups from different threads rarely contend. The main thread holds every stripe
+    // while it adds or removes a property record, which is rare next to lookups, and its own lookups don't lock at all.
+    class PropertyMapLock
+    {
+    public:
+        void EnterLookup(hash_t hashCode) { stripes[hashCode % StripeCount].Enter(); }
+        void LeaveLookup(hash_t hashCode) { stripes[hashCode % StripeCount].Leave(); }
+
+        void EnterUpdate()
+        {
+            for (uint i = 0; i < StripeCount; i++)
+            {
+                stripes[i].Enter();
+            }
+        }
+
+        void LeaveUpdate()
+        {
+            for (uint i = StripeCount; i > 0; i--)
+            {
+                stripes[i - 1].Leave();
+            }
+        }
+
+        class AutoUpdate
+        {
+        public:
+            AutoUpdate(PropertyMapLock * lock) : lock(lock) { lock->EnterUpdate(); }
+            ~AutoUpdate() { lock->LeaveUpdate(); }
+        private:
+            PropertyMapLock * lock;
+        };
+
+    private:
+        static const uint StripeCount = 8;
+        CriticalSection stripes[StripeCount];
+    };
+    PropertyMapLock propertyMapLock;
+
+public:
+
     typedef JsUtil::BaseHashSet<Js::CaseInvariantPropertyListWithHashCode*, Recycler, PowerOf2SizePolicy, Js::CaseInvariantPropertyListWithHashCode*, JsUtil::NoCaseComparer, JsUtil::SimpleDictionaryEntry>
         PropertyNoCaseSetType;
     typedef JsUtil::WeaklyReferencedKeyDictionary<Js::Type, bool> TypeHashSet;
@@ -529,6 +588,11 @@ private:
     };
 
     typedef JsUtil::BaseDictionary<const WCHAR*, SourceDynamicProfileManagerCache*, Recycler, PowerOf2SizePolicy> SourceProfileManagersByUrlMap;
+    typedef JsUtil::BaseDictionary<UnifiedRegex::RegexKey, UnifiedRegex::Program*, Recycler, PowerOf2SizePolicy> RegexProgramMap;
+
+#if ENABLE_COPYONACCESS_ARRAY
+    static const uint CopyOnAccessArraySegmentTableSize = 64;
+#endif
 
     struct RecyclableData
     {
@@ -592,11 +656,20 @@ private:
         // See ES6 (draft 22) 19.4.2.2
         SymbolRegistrationMap* symbolRegistrationMap;
 
+        // Compiled regex programs shared by all script contexts, keyed by source and flags
+        RegexProgramMap* sharedRegexPrograms;
+
         // Just holding the reference to the returnedValueList of the stepController. This way that list will not get recycled prematurely.
         Js::ReturnedValueList *returnedValueList;
 
         uint constructorCacheInvalidationCount;
 
+#if ENABLE_COPYONACCESS_ARRAY
+        // Backing segments of copy-on-access array literals, indexed by a hash of their contents. Identical literals in
+        // any script context on this thread share one segment; the segments are kept alive by the libraries' caches.
+        RecyclerWeakReference<Js::SparseArraySegmentBase>* copyOnAccessArraySegments[CopyOnAccessArraySegmentTableSize];
+#endif
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         // use for autoProxy called from Debug.setAutoProxyName. we need to keep the buffer from GetSz() alive.
         LPCWSTR autoProxyName;
@@ -785,6 +858,10 @@ private:
     //
     UnifiedRegex::StandardChars<uint8>* standardUTF8Chars;
     UnifiedRegex::StandardChars<char16>* standardUnicodeChars;
+    // Profile the host asked for, see JsStartRegexProfiling. Kept after profiling stops until it is restarted.
+    UnifiedRegex::RegexProfiler* regexProfiler;
+    UnifiedRegex::RegexProfiler* activeRegexProfiler;
+    uint regexProfilerCount;
 
     Js::ImplicitCallFlags implicitCallFlags;
 
@@ -886,6 +963,15 @@ public:
     void SetInterruptPoller(InterruptPoller *poller) { interruptPoller = poller; }
     InterruptPoller *GetInterruptPoller() const { return interruptPoller; }
     BOOL HasInterruptPoller() const { return interruptPoller != nullptr; }
+
+    Js::InterpreterStack *GetInterpreterStack();
+
+    Js::MegamorphicPropertyCache *GetMegamorphicPropertyCache() const { return megamorphicPropertyCache; }
+    Js::MegamorphicPropertyCache *EnsureMegamorphicPropertyCache();
+
+    void SetDynamicCodeCache(DynamicCodeCache *cache) { dynamicCodeCache = cache; }
+    DynamicCodeCache *GetDynamicCodeCache() const { return dynamicCodeCache; }
+
     void CheckScriptInterrupt();
     void CheckInterruptPoll();
 
@@ -1069,6 +1155,9 @@ public:
     void FindPropertyRecord(Js::JavascriptString *pstName, Js::PropertyRecord const ** propertyRecord);
     void FindPropertyRecord(__in LPCWSTR propertyName, __in int propertyNameLength, Js::PropertyRecord const ** propertyRecord);
     const Js::PropertyRecord * FindPropertyRecord(const char16 * propertyName, int propertyNameLength);
+    // May be called from any thread. Only finds property records that can't be collected (built-in or bound ones), since
+    // the caller can't keep any other record alive.
+    const Js::PropertyRecord * FindBoundPropertyRecordConcurrent(const char16 * propertyName, int propertyNameLength);
 
     JsUtil::List<const RecyclerWeakReference<Js::PropertyRecord const>*>* FindPropertyIdNoCase(Js::ScriptContext * scriptContext, LPCWSTR propertyName, int propertyNameLength);
     JsUtil::List<const RecyclerWeakReference<Js::PropertyRecord const>*>* FindPropertyIdNoCase(Js::ScriptContext * scriptContext, JsUtil::CharacterBuffer<WCHAR> const& propertyName);
@@ -1405,6 +1494,11 @@ public:
     const Js::PropertyRecord* GetSymbolFromRegistrationMap(const char16* stringKey);
     const Js::PropertyRecord* AddSymbolToRegistrationMap(const char16* stringKey, charcount_t stringLength);
 
+#if ENABLE_COPYONACCESS_ARRAY
+    Js::SparseArraySegmentBase* GetCopyOnAccessArraySegment(hash_t contentHash) const;
+    void SetCopyOnAccessArraySegment(hash_t contentHash, Js::SparseArraySegmentBase* segment);
+#endif
+
     inline void ClearPendingSOError()
     {
         this->GetPendingSOErrorObject()->ClearError();
@@ -1617,6 +1711,20 @@ public:
     UnifiedRegex::StandardChars<uint8>* GetStandardChars(__inout_opt uint8* dummy);
     UnifiedRegex::StandardChars<char16>* GetStandardChars(__inout_opt char16* dummy);
 
+    // A regex program compiled in one script context is immutable, so the others can match with it too, each with its
+    // own pattern and matcher state
+    bool IsSharingRegexPrograms() const;
+    UnifiedRegex::Program* GetSharedRegexProgram(const UnifiedRegex::RegexKey& key) const;
+    // Allocator for the body of a program about to be compiled for sharing, or null if it won't be shared
+    ArenaAllocator* GetSharedRegexProgramAllocator();
+    void AddSharedRegexProgram(const UnifiedRegex::RegexKey& key, UnifiedRegex::Program* program);
+
+    // Profiling of the regexes of all script contexts for the host. The active profiler is null unless it collects.
+    UnifiedRegex::RegexProfiler* GetRegexProfiler() const { return regexProfiler; }
+    UnifiedRegex::RegexProfiler* GetActiveRegexProfiler() const { return activeRegexProfiler; }
+    void StartRegexProfiling(uint sampleInterval);
+    void StopRegexProfiling();
+
     bool IsOptimizedForManyInstances() const { return isOptimizedForManyInstances; }
 
     void OptimizeForManyInstances(const bool optimizeForManyInstances)
@@ -1648,6 +1756,13 @@ private:
 
     InterruptPoller *interruptPoller;
 
+    Js::InterpreterStack *interpreterStack;
+
+    // Thread-wide (type, property) -> slot cache used by megamorphic property accesses; created on first use
+    Js::MegamorphicPropertyCache *megamorphicPropertyCache;
+
+    DynamicCodeCache *dynamicCodeCache;
+
     void CollectionCallBack(RecyclerCollectCallBackFlags flags);
 
     // Cache used by HostDispatch::GetBuiltInOperationFromEntryPoint
@@ -4,6 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 
-// {771a842c-80af-49ed-881c-1890d339426c}
+// {8c61dc89-1fed-42ed-960b-96c2b4a498ee}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x771a842c, 0x80af, 0x49ed, { 0x88, 0x1c, 0x18, 0x90, 0xd3, 0x39, 0x42, 0x6c } };
+{ 0x8c61dc89, 0x1fed, 0x42ed, { 0x96, 0x0b, 0x96, 0xc2, 0xb4, 0xa4, 0x98, 0xee } };
@@ -111,9 +111,24 @@ namespace Js
         return shortPrefix & 1 ? ReadExtOp(ip) : ReadByteOp(ip);
     }
 
+    // Only the interpreter executes super-instructions; everyone else reading the byte code (JIT, dumper,
+    // serializer) sees the first op of the pair and then reads the untouched second op as usual.
+    OpCode ByteCodeReader::UnfuseSuperInstruction(OpCode op)
+    {
+        switch (op)
+        {
+#define SUPER_INSTRUCTION(fused, first, second) \
+        case OpCode::fused: \
+            return OpCode::first;
+#include "SuperInstructionList.h"
+        default:
+            return op;
+        }
+    }
+
     OpCode ByteCodeReader::ReadOp(LayoutSize& layoutSize)
     {
-        OpCode op = ReadOp(m_currentLocation, layoutSize);
+        OpCode op = UnfuseSuperInstruction(ReadOp(m_currentLocation, layoutSize));
 #if ENABLE_NATIVE_CODEGEN
         Assert(!OpCodeAttr::BackEndOnly(op));
 #endif
@@ -135,12 +150,12 @@ namespace Js
     OpCode ByteCodeReader::PeekOp(LayoutSize& layoutSize) const
     {
         const byte * ip = m_currentLocation;
-        return ReadOp(ip, layoutSize);
+        return UnfuseSuperInstruction(ReadOp(ip, layoutSize));
     }
 
     OpCode ByteCodeReader::PeekOp(const byte * ip, LayoutSize& layoutSize)
     {
-        return ReadOp(ip, layoutSize);
+        return UnfuseSuperInstruction(ReadOp(ip, layoutSize));
     }
 
     OpCode ByteCodeReader::ReadByteOp(const byte*& ip)
@@ -42,6 +42,7 @@ namespace Js
     private:
         OpCode ReadOp(const byte *&ip, LayoutSize& layoutSize) const;
         OpCode ReadPrefixedOp(const byte *&ip, LayoutSize& layoutSize, OpCode prefix) const;
+        static OpCode UnfuseSuperInstruction(OpCode op);
     public:
         OpCode ReadOp(LayoutSize& layoutSize);
         OpCodeAsmJs ReadAsmJsOp(LayoutSize& layoutSize);
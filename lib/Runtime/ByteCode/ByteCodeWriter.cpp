@@ -34,6 +34,9 @@ namespace Js
         m_labelOffsets = JsUtil::List<uint, ArenaAllocator>::New(alloc);
         m_jumpOffsets = JsUtil::List<JumpInfo, ArenaAllocator>::New(alloc);
         m_loopHeaders = JsUtil::List<LoopHeaderData, ArenaAllocator>::New(alloc);
+        m_superInstructions = JsUtil::List<SuperInstructionInfo, ArenaAllocator>::New(alloc);
+        m_superInstructionFirstOp = OpCode::Nop;
+        m_doSuperInstructions = false;
         m_byteCodeData.Create(initCodeBufferSize, alloc);
         m_subexpressionNodesStack = Anew(alloc, JsUtil::Stack<SubexpressionNode>, alloc);
 
@@ -80,6 +83,10 @@ namespace Js
         m_doInterruptProbe = functionWrite->GetScriptContext()->GetThreadContext()->DoInterruptProbe(functionWrite);
         m_hasLoop = hasLoop;
         m_isInDebugMode = inDebugMode;
+
+        // The debugger steps and sets breakpoints on individual instructions, so leave the stream unfused there.
+        m_doSuperInstructions = !inDebugMode && !functionWrite->GetIsAsmjsMode() && !PHASE_OFF(Js::SuperInstructionPhase, functionWrite);
+        m_superInstructionFirstOp = OpCode::Nop;
     }
 
     template <typename T>
@@ -188,6 +195,16 @@ namespace Js
             *pnBackPatch += rootObjectStoreInlineCacheStart;
         });
 
+        // Form the super-instructions. Only the opcode byte of the first instruction of each pair is
+        // rewritten; the second instruction stays in place, so labels, statement maps, loop headers and
+        // bailout offsets that point at it remain valid.
+        m_superInstructions->Map([=](int index, SuperInstructionInfo& info)
+        {
+            Assert(info.offset < byteCount);
+            Assert(OpCodeUtil::IsSmallEncodedOpcode(info.fusedOp));
+            byteBuffer[info.offset] = (byte)info.fusedOp;
+        });
+
         //
         // Store the final trimmed byte-code on the function.
         //
@@ -279,6 +296,8 @@ namespace Js
         m_labelOffsets->Clear();
         m_jumpOffsets->Clear();
         m_loopHeaders->Clear();
+        m_superInstructions->Clear();
+        m_superInstructionFirstOp = OpCode::Nop;
         rootObjectLoadInlineCacheOffsets.Clear(m_labelOffsets->GetAllocator());
         rootObjectStoreInlineCacheOffsets.Clear(m_labelOffsets->GetAllocator());
         rootObjectLoadMethodInlineCacheOffsets.Clear(m_labelOffsets->GetAllocator());
@@ -3316,9 +3335,76 @@ StoreCommon:
 
         uint offset = EncodeT<layoutSize>(op, writer);
         Write(rawData, byteSize);
+
+        if (layoutSize == SmallLayout)
+        {
+            writer->TrackSuperInstruction(op, offset);
+        }
+        else
+        {
+            writer->m_superInstructionFirstOp = OpCode::Nop;
+        }
         return offset;
     }
 
+    OpCode ByteCodeWriter::GetSuperInstruction(OpCode first, OpCode second)
+    {
+#define SUPER_INSTRUCTION(fused, firstOp, secondOp) \
+        CompileAssert(OpCodeInfo<OpCode::fused>::Layout == OpCodeInfo<OpCode::firstOp>::Layout); \
+        if (first == OpCode::firstOp && second == OpCode::secondOp) \
+        { \
+            return OpCode::fused; \
+        }
+#include "SuperInstructionList.h"
+        return OpCode::Nop;
+    }
+
+    bool ByteCodeWriter::CanStartSuperInstruction(OpCode op)
+    {
+#define SUPER_INSTRUCTION(fused, firstOp, secondOp) \
+        if (op == OpCode::firstOp) \
+        { \
+            return true; \
+        }
+#include "SuperInstructionList.h"
+        return false;
+    }
+
+    // Called after each small-layout instruction is written. Pairs are only fused when the second
+    // instruction starts exactly where the first one ended, i.e. with no profile id, branch island or
+    // other data written in between.
+    void ByteCodeWriter::TrackSuperInstruction(OpCode op, uint offset)
+    {
+        if (!m_doSuperInstructions)
+        {
+            return;
+        }
+
+        if (m_superInstructionFirstOp != OpCode::Nop && offset == m_superInstructionFirstEnd)
+        {
+            OpCode fusedOp = GetSuperInstruction(m_superInstructionFirstOp, op);
+            if (fusedOp != OpCode::Nop)
+            {
+                m_superInstructions->Add(SuperInstructionInfo(m_superInstructionFirstOffset, fusedOp));
+
+                // Don't chain: the second instruction has to stay a plain op for the fused handler to read.
+                m_superInstructionFirstOp = OpCode::Nop;
+                return;
+            }
+        }
+
+        if (CanStartSuperInstruction(op))
+        {
+            m_superInstructionFirstOp = op;
+            m_superInstructionFirstOffset = offset;
+            m_superInstructionFirstEnd = m_byteCodeData.GetCurrentOffset();
+        }
+        else
+        {
+            m_superInstructionFirstOp = OpCode::Nop;
+        }
+    }
+
     inline void ByteCodeWriter::Data::Encode(const void* rawData, int byteSize)
     {
         AssertMsg(rawData != nullptr, "Ensure valid data for opcode");
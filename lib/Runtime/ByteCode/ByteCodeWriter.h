@@ -141,6 +141,21 @@ namespace Js
         SListBase<size_t>  rootObjectStoreInlineCacheOffsets;               // load inline cache offsets
         SListBase<size_t>  rootObjectLoadMethodInlineCacheOffsets;
 
+        // Super-instructions are formed in End() by rewriting the opcode byte of the first instruction of
+        // an adjacent small-layout pair (see SuperInstructionList.h).
+        struct SuperInstructionInfo
+        {
+            uint offset;
+            OpCode fusedOp;
+            SuperInstructionInfo() {}
+            SuperInstructionInfo(uint offset, OpCode fusedOp) : offset(offset), fusedOp(fusedOp) {}
+        };
+        JsUtil::List<SuperInstructionInfo, ArenaAllocator> * m_superInstructions;
+        OpCode m_superInstructionFirstOp;       // Last small-layout op that can start a super-instruction, or Nop
+        uint m_superInstructionFirstOffset;     // Offset of that op
+        uint m_superInstructionFirstEnd;        // Offset just past its layout
+        bool m_doSuperInstructions;
+
         FunctionBody* m_functionWrite;  // Function being written
         Data m_byteCodeData;            // Accumulated byte-code
         Data m_auxiliaryData;           // Optional accumulated auxiliary data
@@ -191,6 +206,9 @@ namespace Js
 #endif
 
         void IncreaseByteCodeCount();
+        void TrackSuperInstruction(OpCode op, uint offset);
+        static OpCode GetSuperInstruction(OpCode first, OpCode second);
+        static bool CanStartSuperInstruction(OpCode op);
         void AddJumpOffset(Js::OpCode op, ByteCodeLabel labelId, uint fieldByteOffset);
 
         RegSlot ConsumeReg(RegSlot reg);
@@ -359,7 +377,7 @@ namespace Js
         void RecordObjectRegister(RegSlot slot);
         uint GetCurrentOffset() const { return (uint)m_byteCodeData.GetCurrentOffset(); }
         DataChunk * GetCurrentChunk() const { return m_byteCodeData.GetCurrentChunk(); }
-        void SetCurrent(uint offset, DataChunk * chunk) { m_byteCodeData.SetCurrent(offset, chunk); }
+        void SetCurrent(uint offset, DataChunk * chunk) { m_superInstructionFirstOp = OpCode::Nop; m_byteCodeData.SetCurrent(offset, chunk); }
         bool ShouldIncrementCallSiteId(OpCode op);
         inline void SetCallSiteCount(Js::ProfileId callSiteId) { this->m_functionWrite->SetProfiledCallSiteCount(callSiteId); }
 
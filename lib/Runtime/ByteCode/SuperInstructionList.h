@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// NOTE: This file is intended to be "#include" multiple times.  The call site must define the macro
+// "SUPER_INSTRUCTION" to be executed for each entry.
+//
+// Each entry names a super-instruction and the adjacent pair of byte code ops it replaces. The pairs
+// were picked from the -BytecodeBigramHist output of the interpreter; both ops must use a small layout
+// and the layout of the super-instruction is the layout of the first op.
+//
+#if !defined(SUPER_INSTRUCTION)
+#error SUPER_INSTRUCTION must be defined before including this file
+#endif
+
+//                  Fused           First       Second
+SUPER_INSTRUCTION(  Ld_A_Ld_A,      Ld_A,       Ld_A)
+SUPER_INSTRUCTION(  Ld_A_Br,        Ld_A,       Br)
+SUPER_INSTRUCTION(  LdUndef_Br,     LdUndef,    Br)
+
+#undef SUPER_INSTRUCTION
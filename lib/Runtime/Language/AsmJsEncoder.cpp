@@ -107,7 +107,7 @@ namespace Js
         int bytecodeoffset = mReader.GetCurrentOffset();
 #endif
         LayoutSize layoutSize;
-        OpCodeAsmJs op = (OpCodeAsmJs)mReader.ReadOp(layoutSize);
+        OpCodeAsmJs op = mReader.ReadAsmJsOp(layoutSize);
         ip = mReader.GetIP();
 #if DBG_DUMP
         if (PHASE_TRACE(Js::AsmjsEncoderPhase, mFunctionBody))
@@ -105,7 +105,23 @@ namespace Js
                     ReturnOperationInfo ? operationInfo : nullptr,
                     propertyValueInfo))
         {
-            return false;
+            // The access may be megamorphic; check whether another site has seen this type
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TryGetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    ReturnOperationInfo ? operationInfo : nullptr,
+                    propertyValueInfo))
+            {
+                return false;
+            }
+
+            // The megamorphic cache filled in the operation info for the property it reloaded into the inline cache
+            return true;
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -217,7 +233,23 @@ namespace Js
                 ReturnOperationInfo ? operationInfo : nullptr,
                 propertyValueInfo))
         {
-            return false;
+            // The access may be megamorphic; check whether another site has seen this type
+            MegamorphicPropertyCache *const megamorphicPropertyCache =
+                requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TrySetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    ReturnOperationInfo ? operationInfo : nullptr,
+                    propertyValueInfo))
+            {
+                return false;
+            }
+
+            // The megamorphic cache filled in the operation info for the property it reloaded into the inline cache
+            return true;
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -523,6 +555,16 @@ namespace Js
                 return;
             }
         }
+        else
+        {
+            // The site has seen more than one type; share what it learned with other sites accessing this property
+            requestContext->GetThreadContext()->EnsureMegamorphicPropertyCache()->Cache(
+                type,
+                propertyId,
+                propertyIndex,
+                isInlineSlot,
+                info->IsWritable() && info->IsStoreFieldCacheEnabled());
+        }
 
         typePropertyCache->Cache(
             propertyId,
@@ -1098,6 +1098,10 @@ namespace Js
             // might have been invalidated due to a property becoming read-only.  In that case we can't re-validate an old
             // monomorphic cache.  We must allocate a new one.
             newCache->content.isPolymorphic = currentCache->content.isPopulated && currentCache->content.hasPrototypeChanged;
+            if (!ConstructorCache::IsDefault(currentCache))
+            {
+                newCache->CopyAllocationSiteInfo(currentCache);
+            }
         }
 
         // If we kept the old invalidated cache, it better be marked as polymorphic.
@@ -1137,6 +1141,58 @@ namespace Js
         Assert(IsConsistent());
     }
 
+    bool ConstructorCache::ObserveConstruction(const PropertyIndex propertyCount, const PropertyIndex inlineSlotCapacity)
+    {
+        Assert(!IsDefault(this));
+
+        if (this->observedConstructionCount < UINT16_MAX)
+        {
+            this->observedConstructionCount++;
+        }
+        this->observedPropertyCount = max(this->observedPropertyCount, propertyCount);
+
+        if (propertyCount <= inlineSlotCapacity || PHASE_OFF1(ConstructorSlackTrackingPhase))
+        {
+            return false;
+        }
+
+        // Some of the properties spilled into aux slots. Ask for enough inline slots to hold all of them in objects allocated
+        // from now on, within reason.
+        const PropertyIndex maxInlineSlotCapacity = static_cast<PropertyIndex>(
+            min(static_cast<uint32>(CONFIG_FLAG(ConstructorMaxInlineSlotCapacity)), static_cast<uint32>(UINT16_MAX)));
+        const PropertyIndex newInlineSlotCapacity =
+            DynamicTypeHandler::RoundUpInlineSlotCapacity(min(propertyCount, maxInlineSlotCapacity));
+        if (newInlineSlotCapacity <= inlineSlotCapacity || newInlineSlotCapacity <= this->requestedInlineSlotCapacity)
+        {
+            return false;
+        }
+
+        this->requestedInlineSlotCapacity = newInlineSlotCapacity;
+        if (this->inlineSlotCapacityGrowCount < UINT16_MAX)
+        {
+            this->inlineSlotCapacityGrowCount++;
+        }
+        return true;
+    }
+
+    void ConstructorCache::InvalidateForInlineSlotCapacityChange()
+    {
+        Assert(IsConsistent());
+        Assert(this->content.isPopulated);
+        Assert(this->content.updateAfterCtor);
+
+        // As long as updateAfterCtor is set, the cache hasn't been hard-coded in JIT-ed code, so we can simply drop it. The
+        // next construction takes the slow path, which replaces this cache and starts over from a root type with the newly
+        // requested inline slot capacity. Clearing updateAfterCtor keeps constructor calls that are still on the stack from
+        // updating the cache on their way out.
+        this->guard.value = CtorCacheGuardValues::Invalid;
+        this->content.pendingType = nullptr;
+        this->content.typeUpdatePending = false;
+        this->content.updateAfterCtor = false;
+        Assert(IsInvalidated());
+        Assert(IsConsistent());
+    }
+
 #if DBG_DUMP
     void ConstructorCache::Dump() const
     {
@@ -634,6 +634,13 @@ namespace Js
             ContentStruct content;
         };
 
+        // Allocation site state. The JIT never reads these, and they carry over to the cache that replaces this one after
+        // an invalidation (see EnsureValidInstance), so what was learned about the constructor isn't lost.
+        uint16 requestedInlineSlotCapacity;
+        uint16 observedPropertyCount;
+        uint16 observedConstructionCount;
+        uint16 inlineSlotCapacityGrowCount;
+
         CompileAssert(offsetof(GuardStruct, value) == offsetof(ContentStruct, type));
         CompileAssert(sizeof(((GuardStruct*)nullptr)->value) == sizeof(((ContentStruct*)nullptr)->type));
         CompileAssert(static_cast<intptr_t>(CtorCacheGuardValues::Invalid) == static_cast<intptr_t>(NULL));
@@ -641,8 +648,15 @@ namespace Js
         static ConstructorCache DefaultInstance;
 
     public:
+        // Inline slots requested for objects created by a constructor that hasn't been observed yet
+        static const uint16 DefaultInlineSlotCapacity = 8;
+
         ConstructorCache()
         {
+            this->requestedInlineSlotCapacity = DefaultInlineSlotCapacity;
+            this->observedPropertyCount = 0;
+            this->observedConstructionCount = 0;
+            this->inlineSlotCapacityGrowCount = 0;
             this->content.type = nullptr;
             this->content.scriptContext = nullptr;
             this->content.slotCount = 0;
@@ -662,6 +676,7 @@ namespace Js
         ConstructorCache(ConstructorCache const * other)
         {
             Assert(other != nullptr);
+            CopyAllocationSiteInfo(other);
             this->content.type = other->content.type;
             this->content.scriptContext = other->content.scriptContext;
             this->content.slotCount = other->content.slotCount;
@@ -812,6 +827,37 @@ namespace Js
             return this->content.inlineSlotCount;
         }
 
+        uint16 GetRequestedInlineSlotCapacity() const
+        {
+            return this->requestedInlineSlotCapacity;
+        }
+
+        uint16 GetObservedPropertyCount() const
+        {
+            return this->observedPropertyCount;
+        }
+
+        uint16 GetObservedConstructionCount() const
+        {
+            return this->observedConstructionCount;
+        }
+
+        uint16 GetInlineSlotCapacityGrowCount() const
+        {
+            return this->inlineSlotCapacityGrowCount;
+        }
+
+        void CopyAllocationSiteInfo(ConstructorCache const * other)
+        {
+            this->requestedInlineSlotCapacity = other->requestedInlineSlotCapacity;
+            this->observedPropertyCount = other->observedPropertyCount;
+            this->observedConstructionCount = other->observedConstructionCount;
+            this->inlineSlotCapacityGrowCount = other->inlineSlotCapacityGrowCount;
+        }
+
+        bool ObserveConstruction(const PropertyIndex propertyCount, const PropertyIndex inlineSlotCapacity);
+        void InvalidateForInlineSlotCapacityChange();
+
         static bool IsDefault(const ConstructorCache* constructorCache)
         {
             return constructorCache == &ConstructorCache::DefaultInstance;
@@ -102,7 +102,7 @@ EXDEF2_WMS(A1toA1Mem,               NewWithObject,              JavascriptOperat
   DEF2_WMS(A1toA1Mem,               Neg_A,                      JavascriptMath::Negate)
   DEF2_WMS(A1toA1Mem,               Not_A,                      JavascriptMath::Not)
   DEF2_WMS(A1toA1Mem,               Typeof,                     JavascriptOperators::Typeof)
-  DEF2_WMS(A1toA1Mem,               Delete_A,                   JavascriptOperators::Delete)
+EXDEF2_WMS(A1toA1Mem,               Delete_A,                   JavascriptOperators::Delete)
   DEF2_WMS(GET_ELEM_IMem,           TypeofElem,                 JavascriptOperators::TypeofElem)
   DEF2_WMS(A3toA1Mem,               Concat3,                    JavascriptOperators::Concat3)
   DEF2_WMS(A2I1toA1Mem,             NewConcatStrMulti,          JavascriptOperators::NewConcatStrMulti)
@@ -135,6 +135,8 @@ EXDEF2_WMS(A1toA1Mem,               NewWithObject,              JavascriptOperat
   DEF2_WMS(A1toA1_ALLOW_STACK,      Ld_A,                       OP_Ld_A)
   DEF2_WMS(INNERtoA1,               LdInnerScope,               OP_Ld_A)
   DEF2_WMS(XXtoA1,                  LdLocalObj,                 OP_LdLocalObj)
+  DEF3_WMS(SUPER_INSTRUCTION,       Ld_A_Ld_A,                  OP_Ld_A_Ld_A, Reg2)
+  DEF3_WMS(SUPER_INSTRUCTION,       Ld_A_Br,                    OP_Ld_A_Br, Reg2)
 EXDEF2_WMS(A1toA1_ALLOW_STACK,      UnwrapWithObj,              JavascriptOperators::OP_UnwrapWithObj)
 EXDEF2_WMS(A2toXX,                  SetComputedNameVar,         JavascriptOperators::OP_SetComputedNameVar)
   DEF2_WMS(A1toXX_ALLOW_STACK,      ChkUndecl,                  OP_ChkUndecl)
@@ -283,6 +285,7 @@ EXDEF3_WMS(CALL,                    ProfiledNewScObjectSpread,  PROFILEDOP(OP_Pr
   DEF3_WMS(CUSTOM_L_R0,             LdLen_A,                    OP_LdLen, Reg2)
   DEF3_WMS(CUSTOM_L_R0,             ProfiledLdLen_A,            PROFILEDOP(OP_ProfiledLdLen, OP_LdLen), ProfiledReg2)
   DEF2_WMS(XXtoA1Mem,               LdUndef,                    JavascriptOperators::OP_LdUndef)
+  DEF3_WMS(SUPER_INSTRUCTION,       LdUndef_Br,                 OP_LdUndef_Br, Reg1)
   DEF2_WMS(XXtoA1Mem,               LdNaN,                      JavascriptOperators::OP_LdNaN)
   DEF2_WMS(XXtoA1Mem,               LdInfinity,                 JavascriptOperators::OP_LdInfinity)
   DEF2_WMS(XXtoA1Mem,               LdTrue,                     JavascriptBoolean::OP_LdTrue)
@@ -345,8 +348,8 @@ EXDEF3_WMS(CUSTOM,                  ConsoleScopedStFld,         OP_ConsoleSetPro
   DEF2_WMS(GET_ELEM_IMem_Strict,    DeleteElemIStrict_A,        JavascriptOperators::OP_DeleteElementI)
   DEF3_WMS(CUSTOM_L_Value,          ScopedLdInst,               OP_ScopedLdInst, ElementScopedC2)
   DEF3_WMS(CUSTOM,                  ScopedInitFunc,             OP_ScopedInitFunc, ElementScopedC)
-  DEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFld,            OP_ScopedDeleteFld, ElementScopedC)
-  DEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFldStrict,      OP_ScopedDeleteFldStrict, ElementScopedC)
+EXDEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFld,            OP_ScopedDeleteFld, ElementScopedC)
+EXDEF3_WMS(CUSTOM_L_Value,          ScopedDeleteFldStrict,      OP_ScopedDeleteFldStrict, ElementScopedC)
   DEF3_WMS(CUSTOM,                  LdElemUndef,                OP_LdElementUndefined, ElementU)
 EXDEF3_WMS(CUSTOM,                  LdLocalElemUndef,           OP_LdLocalElementUndefined, ElementRootU)
   DEF2_WMS(XXtoA1,                  NewScObjectSimple,          OP_NewScObjectSimple)
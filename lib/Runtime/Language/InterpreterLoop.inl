@@ -37,6 +37,24 @@
 #define PROFILEDOP(prof, unprof) unprof
 #endif
 
+// Direct-threaded dispatch:
+// Instead of looping back to a single 'switch (op)', every handler of the main loop gets
+// an addressable label and ends by reading the next opcode and jumping through a table
+// of label addresses. Each handler thus has its own indirect branch, which the branch
+// predictor can track per opcode. The debugging loops check the step/break controllers
+// before every opcode, and asm.js has its own handler macros, so they keep the switch.
+#if defined(INTERPRETER_THREADED_DISPATCH) && !defined(INTERPRETER_ASMJS) && !DEBUGGING_LOOP && !defined(ENABLE_BASIC_TELEMETRY)
+#define THREADED_LOOP 1
+#define THREADED_LABEL(opcode) ThreadedOp_##opcode
+#define THREADED_DISPATCH() \
+    op = READ_OP(ip); \
+    goto *dispatchTable[(byte)op]
+#define LOOP_CASE(opcode) case INTERPRETER_OPCODE::opcode: THREADED_LABEL(opcode):
+#else
+#define THREADED_LOOP 0
+#define LOOP_CASE(opcode) case INTERPRETER_OPCODE::opcode:
+#endif
+
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
 #define CONCAT_TOKENS(loopName, fnSuffix) CONCAT_TOKENS_AGAIN(loopName, fnSuffix)
@@ -183,9 +201,63 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     // For checked builds this does mean we are incrementing 2 different counters to
     // track the ip.
     const byte* ip = m_reader.GetIP();
+
+#if THREADED_LOOP
+    // The table is filled in once per loop flavor. Racing threads store identical values,
+    // and the flag is only published after the barrier.
+    static void * dispatchTable[UCHAR_MAX + 1];
+    static bool dispatchTableInitialized = false;
+    if (!dispatchTableInitialized)
+    {
+        for (uint i = 0; i < _countof(dispatchTable); i++)
+        {
+            dispatchTable[i] = &&ThreadedOp_Invalid;
+        }
+
+#define THREADED_TABLE_ENTRY(opcode) \
+        CompileAssert((uint)INTERPRETER_OPCODE::opcode <= UCHAR_MAX); \
+        dispatchTable[(uint)INTERPRETER_OPCODE::opcode] = &&THREADED_LABEL(opcode);
+#define DEF2(x, op, func) THREADED_TABLE_ENTRY(op)
+#define DEF3(x, op, func, y) THREADED_TABLE_ENTRY(op)
+#define DEF2_WMS(x, op, func) THREADED_TABLE_ENTRY(op)
+#define DEF3_WMS(x, op, func, y) THREADED_TABLE_ENTRY(op)
+#define DEF4_WMS(x, op, func, y, t) THREADED_TABLE_ENTRY(op)
+#include "InterpreterHandler.inl"
+        THREADED_TABLE_ENTRY(Ret)
+        THREADED_TABLE_ENTRY(Yield)
+        THREADED_TABLE_ENTRY(Leave)
+        THREADED_TABLE_ENTRY(LeaveNull)
+        THREADED_TABLE_ENTRY(ExtendedOpcodePrefix)
+        THREADED_TABLE_ENTRY(ExtendedMediumLayoutPrefix)
+        THREADED_TABLE_ENTRY(ExtendedLargeLayoutPrefix)
+        THREADED_TABLE_ENTRY(MediumLayoutPrefix)
+        THREADED_TABLE_ENTRY(LargeLayoutPrefix)
+        THREADED_TABLE_ENTRY(EndOfBlock)
+        THREADED_TABLE_ENTRY(Break)
+#undef THREADED_TABLE_ENTRY
+
+        MemoryBarrier();
+        dispatchTableInitialized = true;
+    }
+
+    // Handlers expanded in this loop label themselves and dispatch the next opcode directly.
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_OPCODE_NEXT
+#define PROCESS_OPCODE_LABEL(name) THREADED_LABEL(name):
+#define PROCESS_OPCODE_NEXT THREADED_DISPATCH()
+
+    INTERPRETER_OPCODE op;
+#endif
+
     while (true)
     {
+#if THREADED_LOOP
+        // Only the first opcode and the few cases below that still 'break' out of the
+        // switch come through here.
+        THREADED_DISPATCH();
+#else
         INTERPRETER_OPCODE op = READ_OP(ip);
+#endif
 
 #ifdef ENABLE_BASIC_TELEMETRY
         if( TELEMETRY_OPCODE_OFFSET_ENABLED )
@@ -274,7 +346,7 @@ SWAP_BP_FOR_OPCODE:
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        LOOP_CASE(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -291,7 +363,7 @@ SWAP_BP_FOR_OPCODE:
             }
 
 #ifndef INTERPRETER_ASMJS
-        case INTERPRETER_OPCODE::Yield:
+        LOOP_CASE(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -307,13 +379,13 @@ SWAP_BP_FOR_OPCODE:
 #include "InterpreterHandler.inl"
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Leave:
+            LOOP_CASE(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            LOOP_CASE(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
@@ -335,7 +407,7 @@ SWAP_BP_FOR_OPCODE:
 #endif
 
 #define ExtendedCase(opcode) \
-            case INTERPRETER_OPCODE::opcode: \
+            LOOP_CASE(opcode) \
                 ip = PROCESS_OPCODE_FN_NAME(opcode)(ip); \
                 CHECK_SWITCH_PROFILE_MODE(); \
                 break;
@@ -343,7 +415,7 @@ SWAP_BP_FOR_OPCODE:
             ExtendedCase(ExtendedMediumLayoutPrefix)
             ExtendedCase(ExtendedLargeLayoutPrefix)
 
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            LOOP_CASE(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(MediumLayoutPrefix)(ip, yieldValue);
@@ -352,7 +424,7 @@ SWAP_BP_FOR_OPCODE:
                 break;
             }
 
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            LOOP_CASE(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(LargeLayoutPrefix)(ip, yieldValue);
@@ -361,7 +433,7 @@ SWAP_BP_FOR_OPCODE:
                 break;
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            LOOP_CASE(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -387,7 +459,7 @@ SWAP_BP_FOR_OPCODE:
             }
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Break:
+            LOOP_CASE(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -468,6 +540,9 @@ SWAP_BP_FOR_OPCODE:
             }
 #endif
             default:
+#if THREADED_LOOP
+            ThreadedOp_Invalid:
+#endif
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -475,6 +550,13 @@ SWAP_BP_FOR_OPCODE:
         }
     }
 }
+
+#if THREADED_LOOP
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_OPCODE_NEXT
+#define PROCESS_OPCODE_LABEL(name)
+#define PROCESS_OPCODE_NEXT break
+#endif
 #if defined (DBG)
 // Restore optimizations to what's specified by the /O switch.
 #pragma optimize("", on)
@@ -488,3 +570,7 @@ SWAP_BP_FOR_OPCODE:
 #undef INTERPRETER_OPCODE
 #undef CHECK_SWITCH_PROFILE_MODE
 #undef CHECK_YIELD_VALUE
+#undef THREADED_LOOP
+#undef THREADED_LABEL
+#undef THREADED_DISPATCH
+#undef LOOP_CASE
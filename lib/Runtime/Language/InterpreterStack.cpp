@@ -0,0 +1,115 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "RuntimeLanguagePch.h"
+#include "Language/InterpreterStack.h"
+
+namespace Js
+{
+    InterpreterStack::InterpreterStack(Recycler * recycler)
+        : recycler(recycler),
+        firstSegment(nullptr),
+        currentSegment(nullptr),
+        top(nullptr)
+    {
+        this->arena = recycler->CreateGuestArena(_u("InterpreterStack"), Throw::OutOfMemory);
+    }
+
+    InterpreterStack::~InterpreterStack()
+    {
+        AssertMsg(currentSegment == nullptr, "Interpreter frames still allocated");
+        recycler->DeleteGuestArena(this->arena);
+    }
+
+    InterpreterStack::Segment * InterpreterStack::NewSegment()
+    {
+        Segment * segment = (Segment *)this->arena->Alloc(sizeof(Segment) + SegmentVarCount * sizeof(Var));
+        segment->next = nullptr;
+        segment->end = segment->GetStart() + SegmentVarCount;
+        segment->savedTop = segment->GetStart();
+        segment->highWater = segment->GetStart();
+        return segment;
+    }
+
+    Var * InterpreterStack::Alloc(size_t varCount, Mark * mark)
+    {
+        varCount = ::Math::Align<size_t>(varCount, VarAlignment);
+        if (varCount > SegmentVarCount)
+        {
+            return nullptr;
+        }
+
+        mark->segment = this->currentSegment;
+        mark->top = this->top;
+
+        if (this->currentSegment == nullptr || (size_t)(this->currentSegment->end - this->top) < varCount)
+        {
+            // Move on to the next segment, keeping the old ones around for the next deep recursion.
+            Segment * nextSegment;
+            if (this->currentSegment == nullptr)
+            {
+                if (this->firstSegment == nullptr)
+                {
+                    this->firstSegment = NewSegment();
+                }
+                nextSegment = this->firstSegment;
+            }
+            else
+            {
+                if (this->currentSegment->next == nullptr)
+                {
+                    this->currentSegment->next = NewSegment();
+                }
+                this->currentSegment->savedTop = this->top;
+                nextSegment = this->currentSegment->next;
+            }
+
+            this->currentSegment = nextSegment;
+            this->top = nextSegment->GetStart();
+        }
+
+        Var * allocation = this->top;
+        this->top += varCount;
+        if (this->top > this->currentSegment->highWater)
+        {
+            this->currentSegment->highWater = this->top;
+        }
+        return allocation;
+    }
+
+    void InterpreterStack::Release(const Mark& mark)
+    {
+        this->currentSegment = mark.segment;
+        this->top = mark.top;
+    }
+
+    void InterpreterStack::ClearUnused()
+    {
+        bool pastCurrentSegment = (this->currentSegment == nullptr);
+        for (Segment * segment = this->firstSegment; segment != nullptr; segment = segment->next)
+        {
+            Var * liveEnd;
+            if (pastCurrentSegment)
+            {
+                liveEnd = segment->GetStart();
+            }
+            else if (segment == this->currentSegment)
+            {
+                liveEnd = this->top;
+                pastCurrentSegment = true;
+            }
+            else
+            {
+                liveEnd = segment->savedTop;
+            }
+
+            if (segment->highWater > liveEnd)
+            {
+                memset(liveEnd, 0, (segment->highWater - liveEnd) * sizeof(Var));
+                segment->highWater = liveEnd;
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+namespace Js
+{
+    //
+    // Contiguous, bump-allocated storage for interpreter frames, one per ThreadContext.
+    //
+    // InterpreterStackFrame::InterpreterHelper pushes a frame's locals, temps and out-param area here instead of
+    // _alloca'ing them, and pops them in LIFO order when the call returns (or unwinds). Generator and async
+    // function frames outlive the call and stay on the recycler heap; frames that hold stack nested functions
+    // stay on the native stack since boxing relies on ThreadContext::IsOnStack.
+    //
+    // The storage is carved out of a recycler guest arena in fixed-size segments so the GC finds the roots in
+    // live frames. Space above the top of each segment is cleared before a collection so that dead frames
+    // don't keep objects alive.
+    //
+    class InterpreterStack
+    {
+    public:
+        static const size_t SegmentVarCount = 16 * 1024;
+        // Keep frames aligned as _alloca would.
+        static const size_t VarAlignment = 16 / sizeof(Var);
+
+    private:
+        struct Segment
+        {
+            Segment * next;
+            Var * end;
+            Var * savedTop;     // Top of the stack in this segment when a later segment became current
+            Var * highWater;    // Highest top since the last ClearUnused
+
+            Var * GetStart() { return reinterpret_cast<Var *>(this + 1); }
+        };
+
+    public:
+        class Mark
+        {
+            friend class InterpreterStack;
+            Segment * segment;
+            Var * top;
+        };
+
+        class AutoAllocation
+        {
+        public:
+            AutoAllocation() : stack(nullptr), allocation(nullptr) {}
+            ~AutoAllocation()
+            {
+                if (allocation != nullptr)
+                {
+                    stack->Release(mark);
+                }
+            }
+
+            Var * Alloc(InterpreterStack * stack, size_t varCount)
+            {
+                Assert(this->allocation == nullptr);
+                this->stack = stack;
+                this->allocation = stack->Alloc(varCount, &mark);
+                return this->allocation;
+            }
+
+        private:
+            InterpreterStack * stack;
+            Var * allocation;
+            Mark mark;
+        };
+
+        InterpreterStack(Recycler * recycler);
+        ~InterpreterStack();
+
+        // Returns nullptr if the frame doesn't fit in a segment; the caller falls back to the old allocation paths.
+        Var * Alloc(size_t varCount, Mark * mark);
+        void Release(const Mark& mark);
+
+        // Called before a collection
+        void ClearUnused();
+
+    private:
+        Segment * NewSegment();
+
+        Recycler * recycler;
+        ArenaAllocator * arena;
+        Segment * firstSegment;
+        Segment * currentSegment;
+        Var * top;
+    };
+}
@@ -133,6 +133,9 @@ namespace Js
 #if DBG || DBG_DUMP
         void * DEBUG_currentByteOffset;
 #endif
+#if DBG_DUMP
+        Js::OpCode DEBUG_previousOpCode;  // For -BytecodeBigramHist
+#endif
 
         // Asm.js stack pointer
         int* m_localIntSlots;
@@ -423,6 +426,9 @@ namespace Js
         RecyclableObject * OP_CallGetFunc(Var target);
 
         template <class T> const byte * OP_Br(const unaligned T * playout);
+        template <class T> const byte * OP_Ld_A_Ld_A(const unaligned T * playout, const byte * ip);
+        template <class T> const byte * OP_Ld_A_Br(const unaligned T * playout, const byte * ip);
+        template <class T> const byte * OP_LdUndef_Br(const unaligned T * playout, const byte * ip);
         void OP_AsmStartCall(const unaligned OpLayoutStartCall * playout);
         void OP_StartCall( const unaligned OpLayoutStartCall * playout );
         void OP_StartCall(uint outParamCount);
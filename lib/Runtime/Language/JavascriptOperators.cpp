@@ -6030,7 +6030,9 @@ CommonNumber:
         RecyclableObject* prototype = JavascriptOperators::GetPrototypeObjectForConstructorCache(function, constructorScriptContext, prototypeCanBeCached);
         prototype = RecyclableObject::FromVar(CrossSite::MarshalVar(requestContext, prototype));
 
-        DynamicObject* newObject = requestContext->GetLibrary()->CreateObject(prototype, 8);
+        // Until the constructor has been observed, this is ConstructorCache::DefaultInlineSlotCapacity. Slack tracking raises it if
+        // the constructor adds more properties than that (see UpdateNewScObjectCache).
+        DynamicObject* newObject = requestContext->GetLibrary()->CreateObject(prototype, constructorCache->GetRequestedInlineSlotCapacity());
 
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(newObject));
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -6149,6 +6151,37 @@ CommonNumber:
 
         Assert(constructorCache->GetGuardValueAsType() != nullptr);
 
+        // Slack tracking: while the cached type isn't final, watch how many properties the constructor adds. If they no longer fit
+        // in the inline slots, drop the cache so that the next construction starts over from a root type with more inline slots.
+        // The cached type is finalized (and its inline slot capacity shrunk to fit) only once the constructor has been observed
+        // without outgrowing its objects ConstructorCallsRequiredToFinalizeCachedType times in a row.
+        if (!finalizeCachedType && DynamicType::Is(RecyclableObject::FromVar(instance)->GetTypeId()))
+        {
+            DynamicTypeHandler* typeHandler = DynamicObject::FromVar(instance)->GetTypeHandler();
+            const PropertyIndex inlineSlotCapacity = typeHandler->GetInlineSlotCapacity();
+
+            // Objects that were not allocated from this cache (e.g. returned from the constructor) say nothing about it.
+            if (inlineSlotCapacity == static_cast<PropertyIndex>(constructorCache->GetInlineSlotCount()) &&
+                constructorCache->ObserveConstruction(
+                    static_cast<PropertyIndex>(min(typeHandler->GetPropertyCount(), static_cast<int>(UINT16_MAX))),
+                    inlineSlotCapacity))
+            {
+                constructorCache->InvalidateForInlineSlotCapacityChange();
+#if DBG_DUMP
+                TraceUpdateConstructorCache(constructorCache, constructorBody, false, _u("because objects outgrew their inline slots"));
+                if (Js::Configuration::Global.flags.Trace.IsEnabled(Js::ConstructorSlackTrackingPhase))
+                {
+                    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+                    Output::Print(_u("Constructor slack tracking: Function:%04s Properties:%d Inline slots before:%d Requested:%d\n"),
+                        constructorBody->GetDebugNumberSet(debugStringBuffer), typeHandler->GetPropertyCount(), inlineSlotCapacity,
+                        constructorCache->GetRequestedInlineSlotCapacity());
+                    Output::Flush();
+                }
+#endif
+                return;
+            }
+        }
+
         if (DynamicType::Is(RecyclableObject::FromVar(instance)->GetTypeId()))
         {
             DynamicObject *object = DynamicObject::FromVar(instance);
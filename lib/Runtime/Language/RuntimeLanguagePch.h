@@ -37,6 +37,7 @@
 #include "Library/ArgumentsObject.h"
 
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #include "Library/JavascriptVariantDate.h"
 #include "Library/JavascriptProxy.h"
 #include "Library/JavascriptSymbol.h"
@@ -124,6 +124,23 @@ namespace Js
         const char16 * GetSz() override sealed;
         void Append(JavascriptString* str);
 
+        // Calls fn with each item, in the order the items were appended
+        template <typename Fn>
+        void MapItems(Fn fn) const
+        {
+            if (m_prevChunk != nullptr)
+            {
+                m_prevChunk->MapItems(fn);
+            }
+            for (int i = 0; i < m_count; ++i)
+            {
+                if (m_slots[i] != nullptr)
+                {
+                    fn(m_slots[i]);
+                }
+            }
+        }
+
     private:
         // MAX number of slots in one chunk. Until we fit into this, we realloc, otherwise create new chunk.
         static const int c_maxChunkSlotCount = 1024;
@@ -7,6 +7,7 @@
 #include <strsafe.h>
 #endif
 #include "ByteCode/ByteCodeApi.h"
+#include "ByteCode/ByteCodeSerializer.h"
 #include "Exceptions/EvalDisabledException.h"
 
 #include "Types/PropertyIndexRanges.h"
@@ -869,21 +870,13 @@ namespace Js
             Assert(cbSource + 1 <= cbUtf8Buffer);
 
             SRCINFO const * pSrcInfo = scriptContext->GetModuleSrcInfo(moduleID);
-            // Source Info objects are kept alive by the function bodies that are referencing it
-            // The function body is created in GenerateByteCode but the source info isn't passed in, only the index
-            // So we need to pin it here (TODO: Change GenerateByteCode to take in the sourceInfo itself)
-            ENTER_PINNED_SCOPE(Utf8SourceInfo, sourceInfo);
-            sourceInfo = Utf8SourceInfo::New(scriptContext, utf8Source, cchSource,
-              cbSource, pSrcInfo, ((grfscr & fscrIsLibraryCode) != 0), nullptr);
-
-            Parser parser(scriptContext, strictMode);
-            bool forceNoNative = false;
-
-            ParseNodePtr parseTree;
-
             SourceContextInfo * sourceContextInfo = pSrcInfo->sourceContextInfo;
+
+            // The byte code serializer needs fully compiled function bodies, so don't defer parsing of
+            // dynamic code that may be stored in the host's cache.
+            DynamicCodeCache * dynamicCodeCache = GetDynamicCodeCache(scriptContext, grfscr, isIndirect);
             ULONG deferParseThreshold = Parser::GetDeferralThreshold(sourceContextInfo->IsSourceProfileLoaded());
-            if ((ULONG)sourceLength > deferParseThreshold && !PHASE_OFF1(Phase::DeferParsePhase))
+            if (dynamicCodeCache == nullptr && (ULONG)sourceLength > deferParseThreshold && !PHASE_OFF1(Phase::DeferParsePhase))
             {
                 // Defer function bodies declared inside large dynamic blocks.
                 grfscr |= fscrDeferFncParse;
@@ -891,32 +884,66 @@ namespace Js
 
             grfscr = grfscr | fscrDynamicCode;
 
-            // fscrEval signifies direct eval in parser
-            hrParser = parser.ParseCesu8Source(&parseTree, utf8Source, cbSource, isIndirect ? grfscr & ~fscrEval : grfscr, &se, &sourceContextInfo->nextLocalFunctionId,
-                sourceContextInfo);
-            sourceInfo->SetParseFlags(grfscr);
+            uint64 dynamicCodeCacheKey = 0;
+            if (dynamicCodeCache != nullptr)
+            {
+                dynamicCodeCacheKey = GetDynamicCodeCacheKey(utf8Source, cbSource, moduleID, grfscr, isIndirect, strictMode);
+                funcBody = LoadFromDynamicCodeCache(scriptContext, dynamicCodeCache, dynamicCodeCacheKey, utf8Source, cbSource, pSrcInfo, grfscr);
+            }
 
-            if (SUCCEEDED(hrParser) && parseTree)
+            if (funcBody == nullptr)
             {
-                // This keeps function bodies generated by the byte code alive till we return
-                Js::AutoDynamicCodeReference dynamicFunctionReference(scriptContext);
+                // Source Info objects are kept alive by the function bodies that are referencing it
+                // The function body is created in GenerateByteCode but the source info isn't passed in, only the index
+                // So we need to pin it here (TODO: Change GenerateByteCode to take in the sourceInfo itself)
+                ENTER_PINNED_SCOPE(Utf8SourceInfo, sourceInfo);
+                sourceInfo = Utf8SourceInfo::New(scriptContext, utf8Source, cchSource,
+                  cbSource, pSrcInfo, ((grfscr & fscrIsLibraryCode) != 0), nullptr);
 
-                Assert(cchSource < MAXLONG);
-                uint sourceIndex = scriptContext->SaveSourceNoCopy(sourceInfo, cchSource, true);
+                Parser parser(scriptContext, strictMode);
+                bool forceNoNative = false;
 
-                // Tell byte code gen not to attempt to interact with the caller's context if this is indirect eval.
-                // TODO: Handle strict mode.
-                if (isIndirect &&
-                    !strictMode &&
-                    !parseTree->sxFnc.GetStrictMode())
+                ParseNodePtr parseTree;
+
+                // fscrEval signifies direct eval in parser
+                hrParser = parser.ParseCesu8Source(&parseTree, utf8Source, cbSource, isIndirect ? grfscr & ~fscrEval : grfscr, &se, &sourceContextInfo->nextLocalFunctionId,
+                    sourceContextInfo);
+                sourceInfo->SetParseFlags(grfscr);
+
+                if (SUCCEEDED(hrParser) && parseTree)
                 {
-                    grfscr &= ~fscrEval;
+                    // This keeps function bodies generated by the byte code alive till we return
+                    Js::AutoDynamicCodeReference dynamicFunctionReference(scriptContext);
+
+                    Assert(cchSource < MAXLONG);
+                    uint sourceIndex = scriptContext->SaveSourceNoCopy(sourceInfo, cchSource, true);
+
+                    // Tell byte code gen not to attempt to interact with the caller's context if this is indirect eval.
+                    // TODO: Handle strict mode.
+                    if (isIndirect &&
+                        !strictMode &&
+                        !parseTree->sxFnc.GetStrictMode())
+                    {
+                        grfscr &= ~fscrEval;
+                    }
+                    hrCodeGen = GenerateByteCode(parseTree, grfscr, scriptContext, &funcBody, sourceIndex, forceNoNative, &parser, &se);
+                    sourceInfo->SetByteCodeGenerationFlags(grfscr);
+
+                    // Strict indirect eval keeps fscrEval and is compiled against the caller's frame shape,
+                    // so only code that no longer depends on its caller is handed to the host.
+                    if (dynamicCodeCache != nullptr &&
+                        dynamicCodeCache->CanStoreByteCode() &&
+                        SUCCEEDED(hrCodeGen) &&
+                        se.ei.scode != JSERR_AsmJsCompileError &&
+                        (grfscr & fscrEval) == 0 &&
+                        funcBody->IsFunctionBody())
+                    {
+                        StoreToDynamicCodeCache(scriptContext, dynamicCodeCache, dynamicCodeCacheKey, utf8Source, cbSource, pSrcInfo, funcBody->GetFunctionBody());
+                    }
                 }
-                hrCodeGen = GenerateByteCode(parseTree, grfscr, scriptContext, &funcBody, sourceIndex, forceNoNative, &parser, &se);
-                sourceInfo->SetByteCodeGenerationFlags(grfscr);
-            }
 
-            LEAVE_PINNED_SCOPE();
+                LEAVE_PINNED_SCOPE();
+            }
         }
         END_TRANSLATE_EXCEPTION_TO_HRESULT(hr);
         END_LEAVE_SCRIPT_INTERNAL(scriptContext);
@@ -1005,6 +1032,110 @@ namespace Js
         }
     }
 
+    DynamicCodeCache * GlobalObject::GetDynamicCodeCache(ScriptContext *scriptContext, uint32 grfscr, BOOL isIndirect)
+    {
+        DynamicCodeCache * cache = scriptContext->GetThreadContext()->GetDynamicCodeCache();
+        if (cache == nullptr || PHASE_OFF1(Js::DynamicCodeCachePhase))
+        {
+            return nullptr;
+        }
+
+        // Direct eval is compiled against the scope of its caller, and library code and code compiled for
+        // the debugger need their own source registration, so only the Function constructor and
+        // global-scope eval go through the host's cache.
+        if (!isIndirect ||
+            (grfscr & fscrIsLibraryCode) != 0 ||
+            scriptContext->IsScriptContextInSourceRundownOrDebugMode())
+        {
+            return nullptr;
+        }
+
+#if ENABLE_TTD
+        if (scriptContext->IsTTDRecordModeEnabled() || scriptContext->ShouldPerformReplayAction())
+        {
+            return nullptr;
+        }
+#endif
+
+        return cache;
+    }
+
+    uint64 GlobalObject::GetDynamicCodeCacheKey(LPCUTF8 utf8Source, size_t cbSource, ModuleID moduleID, uint32 grfscr, BOOL isIndirect, BOOL strictMode)
+    {
+        // 64-bit FNV-1a over the source, followed by the flags that determine the shape of the generated code.
+        // The key has to be stable across processes, so nothing address- or context-dependent goes in.
+        const uint64 prime = 0x100000001b3ull;
+        uint64 hash = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < cbSource; i++)
+        {
+            hash = (hash ^ utf8Source[i]) * prime;
+        }
+
+        hash = (hash ^ grfscr) * prime;
+        hash = (hash ^ (uint32)moduleID) * prime;
+        hash = (hash ^ ((isIndirect ? 1 : 0) | (strictMode ? 2 : 0))) * prime;
+        return hash;
+    }
+
+    FunctionBody * GlobalObject::LoadFromDynamicCodeCache(ScriptContext *scriptContext, DynamicCodeCache *cache, uint64 key, LPCUTF8 utf8Source, size_t cbSource, SRCINFO const *pSrcInfo, uint32 grfscr)
+    {
+        const byte * cachedBuffer = nullptr;
+        DWORD cachedBufferSize = 0;
+        if (!cache->TryGetByteCode(key, utf8Source, cbSource, &cachedBuffer, &cachedBufferSize) || cachedBuffer == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The deserialized functions keep pointing into the buffer and the source, so copy both: the buffer lives as
+        // long as the script context, which keeps one copy per key, and the source as long as the functions referencing it.
+        byte * buffer = scriptContext->GetDynamicCodeCacheBufferCopy(key, cachedBuffer, cachedBufferSize);
+
+        utf8char_t * source = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), utf8char_t, cbSource + 1);
+        js_memcpy_s(source, cbSource + 1, utf8Source, cbSource + 1);
+
+        uint32 flags = CONFIG_FLAG(CreateFunctionProxy) && !scriptContext->IsProfiling() ? fscrAllowFunctionProxy : 0;
+        FunctionBody * funcBody = nullptr;
+        HRESULT hr = ByteCodeSerializer::DeserializeFromBuffer(scriptContext, flags, source, pSrcInfo, buffer, nullptr, &funcBody);
+        if (FAILED(hr))
+        {
+            // Stale or foreign entry (e.g. written by a different engine build). Fall back to compiling from source.
+            return nullptr;
+        }
+
+        // Only code that was compiled without fscrEval is stored, see DefaultEvalHelper.
+        Utf8SourceInfo * sourceInfo = funcBody->GetUtf8SourceInfo();
+        sourceInfo->SetParseFlags(grfscr);
+        sourceInfo->SetByteCodeGenerationFlags(grfscr & ~fscrEval);
+        return funcBody;
+    }
+
+    void GlobalObject::StoreToDynamicCodeCache(ScriptContext *scriptContext, DynamicCodeCache *cache, uint64 key, LPCUTF8 utf8Source, size_t cbSource, SRCINFO const *pSrcInfo, FunctionBody *funcBody)
+    {
+        if (cbSource > UINT32_MAX)
+        {
+            return;
+        }
+
+        byte * buffer = nullptr;
+        DWORD bufferSize = 0;
+        HRESULT hr;
+
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("DynamicCodeCache"));
+        hr = ByteCodeSerializer::SerializeToBuffer(scriptContext, tempAllocator, static_cast<DWORD>(cbSource), utf8Source,
+            funcBody, pSrcInfo, true, &buffer, &bufferSize);
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+
+        if (SUCCEEDED(hr) && buffer != nullptr)
+        {
+            cache->StoreByteCode(key, utf8Source, cbSource, buffer, bufferSize);
+        }
+
+        if (buffer != nullptr)
+        {
+            CoTaskMemFree(buffer);
+        }
+    }
+
 #ifdef IR_VIEWER
     Var GlobalObject::IRDumpEvalHelper(ScriptContext* scriptContext, const char16 *source,
         int sourceLength, ModuleID moduleID, uint32 grfscr, LPCOLESTR pszTitle,
@@ -160,6 +160,11 @@ namespace Js
     private:
         static BOOL MatchPatternHelper(JavascriptString *propertyName, JavascriptString *pattern, ScriptContext *scriptContext);
 
+        static DynamicCodeCache * GetDynamicCodeCache(ScriptContext *scriptContext, uint32 grfscr, BOOL isIndirect);
+        static uint64 GetDynamicCodeCacheKey(LPCUTF8 utf8Source, size_t cbSource, ModuleID moduleID, uint32 grfscr, BOOL isIndirect, BOOL strictMode);
+        static FunctionBody * LoadFromDynamicCodeCache(ScriptContext *scriptContext, DynamicCodeCache *cache, uint64 key, LPCUTF8 utf8Source, size_t cbSource, SRCINFO const *pSrcInfo, uint32 grfscr);
+        static void StoreToDynamicCodeCache(ScriptContext *scriptContext, DynamicCodeCache *cache, uint64 key, LPCUTF8 utf8Source, size_t cbSource, SRCINFO const *pSrcInfo, FunctionBody *funcBody);
+
     private:
         RecyclableObject* directHostObject;
         RecyclableObject* secureDirectHostObject;
@@ -17,8 +17,6 @@ namespace JSON
     Js::FunctionInfo EntryInfo::Stringify(JSON::Stringify, Js::FunctionInfo::ErrorOnNew);
     Js::FunctionInfo EntryInfo::Parse(JSON::Parse, Js::FunctionInfo::ErrorOnNew);
 
-    Js::Var Parse(Js::JavascriptString* input, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext);
-
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -54,10 +52,10 @@ namespace JSON
             reviver = Js::RecyclableObject::FromVar(args[2]);
         }
 
-        return Parse(input, reviver, scriptContext);
+        return Parse(input->GetSz(), input->GetLength(), reviver, scriptContext);
     }
 
-    Js::Var Parse(Js::JavascriptString* input, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext)
+    Js::Var Parse(LPCWSTR str, charcount_t length, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext)
     {
         // alignment required because of the union in JSONParser::m_token
         __declspec (align(8)) JSONParser parser(scriptContext, reviver);
@@ -65,7 +63,7 @@ namespace JSON
 
         TryFinally([&]()
         {
-            result = parser.Parse(input);
+            result = parser.Parse(str, length);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             if (CONFIG_FLAG(ForceGCAfterJSONParse))
@@ -146,6 +144,8 @@ namespace JSON
         return tableLen;
     }
 
+    Js::Var StringifyValue(StringifySession& stringifySession, Js::Var value, Js::Var space, Js::ScriptContext* scriptContext);
+
     BVSparse<ArenaAllocator>* AllocateMap(ArenaAllocator *tempAlloc)
     {
         //To escape error C2712: Cannot use __try in functions that require object unwinding
@@ -316,6 +316,21 @@ namespace JSON
             }
         }
 
+        result = StringifyValue(stringifySession, value, space, scriptContext);
+
+        RELEASE_TEMP_GUEST_ALLOCATOR(nameTableAlloc, scriptContext);
+        return result;
+    }
+
+    Js::Var Stringify(Js::Var value, Js::ScriptContext* scriptContext)
+    {
+        StringifySession stringifySession(scriptContext);
+        return StringifyValue(stringifySession, value, scriptContext->GetLibrary()->GetNull(), scriptContext);
+    }
+
+    Js::Var StringifyValue(StringifySession& stringifySession, Js::Var value, Js::Var space, Js::ScriptContext* scriptContext)
+    {
+        Js::Var result = nullptr;
         BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("JSON"))
         {
             stringifySession.CompleteInit(space, tempAlloc);
@@ -326,11 +341,16 @@ namespace JSON
             scriptContext->GetOrAddPropertyRecord(_u(""), 0, &propertyRecord);
             Js::PropertyId propertyId = propertyRecord->GetPropertyId();
             Js::JavascriptOperators::InitProperty(wrapper, propertyId, value);
-            result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            TryFinally([&]()
+            {
+                result = stringifySession.Str(scriptContext->GetLibrary()->GetEmptyString(), propertyId, wrapper);
+            },
+            [&](bool/*hasException*/)
+            {
+                stringifySession.ReleasePlans();
+            });
         }
         END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
-
-        RELEASE_TEMP_GUEST_ALLOCATOR(nameTableAlloc, scriptContext);
         return result;
     }
 
@@ -388,6 +408,111 @@ namespace JSON
         objectStack = Anew(tempAlloc, JSONStack, tempAlloc, scriptContext);
     }
 
+    void StringifySession::ReleasePlans()
+    {
+        if (planAllocatorObject != nullptr)
+        {
+            scriptContext->ReleaseTemporaryGuestAllocator(planAllocatorObject);
+            planAllocatorObject = nullptr;
+            planCache = nullptr;
+        }
+    }
+
+    StringifySession::StringifyPlan* StringifySession::GetStringifyPlan(Js::RecyclableObject* object)
+    {
+        // Only plain objects of this context with a shared path type: all their properties are enumerable data
+        // properties, laid out in the same slots in every object of the type. Objects of other contexts are left to
+        // GetProperty, which marshals their values.
+        if (Js::JavascriptOperators::GetTypeId(object) != Js::TypeIds_Object || object->GetScriptContext() != scriptContext)
+        {
+            return nullptr;
+        }
+
+        Js::DynamicObject* dynamicObject = Js::DynamicObject::FromVar(object);
+        Js::DynamicType* type = dynamicObject->GetDynamicType();
+        if (!type->GetIsShared() || !type->GetTypeHandler()->IsPathTypeHandler() || dynamicObject->HasObjectArray())
+        {
+            return nullptr;
+        }
+
+        if (planCache == nullptr)
+        {
+            planAllocatorObject = scriptContext->GetTemporaryGuestAllocator(_u("JSONStringifyPlans"));
+            planCache = Anew(planAllocatorObject->GetAllocator(), StringifyPlanCache, planAllocatorObject->GetAllocator());
+        }
+
+        StringifyPlan* plan;
+        if (planCache->TryGetValue(type, &plan))
+        {
+            return plan;
+        }
+
+        ArenaAllocator* planAllocator = planAllocatorObject->GetAllocator();
+        Js::DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+        const int propertyCount = typeHandler->GetPropertyCount();
+
+        plan = Anew(planAllocator, StringifyPlan);
+        plan->members = AnewArray(planAllocator, StringifyPlanMember, propertyCount);
+        plan->memberCount = 0;
+        for (int i = 0; i < propertyCount; i++)
+        {
+            const Js::PropertyId id = typeHandler->GetPropertyId(scriptContext, (Js::PropertyIndex)i);
+            if (scriptContext->GetPropertyName(id)->IsSymbol())
+            {
+                continue;
+            }
+
+            StringifyPlanMember& member = plan->members[plan->memberCount++];
+            member.propertyName = scriptContext->GetPropertyString(id);
+            member.quotedNameAndSeparator = Js::JavascriptString::Concat(Quote(member.propertyName), GetPropertySeparator());
+            // Flatten once here rather than in every result that includes it
+            member.quotedNameAndSeparator->GetSz();
+            member.propertyId = id;
+            member.slotIndex = (Js::PropertyIndex)i;
+        }
+
+        planCache->Add(type, plan);
+        return plan;
+    }
+
+    void StringifySession::StringifyMembersWithPlan(Js::DynamicObject* object, StringifyPlan* plan, Js::ConcatStringBuilder* result,
+        Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isFirstMember, bool &isEmpty)
+    {
+        Js::DynamicType* type = object->GetDynamicType();
+        for (uint k = 0; k < plan->memberCount; k++)
+        {
+            const StringifyPlanMember& member = plan->members[k];
+
+            // A toJSON method called for an earlier member may have changed the object; then look up what is left of
+            // the properties it had when we started, as the enumeration snapshot would
+            Js::Var propertyObjectString = object->GetDynamicType() == type ?
+                StrHelper(member.propertyName, type->GetTypeHandler()->GetSlot(object, member.slotIndex), object) :
+                Str(member.propertyName, member.propertyId, object);
+            if (Js::JavascriptOperators::IsUndefinedObject(propertyObjectString, scriptContext))
+            {
+                continue;
+            }
+
+            Js::ConcatStringN<4>* memberString = Js::ConcatStringN<4>::New(this->scriptContext);   // We may use 2 or 3 slots.
+            int slotIndex = 0;
+            if (!isFirstMember)
+            {
+                if (!indentString)
+                {
+                    indentString = GetIndentString(this->indent);
+                    memberSeparator = GetMemberSeparator(indentString);
+                }
+                memberString->SetItem(slotIndex++, memberSeparator);
+            }
+            memberString->SetItem(slotIndex++, member.quotedNameAndSeparator);
+            memberString->SetItem(slotIndex++, Js::JavascriptString::FromVar(propertyObjectString));
+
+            result->Append(memberString);
+            isFirstMember = false;
+            isEmpty = false;
+        }
+    }
+
     Js::Var StringifySession::Str(uint32 index, Js::Var holder)
     {
         Js::Var value;
@@ -600,7 +725,13 @@ namespace JSON
         }
         else
         {
-            if (JavascriptProxy::Is(object))
+            StringifyPlan* plan = ReplacerNone == this->replacerType ? GetStringifyPlan(object) : nullptr;
+            if (plan != nullptr)
+            {
+                result = Js::ConcatStringBuilder::New(this->scriptContext, plan->memberCount);   // Reserve initial slots for properties.
+                StringifyMembersWithPlan(Js::DynamicObject::FromVar(object), plan, (Js::ConcatStringBuilder*)result, indentString, memberSeparator, isFirstMember, isEmpty);
+            }
+            else if (JavascriptProxy::Is(object))
             {
                 JavascriptProxy* proxyObject = JavascriptProxy::FromVar(object);
                 JavascriptArray* proxyResult = proxyObject->PropertyKeysTrap(JavascriptProxy::KeysTrapKind::GetOwnPropertyNamesKind);
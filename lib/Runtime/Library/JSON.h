@@ -19,6 +19,12 @@ namespace JSON
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
 
+    // Parses a JSON text that is not in a string, e.g. one collected by the host. The text is not kept.
+    Js::Var Parse(LPCWSTR str, charcount_t length, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext);
+
+    // Stringifies value without a replacer or indentation. Returns undefined if value has no JSON representation.
+    Js::Var Stringify(Js::Var value, Js::ScriptContext* scriptContext);
+
     class StringifySession
     {
     public:
@@ -39,7 +45,9 @@ namespace JSON
                 replacerType(ReplacerNone),
                 gap(NULL),
                 indent(0),
-                propertySeparator(NULL)
+                propertySeparator(NULL),
+                planAllocatorObject(nullptr),
+                planCache(nullptr)
         {
             replacer.propertyList.propertyNames = NULL;
             replacer.propertyList.length = 0;
@@ -60,11 +68,33 @@ namespace JSON
             replacer.propertyList.length = len;
         }
         void CompleteInit(Js::Var space, ArenaAllocator* alloc);
+        void ReleasePlans();
 
         Js::Var Str(Js::JavascriptString* key, Js::PropertyId keyId, Js::Var holder);
         Js::Var Str(uint32 index, Js::Var holder);
 
     private:
+        // The members of the objects of one type, in enumeration order. Built the first time an object of the type
+        // is stringified, and reused for the others, which then need neither a property enumeration nor quoting
+        // their property names again.
+        struct StringifyPlanMember
+        {
+            Js::PropertyString* propertyName;
+            Js::JavascriptString* quotedNameAndSeparator;
+            Js::PropertyId propertyId;
+            Js::PropertyIndex slotIndex;
+        };
+        struct StringifyPlan
+        {
+            StringifyPlanMember* members;
+            uint memberCount;
+        };
+        typedef JsUtil::BaseDictionary<Js::DynamicType*, StringifyPlan*, ArenaAllocator> StringifyPlanCache;
+
+        StringifyPlan* GetStringifyPlan(Js::RecyclableObject* object);
+        void StringifyMembersWithPlan(Js::DynamicObject* object, StringifyPlan* plan, Js::ConcatStringBuilder* result,
+            Js::JavascriptString* &indentString, Js::JavascriptString* &memberSeparator, bool &isFirstMember, bool &isEmpty);
+
         Js::JavascriptString* Quote(Js::JavascriptString* value);
 
         Js::Var StringifyObject(Js::Var value);
@@ -99,6 +129,10 @@ namespace JSON
         Js::JavascriptString* gap;
         uint indent;
         Js::JavascriptString* propertySeparator;     // colon or colon+space
+
+        // Plans hold strings, so they live on a guest arena, which the recycler scans
+        Js::TempGuestArenaAllocatorObject* planAllocatorObject;
+        StringifyPlanCache* planCache;
         Js::Var StringifySession::StrHelper(Js::JavascriptString* key, Js::Var value, Js::Var holder);
     };
 } // namespace JSON
@@ -31,6 +31,10 @@ namespace JSON
             }
         }
         m_scanner.Init(str, length, &m_token, scriptContext, str, this->arenaAllocator);
+        if (length >= MIN_STRUCTURAL_INDEX_LENGTH)
+        {
+            m_scanner.BuildStructuralIndex();
+        }
         Scan();
         Js::Var ret = ParseObject();
         if (m_token.tk != tkEOF)
@@ -205,7 +209,7 @@ namespace JSON
             {
                 // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                retVal = Js::Latin1String::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
                 Scan();
                 return retVal;
             }
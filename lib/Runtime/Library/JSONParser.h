@@ -88,5 +88,6 @@ namespace JSON
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
         static const int MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+        static const int MIN_STRUCTURAL_INDEX_LENGTH = 4096; // Index whitespace and string boundaries up front from this length on.
     };
 } // namespace JSON
@@ -5,14 +5,57 @@
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#define JSON_SCANNER_SSE2 1
+#endif
+
 using namespace Js;
 
 namespace JSON
 {
+    static const uint CharsPerIndexWord = 64;
+
+#ifdef JSON_SCANNER_SSE2
+    // Each returns 16 bits, one per character of the 16 starting at chars
+    static uint WhitespaceMask(const char16* chars)
+    {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 8));
+        const __m128i space = _mm_set1_epi16(' ');
+        const __m128i tab = _mm_set1_epi16('\t');
+        const __m128i cr = _mm_set1_epi16('\r');
+        const __m128i lf = _mm_set1_epi16('\n');
+        const __m128i loMask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(lo, space), _mm_cmpeq_epi16(lo, tab)),
+            _mm_or_si128(_mm_cmpeq_epi16(lo, cr), _mm_cmpeq_epi16(lo, lf)));
+        const __m128i hiMask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(hi, space), _mm_cmpeq_epi16(hi, tab)),
+            _mm_or_si128(_mm_cmpeq_epi16(hi, cr), _mm_cmpeq_epi16(hi, lf)));
+        return _mm_movemask_epi8(_mm_packs_epi16(loMask, hiMask));
+    }
+
+    static uint StringBoundaryMask(const char16* chars)
+    {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 8));
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i nonControlBits = _mm_set1_epi16(static_cast<short>(0xFFE0));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i loMask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(lo, quote), _mm_cmpeq_epi16(lo, backslash)),
+            _mm_cmpeq_epi16(_mm_and_si128(lo, nonControlBits), zero));
+        const __m128i hiMask = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(hi, quote), _mm_cmpeq_epi16(hi, backslash)),
+            _mm_cmpeq_epi16(_mm_and_si128(hi, nonControlBits), zero));
+        return _mm_movemask_epi8(_mm_packs_epi16(loMask, hiMask));
+    }
+#endif
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
-        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0)
+        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0),
+        nonWhitespaceBits(nullptr), stringBoundaryBits(nullptr)
     {
     }
 
@@ -37,12 +80,94 @@ namespace JSON
         pToken = pOutToken;
         scriptContext = sc;
         this->allocator = allocator;
+        nonWhitespaceBits = nullptr;
+        stringBoundaryBits = nullptr;
+    }
+
+    void JSONScanner::BuildStructuralIndex()
+    {
+        AssertMsg(this->allocator != nullptr, "The structural index lives on the parser's arena");
+
+        const uint wordCount = (inputLen + CharsPerIndexWord - 1) / CharsPerIndexWord;
+        nonWhitespaceBits = AnewArray(this->allocator, uint64, wordCount);
+        stringBoundaryBits = AnewArray(this->allocator, uint64, wordCount);
+
+        uint i = 0;
+#ifdef JSON_SCANNER_SSE2
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            for (; inputLen - i >= CharsPerIndexWord; i += CharsPerIndexWord)
+            {
+                uint64 whitespace = 0;
+                uint64 boundary = 0;
+                for (uint offset = 0; offset < CharsPerIndexWord; offset += 16)
+                {
+                    whitespace |= (uint64)WhitespaceMask(inputText + i + offset) << offset;
+                    boundary |= (uint64)StringBoundaryMask(inputText + i + offset) << offset;
+                }
+                nonWhitespaceBits[i / CharsPerIndexWord] = ~whitespace;
+                stringBoundaryBits[i / CharsPerIndexWord] = boundary;
+            }
+        }
+#endif
+
+        // Bits past the end of the input are left clear
+        for (; i < inputLen; i += CharsPerIndexWord)
+        {
+            const uint count = inputLen - i < CharsPerIndexWord ? inputLen - i : CharsPerIndexWord;
+            uint64 nonWhitespace = 0;
+            uint64 boundary = 0;
+            for (uint k = 0; k < count; k++)
+            {
+                const char16 ch = inputText[i + k];
+                if (ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n')
+                {
+                    nonWhitespace |= (uint64)1 << k;
+                }
+                if (ch == '"' || ch == '\\' || ch <= 0x1F)
+                {
+                    boundary |= (uint64)1 << k;
+                }
+            }
+            nonWhitespaceBits[i / CharsPerIndexWord] = nonWhitespace;
+            stringBoundaryBits[i / CharsPerIndexWord] = boundary;
+        }
+    }
+
+    uint JSONScanner::FindNextBit(const uint64* bits, uint index) const
+    {
+        const uint wordCount = (inputLen + CharsPerIndexWord - 1) / CharsPerIndexWord;
+        uint word = index / CharsPerIndexWord;
+        if (word >= wordCount)
+        {
+            return inputLen;
+        }
+
+        UnitWord64 mask = bits[word] & (~(UnitWord64)0 << (index % CharsPerIndexWord));
+        for (;;)
+        {
+            DWORD bit;
+            if (GetFirstBitSet(&bit, mask))
+            {
+                return word * CharsPerIndexWord + bit;
+            }
+            if (++word == wordCount)
+            {
+                return inputLen;
+            }
+            mask = bits[word];
+        }
     }
 
     tokens JSONScanner::Scan()
     {
         pTokenString = currentChar;
 
+        if (nonWhitespaceBits != nullptr)
+        {
+            currentChar = inputText + FindNextBit(nonWhitespaceBits, GetScanPosition());
+        }
+
         while (currentChar < inputText + inputLen)
         {
             switch(ReadNextChar())
@@ -77,6 +202,11 @@ namespace JSON
                 {
                     currentChar--;
 
+                    if (TryScanSmallInteger())
+                    {
+                        return tkFltCon;
+                    }
+
                     // we use StrToDbl() here for compat with the rest of the engine. StrToDbl() accept a larger syntax.
                     // Verify first the JSON grammar.
                     const char16* saveCurrentChar = currentChar;
@@ -156,6 +286,51 @@ namespace JSON
         return (pToken->tk = tkEOF);
     }
 
+    // Most numbers in JSON text are small integers: convert those directly when they are plainly followed by a
+    // delimiter, and leave everything else, including malformed numbers, to IsJSONNumber and StrToDbl.
+    bool JSONScanner::TryScanSmallInteger()
+    {
+        const char16* end = inputText + inputLen;
+        const char16* next = currentChar;
+        int value = 0;
+
+        if (*next == '0')
+        {
+            next++;
+        }
+        else
+        {
+            while (next < end && next - currentChar < 9 && '0' <= *next && *next <= '9')
+            {
+                value = value * 10 + (*next - '0');
+                next++;
+            }
+        }
+
+        if (next < end)
+        {
+            switch (*next)
+            {
+            case ',':
+            case ']':
+            case '}':
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+
+            default:
+                return false;
+            }
+        }
+
+        pToken->tk = tkFltCon;
+        pToken->SetDouble(value, false);
+        currentChar = next;
+        return true;
+    }
+
     bool JSONScanner::IsJSONNumber()
     {
         bool firstDigitIsAZero = false;
@@ -222,6 +397,21 @@ namespace JSON
 
     tokens JSONScanner::ScanString()
     {
+        if (stringBoundaryBits != nullptr)
+        {
+            // Without escapes or control characters the string ends at the next boundary character and maps
+            // directly onto the input. Anything else takes the character by character path below.
+            const uint start = GetScanPosition();
+            const uint end = FindNextBit(stringBoundaryBits, start);
+            if (end < inputLen && inputText[end] == '"')
+            {
+                this->currentString = const_cast<char16*>(currentChar);
+                this->currentIndex = end - start;
+                currentChar = inputText + end + 1;
+                return (pToken->tk = tkStrCon);
+            }
+        }
+
         char16 ch;
 
         this->currentIndex = 0;
@@ -19,6 +19,10 @@ namespace JSON
         void Init(const char16* input, uint len, Token* pOutToken,
             ::Js::ScriptContext* sc, const char16* current, ArenaAllocator* allocator);
 
+        // Stage one for large inputs: classifies the whole input up front so that Scan can skip whitespace and find
+        // the end of strings a word at a time. Needs the arena allocator.
+        void BuildStructuralIndex();
+
         void Finalizer();
         char16* GetCurrentString() { return currentString; } 
         uint GetCurrentStringLen() { return currentIndex; }
@@ -65,6 +69,16 @@ namespace JSON
 
         tokens ScanString();
         bool IsJSONNumber();
+        bool TryScanSmallInteger();
+
+        // Index of the first set bit at or after index, or inputLen if there is none
+        uint FindNextBit(const uint64* bits, uint index) const;
+
+        // One bit per input character, in words of 64 characters: set in nonWhitespaceBits for anything but
+        // JSON whitespace, and in stringBoundaryBits for '"', '\\' and the control characters not allowed in strings.
+        // Both are nullptr unless BuildStructuralIndex was called.
+        uint64* nonWhitespaceBits;
+        uint64* stringBoundaryBits;
 
         const char16* inputText;
         uint    inputLen;
@@ -79,17 +79,32 @@ namespace Js
         Assert(!this->IsFinalized());
         charcount_t length = this->GetLength() + /*terminating null*/1;
         WCHAR* buffer = RecyclerNewArrayLeaf(this->GetRecycler(), WCHAR, length);
-        this->SetBuffer(buffer);
         buffer[GetLength()] = '\0';
-        WritableStringBuffer stringBuffer(buffer, length);
-        JavascriptString* str = JSONString::Escape<EscapingOperation_Escape>(this->m_originalString, m_start, &stringBuffer);
-        Assert(str == nullptr);
+        // Escape into the buffer before setting it, since CopyVirtual expects the string not to be flattened yet
+        StringCopyInfoStack nestedStringTreeCopyInfos(this->GetScriptContext());
+        CopyVirtual(buffer, nestedStringTreeCopyInfos, 0);
+        Assert(nestedStringTreeCopyInfos.IsEmpty());
         Assert(buffer[GetLength()] == '\0');
+        this->SetBuffer(buffer);
         this->m_originalString = nullptr; // Remove the reference to the original string.
         VirtualTableInfo<LiteralString>::SetVirtualTable(this); // This will ensure GetSz does not get invoked again.
         return buffer;
     }
 
+    void JSONString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+        Assert(this->m_originalString != nullptr);
+
+        WritableStringBuffer stringBuffer(buffer, this->GetLength());
+        JavascriptString* str = JSONString::Escape<EscapingOperation_Escape>(this->m_originalString, m_start, &stringBuffer);
+        Assert(str == nullptr);
+    }
+
     void WritableStringBuffer::Append(const char16 * str, charcount_t countNeeded)
     {
         JavascriptString::CopyHelper(m_pszCurrentPtr, str, countNeeded);
@@ -43,6 +43,9 @@ namespace Js
     protected:
         DEFINE_VTABLE_CTOR(JSONString, JavascriptString);
         DECLARE_CONCRETE_STRING_CLASS;
+
+        // When flattened as part of a string tree, escape straight into the tree's buffer instead of into our own first
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
     private:
         JavascriptString* m_originalString;
         charcount_t m_start; /* start of the escaping operation */
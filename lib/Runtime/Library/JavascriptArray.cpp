@@ -104,18 +104,30 @@ namespace Js
         return segmentCount == MaxKeys;
     }
 
-    void SegmentBTree::InternalFind(SegmentBTree* node, uint32 itemIndex, SparseArraySegmentBase*& prev, SparseArraySegmentBase*& matchOrNext)
+    uint32 SegmentBTree::FindKeyUpperBound(uint32 itemIndex) const
     {
-        uint32 i = 0;
-
-        for(; i < node->segmentCount; i++)
+        uint32 low = 0;
+        uint32 high = segmentCount;
+        while (low < high)
         {
-            Assert(node->keys[i] == node->segments[i]->left);
-            if (itemIndex <  node->keys[i])
+            uint32 mid = low + (high - low) / 2;
+            if (itemIndex < keys[mid])
             {
-                break;
+                high = mid;
+            }
+            else
+            {
+                low = mid + 1;
             }
         }
+        return low;
+    }
+
+    void SegmentBTree::InternalFind(SegmentBTree* node, uint32 itemIndex, SparseArraySegmentBase*& prev, SparseArraySegmentBase*& matchOrNext)
+    {
+        uint32 i = node->FindKeyUpperBound(itemIndex);
+        Assert(i == 0 || node->keys[i-1] == node->segments[i-1]->left);
+        Assert(i == node->segmentCount || node->keys[i] == node->segments[i]->left);
 
         // i indicates the 1st segment in the node past any matching segment.
         // the i'th child is the children to the 'left' of the i'th segment.
@@ -176,6 +188,68 @@ namespace Js
         Assert(matchOrNext == NULL || (matchOrNext->left >= itemIndex || matchOrNext->left + matchOrNext->length > itemIndex));
     }
 
+    void SegmentBTreeRoot::Build(Recycler* recycler, SparseArraySegmentBase* firstSeg, uint32 count)
+    {
+        Assert(segmentCount == 0 && segments == NULL && children == NULL);
+        Assert(count > 0);
+
+        // Find the shortest tree that holds all the segments. A tree of height h holds at most MaxDegree^(h+1) - 1 keys.
+        uint64 capacity = MaxKeys;
+        while (count > capacity)
+        {
+            capacity = (capacity + 1) * MaxDegree - 1;
+        }
+
+        SparseArraySegmentBase* nextSeg = firstSeg;
+        BulkLoad(recycler, this, nextSeg, count, capacity);
+        Assert(nextSeg == NULL);
+    }
+
+    void SegmentBTree::BulkLoad(Recycler* recycler, SegmentBTree* node, SparseArraySegmentBase*& nextSeg, uint32 count, uint64 capacity)
+    {
+        Assert(count <= capacity);
+
+        // Even though the segments point to a GC pointer, the main array should keep a references
+        // as well.  So just make it a leaf allocation
+        node->segments = AllocatorNewArrayLeafZ(Recycler, recycler, SparseArraySegmentBase*, MaxKeys);
+        node->keys = AllocatorNewArrayLeafZ(Recycler, recycler, uint32, MaxKeys);
+
+        if (capacity == MaxKeys)
+        {
+            for (uint32 i = 0; i < count; i++)
+            {
+                node->segments[i] = nextSeg;
+                node->keys[i] = nextSeg->left;
+                nextSeg = nextSeg->next;
+            }
+            node->segmentCount = count;
+            return;
+        }
+
+        // Use the fewest children that can hold the segments, but at least two, and spread the segments evenly
+        // between them. Each child then gets at least half of its capacity, which is well over MinKeys per node.
+        uint64 childCapacity = (capacity + 1) / MaxDegree - 1;
+        uint32 childCount = max(2u, (uint32)((count + childCapacity + 1) / (childCapacity + 1)));
+        uint32 childKeys = count - (childCount - 1);
+        Assert(childCount <= MaxDegree);
+
+        node->children = AllocatorNewArrayZ(Recycler, recycler, SegmentBTree, MaxDegree);
+        for (uint32 i = 0; i < childCount; i++)
+        {
+            uint32 childKeyCount = childKeys / childCount + (i < childKeys % childCount ? 1 : 0);
+            Assert(childKeyCount >= MinKeys);
+            BulkLoad(recycler, &node->children[i], nextSeg, childKeyCount, childCapacity);
+
+            if (i + 1 < childCount)
+            {
+                node->segments[i] = nextSeg;
+                node->keys[i] = nextSeg->left;
+                nextSeg = nextSeg->next;
+            }
+        }
+        node->segmentCount = childCount - 1;
+    }
+
     void SegmentBTreeRoot::Add(Recycler* recycler, SparseArraySegmentBase* newSeg)
     {
 
@@ -200,17 +274,7 @@ namespace Js
     void SegmentBTree::SwapSegment(uint32 originalKey, SparseArraySegmentBase* oldSeg, SparseArraySegmentBase* newSeg)
     {
         // Find old segment
-        uint32 itemIndex = originalKey;
-        uint32 i = 0;
-
-        for(; i < segmentCount; i++)
-        {
-            Assert(keys[i] == segments[i]->left || (oldSeg == newSeg && newSeg == segments[i]));
-            if (itemIndex <  keys[i])
-            {
-                break;
-            }
-        }
+        uint32 i = FindKeyUpperBound(originalKey);
 
         // i is 1 past any match
 
@@ -305,14 +369,6 @@ namespace Js
 
         if (node->IsLeaf())
         {
-            // Move the keys
-            uint32 i = node->segmentCount - 1;
-            while( (i != -1) && (newSeg->left < node->keys[i]))
-            {
-                node->segments[i+1] = node->segments[i];
-                node->keys[i+1] = node->keys[i];
-                i--;
-            }
             if (!node->segments)
             {
                 // Even though the segments point to a GC pointer, the main array should keep a references
@@ -320,20 +376,23 @@ namespace Js
                 node->segments = AllocatorNewArrayLeafZ(Recycler, recycler, SparseArraySegmentBase*, MaxKeys);
                 node->keys = AllocatorNewArrayLeafZ(Recycler, recycler, uint32, MaxKeys);
             }
-            node->segments[i + 1] = newSeg;
-            node->keys[i + 1] = newSeg->left;
+
+            // Move the keys
+            uint32 i = node->FindKeyUpperBound(newSeg->left);
+            uint32 moveCount = node->segmentCount - i;
+            if (moveCount != 0)
+            {
+                memmove(node->segments + i + 1, node->segments + i, sizeof(SparseArraySegmentBase*) * moveCount);
+                memmove(node->keys + i + 1, node->keys + i, sizeof(uint32) * moveCount);
+            }
+            node->segments[i] = newSeg;
+            node->keys[i] = newSeg->left;
             node->segmentCount++;
         }
         else
         {
             // find the correct child node
-            uint32 i = node->segmentCount-1;
-
-            while((i != -1) && (newSeg->left < node->keys[i]))
-            {
-                i--;
-            }
-            i++;
+            uint32 i = node->FindKeyUpperBound(newSeg->left);
 
             // Make room if full
             if(node->children[i].IsFullNode())
@@ -2494,11 +2553,15 @@ namespace Js
     {
         Recycler* recycler = GetRecycler();
         SegmentBTreeRoot* tmpSegmentMap = AllocatorNewStruct(Recycler, recycler, SegmentBTreeRoot);
-        ForEachSegment([recycler, tmpSegmentMap](SparseArraySegmentBase * current)
+
+        // The segments are already sorted, so load them into the tree in one pass instead of adding them one at a time
+        uint32 segmentCount = 0;
+        ForEachSegment([&segmentCount](SparseArraySegmentBase * current)
         {
-            tmpSegmentMap->Add(recycler, current);
+            segmentCount++;
             return false;
         });
+        tmpSegmentMap->Build(recycler, head, segmentCount);
 
         // There could be OOM during building segment map. Save to array only after its successful completion.
         SetSegmentMap(tmpSegmentMap);
@@ -8824,6 +8887,58 @@ Case0:
         return JavascriptArray::FillHelper(pArr, nullptr, obj, length, args, scriptContext);
     }
 
+    // Stores value in [start, start + length) of an array with one range store, the way the JIT's memset does, which
+    // merges the segments in the range into one. Returns false when the elements have to be set one by one instead:
+    // when the array can't hold the value as it is, or when setting an element could be observed.
+    bool JavascriptArray::TryFillRange(JavascriptArray* pArr, uint32 start, uint32 length, Var value, ScriptContext* scriptContext)
+    {
+        Assert(length != 0);
+
+        // Filling a hole looks for setters on the prototype chain and fails on a non-extensible array, and fill never
+        // grows the array, but the arguments' conversions may have shrunk it
+        if (!IsDirectAccessArray(pArr) ||
+            !scriptContext->optimizationOverrides.IsEnabledArraySetElementFastPath() ||
+            !pArr->IsExtensible() ||
+            start + length > pArr->length)
+        {
+            return false;
+        }
+
+        // The range store goes element by element when there is a segment map. Drop the map instead; it is rebuilt in
+        // one pass over the merged segments when lookups need it again.
+        pArr->ClearSegmentMap();
+
+        if (JavascriptNativeIntArray::Is(pArr))
+        {
+            if (!TaggedInt::Is(value))
+            {
+                return false;
+            }
+            int32 intValue = TaggedInt::ToInt32(value);
+            if (SparseArraySegment<int32>::IsMissingItem(&intValue))
+            {
+                return false;
+            }
+            return pArr->DirectSetItemAtRange<int32>(start, length, intValue);
+        }
+
+        if (JavascriptNativeFloatArray::Is(pArr))
+        {
+            if (!TaggedNumber::Is(value) && !JavascriptNumber::Is(value))
+            {
+                return false;
+            }
+            double doubleValue = JavascriptConversion::ToNumber(value, scriptContext);
+            if (SparseArraySegment<double>::IsMissingItem(&doubleValue))
+            {
+                return false;
+            }
+            return pArr->DirectSetItemAtRange<double>(start, length, doubleValue);
+        }
+
+        return pArr->DirectSetItemAtRange<Var>(start, length, value);
+    }
+
     // Array.prototype.fill as defined in ES6.0 (draft 22) Section 22.1.3.6
     Var JavascriptArray::FillHelper(JavascriptArray* pArr, Js::TypedArrayBase* typedArrayBase, RecyclableObject* obj, int64 length, Arguments& args, ScriptContext* scriptContext)
     {
@@ -8866,6 +8981,11 @@ Case0:
             int64 end = min<int64>(finalVal, MaxArrayLength);
             uint32 u32k = static_cast<uint32>(k);
 
+            if (pArr && u32k < end && TryFillRange(pArr, u32k, static_cast<uint32>(end) - u32k, fillValue, scriptContext))
+            {
+                u32k = static_cast<uint32>(end);
+            }
+
             while (u32k < end)
             {
                 if (typedArrayBase)
@@ -70,14 +70,20 @@ namespace Js
         BOOL IsLeaf() const;
         BOOL IsFullNode() const;
 
+        // Index of the first key in the node greater than itemIndex, found by binary search over keys
+        uint32 FindKeyUpperBound(uint32 itemIndex) const;
+
         static void InternalFind(SegmentBTree* node, uint32 itemIndex, SparseArraySegmentBase*& prev, SparseArraySegmentBase*& matchOrNext);
         static void SplitChild(Recycler* recycler, SegmentBTree* tree, uint32 count, SegmentBTree* root);
         static void InsertNonFullNode(Recycler* recycler, SegmentBTree* tree, SparseArraySegmentBase* newSeg);
+        static void BulkLoad(Recycler* recycler, SegmentBTree* node, SparseArraySegmentBase*& nextSeg, uint32 count, uint64 capacity);
     };
 
     class SegmentBTreeRoot : public SegmentBTree
     {
     public:
+        // Builds the tree bottom up from the count segments of the list starting at firstSeg, which must be empty
+        void Build(Recycler* recycler, SparseArraySegmentBase* firstSeg, uint32 count);
         void Add(Recycler* recycler, SparseArraySegmentBase* newSeg);
         void Find(uint itemIndex, SparseArraySegmentBase*& prevOrMatch, SparseArraySegmentBase*& matchOrNext);
 
@@ -458,6 +464,7 @@ namespace Js
         template <typename T>
         static Var MapHelper(JavascriptArray* pArr, Js::TypedArrayBase* typedArrayBase, RecyclableObject* obj, T length, Arguments& args, ScriptContext* scriptContext);
         static Var FillHelper(JavascriptArray* pArr, Js::TypedArrayBase* typedArrayBase, RecyclableObject* obj, int64 length, Arguments& args, ScriptContext* scriptContext);
+        static bool TryFillRange(JavascriptArray* pArr, uint32 start, uint32 length, Var value, ScriptContext* scriptContext);
         static Var CopyWithinHelper(JavascriptArray* pArr, Js::TypedArrayBase* typedArrayBase, RecyclableObject* obj, int64 length, Arguments& args, ScriptContext* scriptContext);
         template <typename T>
         static BOOL GetParamForIndexOf(T length, Arguments const & args, Var& search, T& fromIndex, ScriptContext * scriptContext);
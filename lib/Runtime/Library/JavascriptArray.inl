@@ -276,20 +276,9 @@ namespace Js
         className* array = RecyclerNewZ(recycler, JavascriptCopyOnAccessNativeIntArray, ints->count, arrayType);
         JavascriptLibrary *lib = functionBody->GetScriptContext()->GetLibrary();
 
-        SparseArraySegment<unitType> *seg;
-
-        if (JavascriptLibrary::IsCachedCopyOnAccessArrayCallSite(functionBody->GetScriptContext()->GetLibrary() , arrayInfo))
-        {
-            seg = lib->cacheForCopyOnAccessArraySegments->GetSegmentByIndex(arrayInfo->copyOnAccessArrayCacheIndex);
-        }
-        else
-        {
-            seg = SparseArraySegment<unitType>::AllocateLiteralHeadSegment(recycler, ints->count);
-        }
-
         if (!JavascriptLibrary::IsCachedCopyOnAccessArrayCallSite(lib, arrayInfo))
         {
-            JavascriptOperators::AddIntsToArraySegment(seg, ints);
+            SparseArraySegment<unitType> *seg = lib->GetSharedCopyOnAccessArraySegment(ints);
             arrayInfo->copyOnAccessArrayCacheIndex = lib->cacheForCopyOnAccessArraySegments->AddSegment(seg);
         }
         array->SetHeadAndLastUsedSegment(reinterpret_cast<SparseArraySegmentBase *>(arrayInfo->copyOnAccessArrayCacheIndex)); // storing index in head on purpose: expect AV if treated as other array objects
@@ -1305,13 +1294,40 @@ SECOND_PASS:
             else if ((itemIndex + 1) < current->left)
             {
                 //itemIndex lies in between current and previous segment
-                SparseArraySegment<T>* newSeg = SparseArraySegment<T>::AllocateSegment(recycler, prev, itemIndex);
-                newSeg->SetElement(recycler, itemIndex, newValue);
+                Assert(prev == nullptr || itemIndex > prev->left + prev->size);
+                if (prev != nullptr
+                    && current->size <= MergeSegmentsLengthHeuristics                                          // current segment is small
+                    && current->left - itemIndex <= min((uint32)MergeSegmentsLengthHeuristics, current->size) // and so is the gap before it
+                   )
+                {
+                    // Rather than adding another small segment, grow the small segment after itemIndex to the front
+                    // to take it in, so that writes scattered over a sparse region fill a few dense segments instead
+                    // of leaving many tiny ones. The gap is no larger than the segment, so it is grown by all of it.
+                    SparseArraySegmentBase* oldSegment = current;
+                    uint originalKey = oldSegment->left;
+
+                    current = current->GrowFrontByMax(recycler, current->left - itemIndex);
+                    Assert(current->left == itemIndex);
+                    current->SetElement(recycler, itemIndex, newValue);
 
-                newSeg->next = current;
-                LinkSegments((SparseArraySegment<T>*)prev, newSeg);
-                current = newSeg;
-                TryAddToSegmentMap(recycler, newSeg);
+                    Assert(segmentMap == GetSegmentMap());
+                    if (segmentMap)
+                    {
+                        segmentMap->SwapSegment(originalKey, oldSegment, current);
+                    }
+
+                    LinkSegments((SparseArraySegment<T>*)prev, current);
+                }
+                else
+                {
+                    SparseArraySegment<T>* newSeg = SparseArraySegment<T>::AllocateSegment(recycler, prev, itemIndex);
+                    newSeg->SetElement(recycler, itemIndex, newValue);
+
+                    newSeg->next = current;
+                    LinkSegments((SparseArraySegment<T>*)prev, newSeg);
+                    current = newSeg;
+                    TryAddToSegmentMap(recycler, newSeg);
+                }
 
                 Assert(current != head);
             }
@@ -3431,6 +3431,7 @@ namespace Js
         vtableAddresses[VTableValue::VtableJavascriptAsyncFunction] = VirtualTableInfo<Js::JavascriptAsyncFunction>::Address;
         vtableAddresses[VTableValue::VtableConcatStringMulti] = VirtualTableInfo<Js::ConcatStringMulti>::Address;
         vtableAddresses[VTableValue::VtableCompoundString] = VirtualTableInfo<Js::CompoundString>::Address;
+        vtableAddresses[VTableValue::VtableLatin1String] = VirtualTableInfo<Js::Latin1String>::Address;
 
         // SIMD_JS
 #ifdef ENABLE_SIMDJS
@@ -6841,6 +6842,31 @@ namespace Js
         return lib->cacheForCopyOnAccessArraySegments
             && lib->cacheForCopyOnAccessArraySegments->IsValidIndex(arrayInfo->copyOnAccessArrayCacheIndex);
     }
+
+    SparseArraySegment<int32> *JavascriptLibrary::GetSharedCopyOnAccessArraySegment(const Js::AuxArray<int32> *ints)
+    {
+        // Cached segments are never written to (arrays copy them when converted), so call sites with the same
+        // contents can share one, in this script context and in the others on the thread
+        hash_t contentHash = ints->count;
+        for (uint32 i = 0; i < ints->count; i++)
+        {
+            contentHash = (contentHash << 5) + contentHash + static_cast<hash_t>(ints->elements[i]);
+        }
+
+        ThreadContext *threadContext = this->scriptContext->GetThreadContext();
+        SparseArraySegment<int32> *seg = static_cast<SparseArraySegment<int32> *>(threadContext->GetCopyOnAccessArraySegment(contentHash));
+        if (seg != nullptr
+            && seg->length == ints->count
+            && memcmp(seg->elements, ints->elements, sizeof(int32) * ints->count) == 0)
+        {
+            return seg;
+        }
+
+        seg = SparseArraySegment<int32>::AllocateLiteralHeadSegment(this->GetRecycler(), ints->count);
+        JavascriptOperators::AddIntsToArraySegment(seg, ints);
+        threadContext->SetCopyOnAccessArraySegment(contentHash, seg);
+        return seg;
+    }
 #endif
 
     // static
@@ -1097,6 +1097,7 @@ namespace Js
 #if ENABLE_COPYONACCESS_ARRAY
         static bool IsCopyOnAccessArrayCallSite(JavascriptLibrary *lib, ArrayCallSiteInfo *arrayInfo, uint32 length);
         static bool IsCachedCopyOnAccessArrayCallSite(const JavascriptLibrary *lib, ArrayCallSiteInfo *arrayInfo);
+        SparseArraySegment<int32> *GetSharedCopyOnAccessArraySegment(const Js::AuxArray<int32> *ints);
         template <typename T>
         static void CheckAndConvertCopyOnAccessNativeIntArray(const T instance);
 #endif
@@ -16,7 +16,7 @@ namespace Js
     {
     private:
         JavascriptSet*                          m_set;
-        JavascriptSet::SetDataList::Iterator    m_setIterator;
+        JavascriptSet::SetDataTable::Iterator    m_setIterator;
         JavascriptSetIteratorKind               m_kind;
 
     protected:
@@ -341,6 +341,12 @@ namespace Js
     {
         AssertMsg( IsValidIndexValue(index), "Must specify valid character");
 
+        const byte *latin1Str = this->TryGetLatin1Buffer();
+        if (latin1Str != nullptr)
+        {
+            return static_cast<char16>(latin1Str[index]);
+        }
+
         const char16 *str = this->GetString();
         return str[index];
     }
@@ -1079,26 +1085,17 @@ case_2:
         {
             const char16* searchStr = searchString->GetString();
             const char16* inputStr = pThis->GetString();
-            if (searchLen == 1)
+            JmpTable jmpTable;
+            if ((charcount_t)searchLen >= MinBoyerMooreSearchLength && BuildLastCharForwardBoyerMooreTable(jmpTable, searchStr, searchLen))
             {
-                int i = position;
-                for(; i < len && inputStr[i] != *searchStr ; i++);
-                if (i < len)
-                {
-                    result = i;
-                }
+                result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
             }
             else
             {
-                JmpTable jmpTable;
-                bool fAsciiJumpTable = BuildLastCharForwardBoyerMooreTable(jmpTable, searchStr, searchLen);
-                if (!fAsciiJumpTable)
-                {
-                    result = JavascriptString::strstr(pThis, searchString, false, position);
-                }
-                else
+                result = StringUtilities::IndexOf(inputStr + position, len - position, searchStr, searchLen);
+                if (result != -1)
                 {
-                    result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
+                    result += position;
                 }
             }
         }
@@ -1153,7 +1150,6 @@ case_2:
         const charcount_t inputLen = pThis->GetLength();
         const charcount_t searchLen = searchArg->GetLength();
         charcount_t position = inputLen;
-        const char16* const searchLowerBound = inputStr;
 
         // Determine if the main string can't contain the search string by length
         if (searchLen > inputLen)
@@ -1181,7 +1177,6 @@ case_2:
             // No point searching beyond the possible end point.
             position = inputLen - searchLen;
         }
-        const char16* const searchUpperBound = searchLowerBound + min(position, inputLen - 1);
 
         // 8. Let searchLen be the number of elements in searchStr.
         // 9. Return the largest possible nonnegative integer k not larger than start such that k + searchLen is
@@ -1196,44 +1191,16 @@ case_2:
         {
             return JavascriptNumber::ToVar(position, scriptContext);
         }
-        else if (searchLen == 1)
-        {
-            char16 const * current = searchUpperBound;
-            while (*current != *searchStr)
-            {
-                current--;
-                if (current < inputStr)
-                {
-                    return JavascriptNumber::ToVar(-1, scriptContext);
-                }
-            }
-            return JavascriptNumber::ToVar(current - inputStr, scriptContext);
-        }
 
         // Structure for a partial ASCII Boyer-Moore
         JmpTable jmpTable;
-        if (BuildFirstCharBackwardBoyerMooreTable(jmpTable, searchStr, searchLen))
+        if (searchLen >= MinBoyerMooreSearchLength && BuildFirstCharBackwardBoyerMooreTable(jmpTable, searchStr, searchLen))
         {
             int result = LastIndexOfUsingJmpTable(jmpTable, inputStr, inputLen, searchStr, searchLen, position);
             return JavascriptNumber::ToVar(result, scriptContext);
         }
 
-        // Revert to slow search if we decided not to do Boyer-Moore.
-        char16 const * currentPos = searchUpperBound;
-        Assert(currentPos - searchLowerBound + searchLen <= inputLen);
-        while (currentPos >= searchLowerBound)
-        {
-            if (*currentPos == *searchStr)
-            {
-                // Quick start char chec
-                if (wmemcmp(currentPos, searchStr, searchLen) == 0)
-                {
-                    return JavascriptNumber::ToVar(currentPos - searchLowerBound, scriptContext);
-                }
-            }
-            --currentPos;
-        }
-        return JavascriptNumber::ToVar(-1, scriptContext);
+        return JavascriptNumber::ToVar(StringUtilities::LastIndexOf(inputStr, inputLen, searchStr, searchLen, position), scriptContext);
     }
 
     // Performs common ES spec steps for getting this argument in string form:
@@ -1313,6 +1280,13 @@ case_2:
 
         GetThisAndSearchStringArguments(args, scriptContext, _u("String.prototype.localeCompare"), &pThis, &pThat, true);
 
+        // Identical strings compare equal under any locale. Locale and options arguments still need validating.
+        if (args.Info.Count <= 2 && pThis->GetLength() == pThat->GetLength() &&
+            StringUtilities::Equals(pThis->GetString(), pThat->GetString(), pThis->GetLength()))
+        {
+            return TaggedInt::ToVarUnchecked(0);
+        }
+
 #ifdef ENABLE_INTL_OBJECT
         if (CONFIG_FLAG(IntlBuiltIns) && scriptContext->IsIntlEnabled())
         {
@@ -2270,13 +2244,21 @@ case_2:
         char16 *outStr = builder.DangerousGetWritableBuffer();
 
         char16* outStrLim = outStr + count;
-        char16 *o = outStr;
+        charcount_t countUnchanged = count - countToCase;
+        js_wmemcpy_s(outStr, count, inStr, countUnchanged);
 
-        while (o < outStrLim)
+        // Most strings are ASCII, which maps without consulting the Unicode case tables. The whole remainder has to be
+        // ASCII though: mapping part of it here would take context (such as a final sigma) away from the full mapping.
+        bool asciiCased = toCase == ToUpper ?
+            StringUtilities::TryToUpperCaseAscii(i, outStr + countUnchanged, countToCase) :
+            StringUtilities::TryToLowerCaseAscii(i, outStr + countUnchanged, countToCase);
+        if (asciiCased)
         {
-            *o++ = *inStr++;
+            return builder.ToString();
         }
 
+        js_wmemcpy_s(outStr + countUnchanged, countToCase, i, countToCase);
+
         if(toCase == ToUpper)
         {
 #if DBG
@@ -2548,7 +2530,7 @@ case_2:
         if (startPosition <= thisStrLen - searchStrLen)
         {
             Assert(searchStrLen <= thisStrLen - startPosition);
-            if (wmemcmp(thisStr + startPosition, searchStr, searchStrLen) == 0)
+            if (StringUtilities::Equals(thisStr + startPosition, searchStr, searchStrLen))
             {
                 return scriptContext->GetLibrary()->GetTrue();
             }
@@ -2601,7 +2583,7 @@ case_2:
         {
             Assert(startPosition <= thisStrLen);
             Assert(searchStrLen <= thisStrLen - startPosition);
-            if (wmemcmp(thisStr + startPosition, searchStr, searchStrLen) == 0)
+            if (StringUtilities::Equals(thisStr + startPosition, searchStr, searchStrLen))
             {
                 return scriptContext->GetLibrary()->GetTrue();
             }
@@ -2703,6 +2685,15 @@ case_2:
         return m_pszValue;
     }
 
+    const byte * JavascriptString::TryGetLatin1Buffer() const
+    {
+        if (VirtualTableInfo<Latin1String>::HasVirtualTable(this))
+        {
+            return static_cast<const Latin1String *>(this)->GetLatin1Buffer();
+        }
+        return nullptr;
+    }
+
     void const * JavascriptString::GetOriginalStringReference()
     {
         // Just return the string buffer
@@ -3014,6 +3005,17 @@ case_2:
 
     bool JavascriptString::Equals(Var aLeft, Var aRight)
     {
+        AssertMsg(JavascriptString::Is(aLeft) && JavascriptString::Is(aRight), "string comparison");
+
+        // Compare one-byte strings without widening them
+        const byte *leftLatin1 = JavascriptString::FromVar(aLeft)->TryGetLatin1Buffer();
+        const byte *rightLatin1 = JavascriptString::FromVar(aRight)->TryGetLatin1Buffer();
+        if (leftLatin1 != nullptr && rightLatin1 != nullptr)
+        {
+            const charcount_t length = JavascriptString::FromVar(aLeft)->GetLength();
+            return length == JavascriptString::FromVar(aRight)->GetLength() && memcmp(leftLatin1, rightLatin1, length) == 0;
+        }
+
         return JavascriptStringHelpers<JavascriptString>::Equals(aLeft, aRight);
     }
 
@@ -3361,7 +3363,7 @@ case_2:
             // first character match, keep checking
             if (*p == searchLast)
             {
-                if ( wmemcmp(p-searchLen+1, searchStr, searchLen) == 0 )
+                if (StringUtilities::Equals(p - searchLen + 1, searchStr, searchLen))
                 {
                     break;
                 }
@@ -3404,7 +3406,7 @@ case_2:
             // first character match, keep checking
             if (*p == searchFirst)
             {
-                if ( wmemcmp(p, searchStr, searchLen) == 0 )
+                if (StringUtilities::Equals(p, searchStr, searchLen))
                 {
                     break;
                 }
@@ -3486,8 +3488,6 @@ case_2:
 
     uint JavascriptString::strstr(JavascriptString *string, JavascriptString *substring, bool useBoyerMoore, uint start)
     {
-        uint i;
-
         const char16 *stringOrig = string->GetString();
         uint stringLenOrig = string->GetLength();
         const char16 *stringSz = stringOrig + start;
@@ -3495,7 +3495,7 @@ case_2:
         uint stringLen = stringLenOrig - start;
         uint substringLen = substring->GetLength();
 
-        if (useBoyerMoore && substringLen > 2)
+        if (useBoyerMoore && substringLen >= MinBoyerMooreSearchLength)
         {
             JmpTable jmpTable;
             bool fAsciiJumpTable = BuildLastCharForwardBoyerMooreTable(jmpTable, substringSz, substringLen);
@@ -3520,16 +3520,10 @@ case_2:
             {
                 return 0;
             }
-            for (i = 0; i <= stringLen - substringLen; i++)
+            int index = StringUtilities::IndexOf(stringSz, stringLen, substringSz, substringLen);
+            if (index != -1)
             {
-                // Quick check for first character.
-                if (stringSz[i] == substringSz[0])
-                {
-                    if (substringLen == 1 || memcmp(stringSz+i+1, substringSz+1, (substringLen-1)*sizeof(char16)) == 0)
-                    {
-                        return i + start;
-                    }
-                }
+                return index + start;
             }
         }
 
@@ -3541,7 +3535,7 @@ case_2:
         uint string1Len = string1->GetLength();
         uint string2Len = string2->GetLength();
 
-        int result = wmemcmp(string1->GetString(), string2->GetString(), min(string1Len, string2Len));
+        int result = StringUtilities::Compare(string1->GetString(), string2->GetString(), min(string1Len, string2Len));
 
         return (result == 0) ? (int)(string1Len - string2Len) : result;
     }
@@ -3889,11 +3883,7 @@ case_2:
             return false;
         }
 
-        if (wmemcmp(leftString->GetString(), rightString->GetString(), leftString->GetLength()) == 0)
-        {
-            return true;
-        }
-        return false;
+        return StringUtilities::Equals(leftString->GetString(), rightString->GetString(), leftString->GetLength());
     }
 
 #if ENABLE_NATIVE_CODEGEN
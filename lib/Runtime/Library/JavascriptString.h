@@ -75,6 +75,7 @@ namespace Js
         const char16* UnsafeGetBuffer() const;
         LPCWSTR GetSzCopy(ArenaAllocator* alloc);   // Copy to an Arena
         const char16* GetString(); // Get string, may not be NULL terminated
+        const byte* TryGetLatin1Buffer() const; // One-byte contents if the string is still stored as Latin-1, otherwise nullptr
 
         // NumberUtil::FIntRadStrToDbl and parts of GlobalObject::EntryParseInt were refactored into ToInteger
         Var ToInteger(int radix = 0);
@@ -154,6 +155,9 @@ namespace Js
             ToLower,
             ToUpper
         };
+        // Shorter search strings are found faster by the vectorized scan in StringUtilities than by Boyer-Moore
+        static const charcount_t MinBoyerMooreSearchLength = 32;
+
         char16* GetSzCopy();   // get a copy of the inner string without compacting the chunks
 
         static Var ToCaseCore(JavascriptString* pThis, ToCase toCase);
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace Js
+{
+    Latin1String::Latin1String(StaticType* type, const byte* latin1Buffer, charcount_t charLength) :
+        JavascriptString(type, charLength, nullptr),
+        latin1Buffer(latin1Buffer)
+    {
+        Assert(latin1Buffer != nullptr);
+        Assert(charLength >= MinCompactLength);
+    }
+
+    bool Latin1String::ShouldCompact(charcount_t charLength)
+    {
+        return charLength >= MinCompactLength && !PHASE_OFF1(Js::Latin1StringPhase);
+    }
+
+    void Latin1String::Widen(__out_ecount(charLength) char16* buffer, __in_ecount(charLength) const byte* content, charcount_t charLength)
+    {
+        charcount_t i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64)
+        // Widen 16 characters at a time by interleaving the bytes with zeros
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 16 <= charLength; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&content[i]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&buffer[i]), _mm_unpacklo_epi8(bytes, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&buffer[i + 8]), _mm_unpackhi_epi8(bytes, zero));
+            }
+        }
+#endif
+
+        for (; i < charLength; i++)
+        {
+            buffer[i] = static_cast<char16>(content[i]);
+        }
+    }
+
+    JavascriptString* Latin1String::NewCopyBuffer(__in_ecount(charLength) const byte* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        AssertMsg(IsValidCharCount(charLength), "String length out of range");
+
+        if (charLength == 0)
+        {
+            return scriptContext->GetLibrary()->GetEmptyString();
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        if (!ShouldCompact(charLength))
+        {
+            char16* buffer = RecyclerNewArrayLeaf(recycler, char16, SafeSzSize(charLength));
+            Widen(buffer, content, charLength);
+            buffer[charLength] = _u('\0');
+            return JavascriptString::NewWithBuffer(buffer, charLength, scriptContext);
+        }
+
+        byte* latin1Buffer = RecyclerNewArrayLeaf(recycler, byte, charLength);
+        js_memcpy_s(latin1Buffer, charLength, content, charLength);
+
+        return RecyclerNew(recycler, Latin1String, scriptContext->GetLibrary()->GetStringTypeStatic(), latin1Buffer, charLength);
+    }
+
+    JavascriptString* Latin1String::NewCopyBuffer(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        if (!ShouldCompact(charLength))
+        {
+            return JavascriptString::NewCopyBuffer(content, charLength, scriptContext);
+        }
+
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            if (content[i] > 0xFF)
+            {
+                return JavascriptString::NewCopyBuffer(content, charLength, scriptContext);
+            }
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        byte* latin1Buffer = RecyclerNewArrayLeaf(recycler, byte, charLength);
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            latin1Buffer[i] = static_cast<byte>(content[i]);
+        }
+
+        return RecyclerNew(recycler, Latin1String, scriptContext->GetLibrary()->GetStringTypeStatic(), latin1Buffer, charLength);
+    }
+
+    const char16* Latin1String::GetSz()
+    {
+        Assert(!this->IsFinalized());
+        Assert(latin1Buffer != nullptr);
+
+        const charcount_t charLength = this->GetLength();
+        char16* buffer = RecyclerNewArrayLeaf(this->GetRecycler(), char16, SafeSzSize());
+        Widen(buffer, latin1Buffer, charLength);
+        buffer[charLength] = _u('\0');
+        this->SetBuffer(buffer);
+
+        // The one-byte copy is no longer needed; drop it and become an ordinary flat string so that GetSz
+        // does not get invoked again.
+        latin1Buffer = nullptr;
+        VirtualTableInfo<LiteralString>::SetVirtualTable(this);
+        return buffer;
+    }
+
+    void Latin1String::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+
+        // Widen straight into the destination (e.g. when flattening a concat tree) without materializing our own buffer
+        Widen(buffer, latin1Buffer, this->GetLength());
+    }
+
+    size_t Latin1String::GetAllocatedByteCount() const
+    {
+        if (latin1Buffer != nullptr)
+        {
+            return this->GetLength() * sizeof(byte);
+        }
+        return __super::GetAllocatedByteCount();
+    }
+}
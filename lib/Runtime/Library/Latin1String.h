@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    //
+    // A string whose characters all fit in one byte (U+0000 - U+00FF). The contents are kept as Latin-1 bytes,
+    // which halves the footprint of the string, and only widened to char16 when a consumer asks for the flat
+    // buffer (GetSz/GetString). Consumers that can work on one-byte data can use TryGetLatin1Buffer instead.
+    // Once widened, the string becomes a LiteralString and the byte buffer is released.
+    //
+    class Latin1String sealed : public JavascriptString
+    {
+    private:
+        const byte* latin1Buffer;
+
+        Latin1String(StaticType* type, const byte* latin1Buffer, charcount_t charLength);
+
+    protected:
+        DEFINE_VTABLE_CTOR(Latin1String, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+    public:
+        // Strings shorter than this are not worth the widening cost on first use.
+        static const charcount_t MinCompactLength = 16;
+
+        static JavascriptString* NewCopyBuffer(__in_ecount(charLength) const byte* content, charcount_t charLength, ScriptContext* scriptContext);
+        static JavascriptString* NewCopyBuffer(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext);
+
+        const byte* GetLatin1Buffer() const { return latin1Buffer; }
+        static uint32 GetOffsetOfLatin1Buffer() { return offsetof(Latin1String, latin1Buffer); }
+
+        virtual const char16* GetSz() override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+        virtual size_t GetAllocatedByteCount() const override;
+
+    private:
+        static bool ShouldCompact(charcount_t charLength);
+        static void Widen(__out_ecount(charLength) char16* buffer, __in_ecount(charLength) const byte* content, charcount_t charLength);
+    };
+}
@@ -0,0 +1,393 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is a deterministic hash table (after Tyler Close's design) used to hold
+// the items of ES6 Map and Set objects. Entries are stored inline, in insertion
+// order, in a single contiguous array. Each bucket holds the index of the most
+// recently added entry that hashes to it, and each entry holds the index of the
+// next entry in the same bucket, so a lookup walks a short chain of indices
+// and iteration is a linear walk over the entries array.
+//
+// Deleted entries are left in place with a null key so that the indices of the
+// other entries, and hence live iterators, are not disturbed. When the entries
+// array fills up the table is rebuilt into a new one: with the same capacity
+// if at least half of the entries were deleted, twice the capacity otherwise.
+// The table is also rebuilt at half the capacity when deletes leave it less
+// than a quarter full.
+//
+// Iterators must stay valid no matter what modifications are made during
+// iteration. Rather than tracking the active iterators, a table that has been
+// rebuilt records the table that replaced it, along with the indices of the
+// deleted entries that were dropped (or that it was cleared). An iterator that
+// finds its table has been replaced moves to the replacement and adjusts its
+// index by the number of dropped entries that preceded it. The old entries
+// array is released as soon as the table is replaced.
+//
+// Tagged ints, numbers that have an int32 value, and strings are hashed and
+// compared without going through the general SameValueZero comparison.
+
+namespace Js
+{
+    template <typename TData>
+    class MapOrSetDataTable
+    {
+    private:
+        static const int32 NoEntry = -1;
+        static const uint32 MinCapacity = 4;
+        // Number of entries per bucket when the table is full
+        static const uint32 EntriesPerBucket = 2;
+
+        struct Entry
+        {
+            TData data;
+            int32 chain;
+            // Kept so that rebuilding the table and walking a chain don't need to rehash or compare every key
+            hash_t hashCode;
+        };
+
+        class Table
+        {
+        public:
+            int32* buckets;
+            Entry* entries;
+            uint32 bucketCount;
+            uint32 capacity;
+            uint32 usedEntries;
+            uint32 liveCount;
+
+            // Set once this table has been replaced. Only the fields below are valid after that.
+            Table* nextTable;
+            uint32* removedEntries;
+            uint32 removedEntryCount;
+            bool cleared;
+
+            Table(Recycler* recycler, uint32 capacity) :
+                buckets(nullptr),
+                entries(nullptr),
+                bucketCount(capacity / EntriesPerBucket),
+                capacity(capacity),
+                usedEntries(0),
+                liveCount(0),
+                nextTable(nullptr),
+                removedEntries(nullptr),
+                removedEntryCount(0),
+                cleared(false)
+            {
+                Assert(capacity >= MinCapacity && Math::IsPow2(static_cast<int32>(capacity)));
+
+                buckets = RecyclerNewArrayLeaf(recycler, int32, bucketCount);
+                for (uint32 i = 0; i < bucketCount; i++)
+                {
+                    buckets[i] = NoEntry;
+                }
+                entries = RecyclerNewArrayZ(recycler, Entry, capacity);
+            }
+
+            void Release()
+            {
+                buckets = nullptr;
+                entries = nullptr;
+                bucketCount = 0;
+                capacity = 0;
+                usedEntries = 0;
+                liveCount = 0;
+            }
+        };
+
+        Table* table;
+
+    public:
+        MapOrSetDataTable(VirtualTableInfoCtorEnum) { };
+        MapOrSetDataTable() : table(nullptr) { }
+
+        class Iterator
+        {
+            Table* table;
+            uint32 index;
+        public:
+            Iterator() : table(nullptr), index(0) { }
+            Iterator(Table* table) : table(table), index(0) { }
+
+            bool Next()
+            {
+                if (table == nullptr)
+                {
+                    return false;
+                }
+
+                while (table->nextTable != nullptr)
+                {
+                    if (table->cleared)
+                    {
+                        index = 0;
+                    }
+                    else
+                    {
+                        // Skip over the entries dropped from before our position when the table was rebuilt
+                        uint32 removedBefore = 0;
+                        while (removedBefore < table->removedEntryCount && table->removedEntries[removedBefore] < index)
+                        {
+                            removedBefore++;
+                        }
+                        index -= removedBefore;
+                    }
+                    table = table->nextTable;
+                }
+
+                for (; index < table->usedEntries; index++)
+                {
+                    if (KeyOf(table->entries[index].data) != nullptr)
+                    {
+                        index++;
+                        return true;
+                    }
+                }
+
+                table = nullptr;
+                index = 0;
+                return false;
+            }
+
+            TData& Current()
+            {
+                Assert(table != nullptr && index > 0 && index <= table->usedEntries);
+                return table->entries[index - 1].data;
+            }
+        };
+
+        void Initialize(Recycler* recycler)
+        {
+            Assert(table == nullptr);
+            table = RecyclerNew(recycler, Table, recycler, MinCapacity);
+        }
+
+        bool IsInitialized() const
+        {
+            return table != nullptr;
+        }
+
+        int Count() const
+        {
+            return table->liveCount;
+        }
+
+        TData* Find(Var key)
+        {
+            int32 index = FindEntry(key, GetHashCode(key));
+            return index == NoEntry ? nullptr : &table->entries[index].data;
+        }
+
+        // Adds data if its key is not in the table already. Returns false if the key was found.
+        bool Add(const TData& data, Recycler* recycler)
+        {
+            return Insert<false>(data, recycler);
+        }
+
+        // Adds data, or replaces the data already in the table under the same key.
+        void Set(const TData& data, Recycler* recycler)
+        {
+            Insert<true>(data, recycler);
+        }
+
+        bool Remove(Var key, Recycler* recycler)
+        {
+            int32 index = FindEntry(key, GetHashCode(key));
+            if (index == NoEntry)
+            {
+                return false;
+            }
+
+            // Leave the entry in its chain, just drop the data so that the key no longer matches
+            ClearData(table->entries[index].data);
+            table->liveCount--;
+
+            if (table->capacity > MinCapacity && table->liveCount < table->capacity / 4)
+            {
+                Rehash(table->capacity / 2, recycler);
+            }
+            return true;
+        }
+
+        void Clear(Recycler* recycler)
+        {
+            if (table->usedEntries == 0)
+            {
+                return;
+            }
+
+            Table* newTable = RecyclerNew(recycler, Table, recycler, MinCapacity);
+            table->Release();
+            table->cleared = true;
+            table->nextTable = newTable;
+            table = newTable;
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(table);
+        }
+
+    private:
+        static Var KeyOf(Var data) { return data; }
+        static Var KeyOf(const JsUtil::KeyValuePair<Var, Var>& data) { return data.Key(); }
+        static void ClearData(Var& data) { data = nullptr; }
+        static void ClearData(JsUtil::KeyValuePair<Var, Var>& data) { data = JsUtil::KeyValuePair<Var, Var>(nullptr, nullptr); }
+
+        static hash_t GetHashCode(Var key)
+        {
+            // Numbers that are equal under SameValueZero must hash alike, whatever their representation, so every number
+            // with an int32 value (including -0) is hashed as that int32.
+            if (TaggedInt::Is(key))
+            {
+                return static_cast<hash_t>(TaggedInt::ToInt32(key));
+            }
+
+            int32 intValue;
+            switch (JavascriptOperators::GetTypeId(key))
+            {
+            case TypeIds_Number:
+                if (JavascriptNumber::TryGetInt32Value<true>(JavascriptNumber::GetValue(key), &intValue))
+                {
+                    return static_cast<hash_t>(intValue);
+                }
+                break;
+
+            case TypeIds_Int64Number:
+            case TypeIds_UInt64Number:
+                {
+                    __int64 v = JavascriptInt64Number::FromVar(key)->GetValue();
+                    if (v == static_cast<int32>(v))
+                    {
+                        return static_cast<hash_t>(static_cast<int32>(v));
+                    }
+                }
+                break;
+
+            case TypeIds_String:
+                {
+                    JavascriptString* str = JavascriptString::FromVar(key);
+                    return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(str->GetString(), str->GetLength());
+                }
+            }
+
+            // Other numbers hash as doubles, other keys by identity
+            return SameValueZeroComparer<Var>::GetHashCode(key);
+        }
+
+        static bool KeysEqual(Var x, Var y)
+        {
+            if (x == y)
+            {
+                return true;
+            }
+
+            if (TaggedInt::Is(x))
+            {
+                if (TaggedInt::Is(y))
+                {
+                    return false;
+                }
+            }
+            else if (JavascriptString::Is(x) && JavascriptString::Is(y))
+            {
+                JavascriptString* xString = JavascriptString::FromVar(x);
+                JavascriptString* yString = JavascriptString::FromVar(y);
+                return xString->GetLength() == yString->GetLength() &&
+                    JsUtil::CharacterBuffer<WCHAR>::StaticEquals(xString->GetString(), yString->GetString(), xString->GetLength());
+            }
+
+            return SameValueZeroComparer<Var>::Equals(x, y);
+        }
+
+        int32 FindEntry(Var key, hash_t hashCode) const
+        {
+            Assert(key != nullptr);
+
+            for (int32 i = table->buckets[hashCode & (table->bucketCount - 1)]; i != NoEntry; i = table->entries[i].chain)
+            {
+                const Entry& entry = table->entries[i];
+                Var entryKey = KeyOf(entry.data);
+                if (entry.hashCode == hashCode && entryKey != nullptr && KeysEqual(entryKey, key))
+                {
+                    return i;
+                }
+            }
+            return NoEntry;
+        }
+
+        template <bool overwrite>
+        bool Insert(const TData& data, Recycler* recycler)
+        {
+            Var key = KeyOf(data);
+            hash_t hashCode = GetHashCode(key);
+
+            int32 index = FindEntry(key, hashCode);
+            if (index != NoEntry)
+            {
+                if (overwrite)
+                {
+                    table->entries[index].data = data;
+                }
+                return false;
+            }
+
+            if (table->usedEntries == table->capacity)
+            {
+                // Compact in place if enough of the entries have been deleted, otherwise grow
+                uint32 newCapacity = table->liveCount > table->capacity / 2 ? UInt32Math::Mul(table->capacity, 2) : table->capacity;
+                Rehash(newCapacity, recycler);
+            }
+
+            AppendEntry(table, data, hashCode);
+            table->liveCount++;
+            return true;
+        }
+
+        static void AppendEntry(Table* t, const TData& data, hash_t hashCode)
+        {
+            Assert(t->usedEntries < t->capacity);
+
+            int32* bucket = &t->buckets[hashCode & (t->bucketCount - 1)];
+            int32 index = static_cast<int32>(t->usedEntries++);
+            t->entries[index].data = data;
+            t->entries[index].chain = *bucket;
+            t->entries[index].hashCode = hashCode;
+            *bucket = index;
+        }
+
+        void Rehash(uint32 newCapacity, Recycler* recycler)
+        {
+            Assert(newCapacity >= table->liveCount);
+
+            Table* oldTable = table;
+            Table* newTable = RecyclerNew(recycler, Table, recycler, newCapacity);
+
+            uint32 removedEntryCount = oldTable->usedEntries - oldTable->liveCount;
+            uint32* removedEntries = removedEntryCount == 0 ? nullptr : RecyclerNewArrayLeaf(recycler, uint32, removedEntryCount);
+            uint32 removedIndex = 0;
+
+            for (uint32 i = 0; i < oldTable->usedEntries; i++)
+            {
+                const Entry& entry = oldTable->entries[i];
+                if (KeyOf(entry.data) == nullptr)
+                {
+                    removedEntries[removedIndex++] = i;
+                    continue;
+                }
+                AppendEntry(newTable, entry.data, entry.hashCode);
+            }
+
+            Assert(removedIndex == removedEntryCount);
+            newTable->liveCount = oldTable->liveCount;
+
+            oldTable->Release();
+            oldTable->removedEntries = removedEntries;
+            oldTable->removedEntryCount = removedEntryCount;
+            oldTable->nextTable = newTable;
+            table = newTable;
+        }
+    };
+}
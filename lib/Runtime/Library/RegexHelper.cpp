@@ -11,6 +11,7 @@
 #include "RegexCompileTime.h"
 #include "RegexParser.h"
 #include "RegexPattern.h"
+#include "RegexProfiler.h"
 
 namespace Js
 {
@@ -217,6 +218,25 @@ namespace Js
             // never reached
         }
 
+        // The same regex may have been compiled already, here or in another script context of this thread
+        ThreadContext* threadContext = scriptContext->GetThreadContext();
+        UnifiedRegex::Program* sharedProgram = threadContext->GetSharedRegexProgram(UnifiedRegex::RegexKey(psz, csz, flags));
+        if (sharedProgram != nullptr)
+        {
+            END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
+#ifdef PROFILE_EXEC
+            scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+            UnifiedRegex::RegexPattern* sharedPattern = UnifiedRegex::RegexPattern::New(scriptContext, sharedProgram, isLiteralSource);
+            sharedPattern->hasSharedProgram = true;
+            return sharedPattern;
+        }
+        ArenaAllocator* sharedAllocator = threadContext->GetSharedRegexProgramAllocator();
+        if (sharedAllocator != nullptr)
+        {
+            rtAllocator = sharedAllocator;
+        }
+
         const auto recycler = scriptContext->GetRecycler();
         UnifiedRegex::Program* program = UnifiedRegex::Program::New(recycler, flags);
         parser.CaptureSourceAndGroups(recycler, program, psz, csz);
@@ -260,6 +280,13 @@ namespace Js
             scriptContext->GetRegexStatsDatabase()->EndProfile(stats, UnifiedRegex::RegexStats::Compile);
 #endif
 
+        if (sharedAllocator != nullptr && program->IsShareable())
+        {
+            const auto source = pattern->GetSource();
+            threadContext->AddSharedRegexProgram(UnifiedRegex::RegexKey(source.GetBuffer(), source.GetLength(), flags), program);
+            pattern->hasSharedProgram = true;
+        }
+
         END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
 #ifdef PROFILE_EXEC
         scriptContext->ProfileEnd(Js::RegexCompilePhase);
@@ -684,11 +711,11 @@ namespace Js
         return JavascriptBoolean::ToVar(!match.IsUndefined(), scriptContext);
     }
 
-    template<typename GroupFn>
+    template<typename AppendGroupFn>
     void RegexHelper::ReplaceFormatString
         ( ScriptContext* scriptContext
         , int numGroups
-        , GroupFn getGroup
+        , AppendGroupFn appendGroup
         , JavascriptString* input
         , const char16* matchedString
         , UnifiedRegex::GroupInfo match
@@ -697,7 +724,6 @@ namespace Js
         , __in_ecount(substitutions) CharCount* substitutionOffsets
         , CompoundString::Builder<64 * sizeof(void *) / sizeof(char16)>& concatenated )
     {
-        Var nonMatchValue = NonMatchValue(scriptContext, false);
         const CharCount inputLength = input->GetLength();
         const char16* replaceStr = replace->GetString();
         const CharCount replaceLength = replace->GetLength();
@@ -729,10 +755,7 @@ namespace Js
 
                 if (captureIndex < numGroups && (captureIndex != 0))
                 {
-                    Var group = getGroup(captureIndex, nonMatchValue);
-                    if (JavascriptString::Is(group))
-                        concatenated.Append(JavascriptString::FromVar(group));
-                    else if (group != nonMatchValue)
+                    if (!appendGroup(captureIndex))
                         concatenated.Append(replace, substitutionOffset, offset - substitutionOffset);
                 }
                 else
@@ -853,15 +876,20 @@ namespace Js
                 replace->GetLength(),
                 tempAlloc,
                 &substitutionOffsets);
-            auto getGroup = [&](int captureIndex, Var nonMatchValue) {
-                return captureIndex <= numberOfCaptures ? captures[captureIndex] : nonMatchValue;
+            auto appendGroup = [&](int captureIndex) -> bool {
+                if (captureIndex > numberOfCaptures || JavascriptOperators::IsUndefined(captures[captureIndex]))
+                    return true;
+                if (!JavascriptString::Is(captures[captureIndex]))
+                    return false;
+                resultBuilder.Append(JavascriptString::FromVar(captures[captureIndex]));
+                return true;
             };
             UnifiedRegex::GroupInfo match(position, matchStr->GetLength());
             int numGroups = numberOfCaptures + 1; // Take group 0 into account.
             ReplaceFormatString(
                 scriptContext,
                 numGroups,
-                getGroup,
+                appendGroup,
                 input,
                 matchStr->GetString(),
                 match,
@@ -1097,11 +1125,15 @@ namespace Js
                 concatenated.Append(input, offset, lastActualMatch.offset - offset);
                 if (substitutionOffsets != 0)
                 {
-                    auto getGroup = [&](int captureIndex, Var nonMatchValue) {
-                        return GetGroup(scriptContext, pattern, input, nonMatchValue, captureIndex);
+                    // Captures are appended straight from the input, without making a string of each
+                    auto appendGroup = [&](int captureIndex) -> bool {
+                        const UnifiedRegex::GroupInfo group = pattern->GetGroup(captureIndex);
+                        if (!group.IsUndefined())
+                            concatenated.Append(input, group.offset, group.length);
+                        return true;
                     };
                     const char16* matchedString = inputStr + lastActualMatch.offset;
-                    ReplaceFormatString(scriptContext, pattern->NumGroups(), getGroup, input, matchedString, lastActualMatch, replace, substitutions, substitutionOffsets, concatenated);
+                    ReplaceFormatString(scriptContext, pattern->NumGroups(), appendGroup, input, matchedString, lastActualMatch, replace, substitutions, substitutionOffsets, concatenated);
                 }
                 else
                 {
@@ -1181,6 +1213,37 @@ namespace Js
         }
     }
 
+    // Number of groups, starting with the overall match, that a replace function can see. A strict mode function that
+    // has no rest parameter, doesn't use its arguments object and can't call eval only sees the arguments its formal
+    // parameters bind, so the captures after those don't need to be made into strings.
+    int RegexHelper::GetObservableReplaceGroupCount(ScriptContext* scriptContext, JavascriptFunction* replacefn, int numGroups)
+    {
+        if (!ScriptFunction::Is(replacefn) || scriptContext->IsScriptContextInDebugMode())
+        {
+            return numGroups;
+        }
+
+        FunctionProxy* proxy = ScriptFunction::FromVar(replacefn)->GetFunctionProxy();
+        if (proxy == nullptr || !proxy->IsFunctionBody())
+        {
+            return numGroups;
+        }
+
+        FunctionBody* body = proxy->GetFunctionBody();
+        if (!body->GetIsStrictMode() ||
+            body->GetHasRestParameter() ||
+            body->GetUsesArgumentsObject() ||
+            body->GetCallsEval() ||
+            body->GetChildCallsEval() ||
+            body->GetIsAsmJsFunction())
+        {
+            return numGroups;
+        }
+
+        // The in-params count includes 'this'
+        return min(numGroups, (int)body->GetInParamsCount() - 1);
+    }
+
     // String.prototype.replace, replace value is a function (ES5 15.5.4.11)
     Var RegexHelper::RegexEs5ReplaceImpl(ScriptContext* scriptContext, JavascriptRegExp* regularExpression, JavascriptString* input, JavascriptFunction* replacefn)
     {
@@ -1228,6 +1291,11 @@ namespace Js
         replaceArgs[0] = scriptContext->GetLibrary()->GetUndefined();
         replaceArgs[numGroups + 2] = input;
 
+        // Captures the function can't see are left undefined rather than made into strings for every match
+        const int numObservableGroups = GetObservableReplaceGroupCount(scriptContext, replacefn, numGroups);
+        for (int groupId = numObservableGroups; groupId < numGroups; groupId++)
+            replaceArgs[groupId + 1] = nonMatchValue;
+
         if (offset > 0)
         {
             concatenated.Append(input, 0, min(offset, inputLength));
@@ -1247,7 +1315,7 @@ namespace Js
                 break;
 
             lastSuccessfulMatch = lastActualMatch;
-            for (int groupId = 0;  groupId < numGroups; groupId++)
+            for (int groupId = 0;  groupId < numObservableGroups; groupId++)
                 replaceArgs[groupId + 1] = GetGroup(scriptContext, pattern, input, nonMatchValue, groupId);
 #pragma prefast(suppress:6386, "The write index numGroups + 1 is in the bound")
             replaceArgs[numGroups + 1] = JavascriptNumber::ToVar(lastActualMatch.offset, scriptContext);
@@ -1418,21 +1486,8 @@ namespace Js
     {
         Assert(endExclusive >= startInclusive);
         Assert(endExclusive <= input->GetLength());
-        CharCount length = endExclusive - startInclusive;
-        JavascriptString* subString;
-        if (length == 0)
-        {
-            subString = scriptContext->GetLibrary()->GetEmptyString();
-        }
-        else if (length == 1)
-        {
-            subString = scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(input->GetString()[startInclusive]);
-        }
-        else
-        {
-            subString = SubString::New(input, startInclusive, length);
-        }
-        ary->DirectAppendItem(subString);
+        // Short pieces come from the same caches as the captures
+        ary->DirectAppendItem(GetString(scriptContext, input, nullptr, UnifiedRegex::GroupInfo(startInclusive, endExclusive - startInclusive)));
     }
 
     inline UnifiedRegex::RegexPattern *RegexHelper::GetSplitPattern(ScriptContext* scriptContext, JavascriptRegExp *regularExpression)
@@ -1634,12 +1689,15 @@ namespace Js
         RegexHelperTrace(scriptContext, UnifiedRegex::RegexStats::Split, regularExpression, input);
 #endif
 
-        JavascriptArray* ary = scriptContext->GetLibrary()->CreateArrayOnStack(stackAllocationPointer);
+        // The pieces are the result itself, so there's nothing to gather them into but the array. When the caller ignores
+        // the result, the matches are still run for their effect on the last match, but no array or pieces are made, and
+        // only the number of pieces that would have been appended is tracked against the limit.
+        JavascriptArray* ary = noResult ? nullptr : scriptContext->GetLibrary()->CreateArrayOnStack(stackAllocationPointer);
 
         if (limit == 0)
         {
             // SPECIAL CASE: Zero limit
-            return ary;
+            return noResult ? scriptContext->GetLibrary()->GetNull() : ary;
         }
 
         UnifiedRegex::RegexPattern *splitPattern = GetSplitPattern(scriptContext, regularExpression);
@@ -1649,6 +1707,7 @@ namespace Js
         const int numGroups = splitPattern->NumGroups();
         Var nonMatchValue = NonMatchValue(scriptContext, false);
         UnifiedRegex::GroupInfo lastSuccessfulMatch; // initially undefined
+        CharCount pieceCount = 0;
 
         RegexMatchState state;
         PrimBeginMatch(state, scriptContext, splitPattern, inputStr, inputLength, false);
@@ -1658,7 +1717,10 @@ namespace Js
             // SPECIAL CASE: Empty string
             UnifiedRegex::GroupInfo match = PrimMatch(state, scriptContext, splitPattern, inputLength, 0);
             if (match.IsUndefined())
-                ary->DirectAppendItem(input);
+            {
+                if (ary != nullptr)
+                    ary->DirectAppendItem(input);
+            }
             else
                 lastSuccessfulMatch = match;
         }
@@ -1688,22 +1750,24 @@ namespace Js
                     startOffset++;
                 else
                 {
-                    AppendSubString(scriptContext, ary, input, copyOffset, startOffset);
-                    if (ary->GetLength() >= limit)
+                    if (ary != nullptr)
+                        AppendSubString(scriptContext, ary, input, copyOffset, startOffset);
+                    if (++pieceCount >= limit)
                         break;
 
                     startOffset = copyOffset = endOffset;
 
                     for (int groupId = 1; groupId < numGroups; groupId++)
                     {
-                        ary->DirectAppendItem(GetGroup(scriptContext, splitPattern, input, nonMatchValue, groupId));
-                        if (ary->GetLength() >= limit)
+                        if (ary != nullptr)
+                            ary->DirectAppendItem(GetGroup(scriptContext, splitPattern, input, nonMatchValue, groupId));
+                        if (++pieceCount >= limit)
                             break;
                     }
                 }
             }
 
-            if (ary->GetLength() < limit)
+            if (ary != nullptr && pieceCount < limit)
                 AppendSubString(scriptContext, ary, input, copyOffset, inputLength);
         }
 
@@ -1721,7 +1785,7 @@ namespace Js
             , /* updateCtor */ true
             , /* useSplitPattern */ true );
 
-        return ary;
+        return noResult ? scriptContext->GetLibrary()->GetNull() : ary;
     }
 
     UnifiedRegex::GroupInfo
@@ -1829,7 +1893,13 @@ namespace Js
             w = scriptContext->GetRegexDebugWriter();
 #endif
 
-        pattern->rep.unified.matcher->Match
+        UnifiedRegex::Matcher* matcher = pattern->rep.unified.matcher;
+        UnifiedRegex::RegexProfiler* regexProfiler = scriptContext->GetThreadContext()->GetActiveRegexProfiler();
+        UnifiedRegex::RegexProfiler::Ticks sampleStartTicks = 0;
+        const bool isSampled = regexProfiler != nullptr && regexProfiler->BeginMatch(matcher, sampleStartTicks);
+        UnifiedRegex::AutoClearSampledMatch autoClearSampledMatch(matcher);
+
+        matcher->Match
             (state.input
                 , inputLength
                 , offset
@@ -1840,6 +1910,13 @@ namespace Js
 #endif
                 );
 
+        if (isSampled)
+        {
+            // The host may have restarted profiling while the match checked in with it
+            regexProfiler = scriptContext->GetThreadContext()->GetRegexProfiler();
+            regexProfiler->EndMatch(matcher, sampleStartTicks);
+        }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         if (REGEX_CONFIG_FLAG(RegexProfile))
             scriptContext->GetRegexStatsDatabase()->EndProfile(stats, UnifiedRegex::RegexStats::Execute);
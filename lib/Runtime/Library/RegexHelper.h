@@ -86,11 +86,15 @@ namespace Js
         static UnifiedRegex::GroupInfo PrimMatch(RegexMatchState& state, ScriptContext* scriptContext, UnifiedRegex::RegexPattern* pattern, CharCount inputLength, CharCount offset);
         static void PrimEndMatch(RegexMatchState& state, ScriptContext* scriptContext, UnifiedRegex::RegexPattern* pattern);
 
-        template<typename GroupFn>
+        static int GetObservableReplaceGroupCount(ScriptContext* scriptContext, JavascriptFunction* replacefn, int numGroups);
+
+        // appendGroup appends a capture to the result and returns true, or returns false if the capture's substitution
+        // pattern is to be kept as is
+        template<typename AppendGroupFn>
         static void ReplaceFormatString
             ( ScriptContext* scriptContext
             , int numGroups
-            , GroupFn getGroup
+            , AppendGroupFn appendGroup
             , JavascriptString* input
             , const char16* matchedString
             , UnifiedRegex::GroupInfo match
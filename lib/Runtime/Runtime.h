@@ -26,6 +26,8 @@ enum SymbolType : byte;
 namespace UnifiedRegex
 {
     struct RegexPattern;
+    struct Program;                                 // Used by ThreadContext.h
+    class RegexProfiler;                            // Used by ThreadContext.h
     template <typename T> class StandardChars;      // Used by ThreadContext.h
     struct TrigramAlphabet;
     struct RegexStacks;
@@ -502,6 +504,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/GlobalObject.h"
 
 #include "Library/LiteralString.h"
+#include "Library/Latin1String.h"
 #include "Library/ConcatString.h"
 #include "Library/CompoundString.h"
 #include "Library/PropertyString.h"
@@ -0,0 +1,267 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeTypePch.h"
+
+namespace Js
+{
+    MegamorphicPropertyCache::MegamorphicPropertyCache() : lookupCount(0), hitCount(0), cacheCount(0)
+    {
+        Clear();
+    }
+
+    size_t MegamorphicPropertyCache::EntryIndex(const Type *const type, const PropertyId id)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        CompileAssert((MegamorphicPropertyCache_NumEntries & MegamorphicPropertyCache_NumEntries - 1) == 0);
+
+        // Types are allocated at least (1 << PolymorphicInlineCacheShift) apart. Property IDs are small and dense, so spread
+        // them out before mixing them in, so that consecutive properties of one type don't collide with the next type.
+        const size_t typeBits = reinterpret_cast<size_t>(type) >> PolymorphicInlineCacheShift;
+        return (typeBits ^ (static_cast<size_t>(id) * 0x9E3779B1)) & MegamorphicPropertyCache_NumEntries - 1;
+    }
+
+    inline const MegamorphicPropertyCache::Entry *MegamorphicPropertyCache::TryGetEntry(const Type *const type, const PropertyId id)
+    {
+        lookupCount++;
+
+        const Entry &entry = entries[EntryIndex(type, id)];
+        if(entry.type != type || entry.id != id)
+        {
+            return nullptr;
+        }
+
+        hitCount++;
+        return &entry;
+    }
+
+    bool MegamorphicPropertyCache::TryGetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(propertyValueInfo);
+        Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
+
+        // Cross-context accesses need their values marshaled and are not worth caching here
+        if(PHASE_OFF1(MegamorphicPropertyCachePhase) || object->GetScriptContext() != requestContext)
+        {
+            return false;
+        }
+
+        Type *const type = object->GetType();
+        const Entry *const entry = TryGetEntry(type, propertyId);
+        if(!entry)
+        {
+        #if DBG_DUMP
+            if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+            {
+                CacheOperators::TraceCache(
+                    static_cast<InlineCache *>(nullptr),
+                    _u("MegamorphicPropertyCache get miss"),
+                    propertyId,
+                    requestContext,
+                    object);
+            }
+        #endif
+            return false;
+        }
+
+    #if DBG_DUMP
+        if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+        {
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                _u("MegamorphicPropertyCache get hit"),
+                propertyId,
+                requestContext,
+                object);
+        }
+    #endif
+
+        DynamicObject *const dynamicObject = DynamicObject::FromVar(object);
+        const PropertyIndex propertyIndex = entry->index;
+        const bool isInlineSlot = entry->isInlineSlot;
+
+        Assert(
+            dynamicObject->GetDynamicType()->GetTypeHandler()->InlineOrAuxSlotIndexToPropertyIndex(propertyIndex, isInlineSlot) ==
+            object->GetPropertyIndex(propertyId));
+
+        *propertyValue = isInlineSlot ? dynamicObject->GetInlineSlot(propertyIndex) : dynamicObject->GetAuxSlot(propertyIndex);
+        Assert(*propertyValue == JavascriptOperators::GetProperty(object, propertyId, requestContext));
+
+        CacheOperators::Cache<false, true, false>(
+            false,
+            dynamicObject,
+            false,
+            type,
+            nullptr,
+            propertyId,
+            propertyIndex,
+            isInlineSlot,
+            false,
+            0,
+            propertyValueInfo,
+            requestContext);
+
+        // The property is reloaded into the inline cache as a local property, so report it as one
+        if(operationInfo)
+        {
+            operationInfo->cacheType = CacheType_Local;
+            operationInfo->slotType = isInlineSlot ? SlotType_Inline : SlotType_Aux;
+        }
+        return true;
+    }
+
+    bool MegamorphicPropertyCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(propertyValueInfo);
+        Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
+
+        if(PHASE_OFF1(MegamorphicPropertyCachePhase) || object->GetScriptContext() != requestContext)
+        {
+            return false;
+        }
+
+        Type *const type = object->GetType();
+        const Entry *const entry = TryGetEntry(type, propertyId);
+        if(!entry || !entry->isSetPropertyAllowed)
+        {
+        #if DBG_DUMP
+            if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+            {
+                CacheOperators::TraceCache(
+                    static_cast<InlineCache *>(nullptr),
+                    _u("MegamorphicPropertyCache set miss"),
+                    propertyId,
+                    requestContext,
+                    object);
+            }
+        #endif
+            return false;
+        }
+
+    #if DBG_DUMP
+        if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+        {
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                _u("MegamorphicPropertyCache set hit"),
+                propertyId,
+                requestContext,
+                object);
+        }
+    #endif
+
+        DynamicObject *const dynamicObject = DynamicObject::FromVar(object);
+        const PropertyIndex propertyIndex = entry->index;
+        const bool isInlineSlot = entry->isInlineSlot;
+
+        Assert(!object->IsFixedProperty(propertyId));
+        Assert(
+            dynamicObject->GetDynamicType()->GetTypeHandler()->InlineOrAuxSlotIndexToPropertyIndex(propertyIndex, isInlineSlot) ==
+            object->GetPropertyIndex(propertyId));
+        Assert(object->CanStorePropertyValueDirectly(propertyId, false));
+
+        if(isInlineSlot)
+        {
+            dynamicObject->SetInlineSlot(SetSlotArguments(propertyId, propertyIndex, propertyValue));
+        }
+        else
+        {
+            dynamicObject->SetAuxSlot(SetSlotArguments(propertyId, propertyIndex, propertyValue));
+        }
+
+        CacheOperators::Cache<false, false, false>(
+            false,
+            dynamicObject,
+            false,
+            type,
+            nullptr,
+            propertyId,
+            propertyIndex,
+            isInlineSlot,
+            false,
+            0,
+            propertyValueInfo,
+            requestContext);
+
+        // The property is reloaded into the inline cache as a local property, so report it as one
+        if(operationInfo)
+        {
+            operationInfo->cacheType = CacheType_Local;
+            operationInfo->slotType = isInlineSlot ? SlotType_Inline : SlotType_Aux;
+        }
+        return true;
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        Assert(index != Constants::NoSlot);
+
+        if(PHASE_OFF1(MegamorphicPropertyCachePhase))
+        {
+            return;
+        }
+
+        // Entries are not invalidated when the type changes, so make sure that it won't change in place
+        type->SetHasBeenCached();
+
+        Entry &entry = entries[EntryIndex(type, id)];
+        entry.type = type;
+        entry.id = id;
+        entry.index = index;
+        entry.isInlineSlot = isInlineSlot;
+        entry.isSetPropertyAllowed = isSetPropertyAllowed;
+        cacheCount++;
+    }
+
+    void MegamorphicPropertyCache::ClearUnusedTypes(Recycler *const recycler)
+    {
+        for(size_t i = 0; i < MegamorphicPropertyCache_NumEntries; i++)
+        {
+            Entry &entry = entries[i];
+            if(entry.type != nullptr && !recycler->IsObjectMarked(entry.type))
+            {
+                entry.type = nullptr;
+                entry.id = Constants::NoProperty;
+            }
+        }
+    }
+
+    void MegamorphicPropertyCache::Clear()
+    {
+        for(size_t i = 0; i < MegamorphicPropertyCache_NumEntries; i++)
+        {
+            entries[i].type = nullptr;
+            entries[i].id = Constants::NoProperty;
+        }
+    }
+
+    void MegamorphicPropertyCache::PrintStats() const
+    {
+        Output::Print(_u("MegamorphicPropertyCache: lookups = %u, hits = %u (%.1f%%), entries cached = %u\n"),
+            lookupCount,
+            hitCount,
+            lookupCount == 0 ? 0.0 : hitCount * 100.0 / lookupCount,
+            cacheCount);
+    }
+}
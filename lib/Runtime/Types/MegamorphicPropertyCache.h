@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Must be a power of 2
+#define MegamorphicPropertyCache_NumEntries 4096
+
+namespace Js
+{
+    struct PropertyCacheOperationInfo;
+
+    //
+    // A fixed-size, hash-indexed cache of (type, property) -> slot, shared by all the call sites on a thread. It backs up the
+    // per-site inline caches and the per-type TypePropertyCache for sites that have seen more types than their polymorphic
+    // inline cache can hold: a type that has fallen out of a site's caches is likely to have been seen by some other site
+    // accessing the same property.
+    //
+    // Only own data properties are cached. Types are held weakly; entries whose type did not survive a collection are cleared
+    // from ThreadContext::PreSweepCallback. Entries are never otherwise invalidated, so a type must have been marked as cached
+    // (see Type::SetHasBeenCached) before it is added, so that its layout can no longer change in place.
+    //
+    class MegamorphicPropertyCache
+    {
+    private:
+        struct Entry
+        {
+            Type *type;
+            PropertyId id;
+            PropertyIndex index;
+            bool isInlineSlot;
+            bool isSetPropertyAllowed;
+        };
+
+        Entry entries[MegamorphicPropertyCache_NumEntries];
+
+        uint lookupCount;
+        uint hitCount;
+        uint cacheCount;
+
+    public:
+        MegamorphicPropertyCache();
+
+    private:
+        static size_t EntryIndex(const Type *const type, const PropertyId id);
+        const Entry *TryGetEntry(const Type *const type, const PropertyId id);
+
+    public:
+        bool TryGetProperty(RecyclableObject *const object, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+        bool TrySetProperty(RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
+        void ClearUnusedTypes(Recycler *const recycler);
+        void Clear();
+
+        uint GetLookupCount() const { return lookupCount; }
+        uint GetHitCount() const { return hitCount; }
+        uint GetCacheCount() const { return cacheCount; }
+        void PrintStats() const;
+    };
+}
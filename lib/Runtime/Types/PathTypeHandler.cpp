@@ -1047,7 +1047,7 @@ namespace Js
         if (UsePathTypeHandlerForObjectLiteral(propIds, &check__proto__))
         {
 #ifdef PROFILE_OBJECT_LITERALS
-            scriptContext->objectLiteralCount[count]++;
+            scriptContext->objectLiteralCount[min(count, TypePath::MaxTinyDictionaryPathLength - 1)]++;
 #endif
             for (uint i = 0; i < count; i++)
             {
@@ -16,26 +16,33 @@ namespace Js {
     {
         Assert(size <= MaxPathTypeHandlerLength);
         size = max(size, InitialTypePathSize);
-
+        const uint requestedSize = size;
 
         if (PHASE_OFF1(Js::TypePathDynamicSizePhase))
         {
-            size = MaxPathTypeHandlerLength;
+            // Paths still grow past the TinyDictionary limit
+            size = PowerOf2Policy::GetSize(max(size, MaxTinyDictionaryPathLength));
+        }
+        else if (size > MaxTinyDictionaryPathLength)
+        {
+            // Wide paths don't use the allocation granularity gap, whose entries would be past a power of 2
+            size = PowerOf2Policy::GetSize(size);
         }
         else
         {
             size = PowerOf2Policy::GetSize(size - TYPE_PATH_ALLOC_GRANULARITY_GAP);
-            if (size < MaxPathTypeHandlerLength)
+            if (size < MaxTinyDictionaryPathLength)
             {
                 size += TYPE_PATH_ALLOC_GRANULARITY_GAP;
             }
         }
 
+        Assert(size >= requestedSize);
         Assert(size <= MaxPathTypeHandlerLength);
 
         TypePath * newTypePath = RecyclerNewPlusZ(recycler, sizeof(PropertyRecord *) * size, TypePath);
-        // Allocate enough space for the "next" for the TinyDictionary;
-        newTypePath->data = RecyclerNewPlusLeafZ(recycler, size, TypePath::Data, (uint8)size);
+        // Allocate enough space for the "next" for the TinyDictionary, or for the buckets and links of the WideDictionary
+        newTypePath->data = RecyclerNewPlusLeafZ(recycler, TypePath::Data::GetAllocSize(size), TypePath::Data, (uint16)size);
 
         return newTypePath;
     }
@@ -51,7 +58,7 @@ namespace Js {
            return Constants::NoSlot;
         }
         PropertyIndex propIndex = Constants::NoSlot;
-        if (this->GetData()->map.TryGetValue(propId, &propIndex,
+        if (this->GetData()->TryGetValue(propId, &propIndex,
                 static_cast<const PropertyRecord **>(assignments))) {
             if (propIndex<typePathLength) {
                 return propIndex;
@@ -73,7 +80,7 @@ namespace Js {
             branchedPath->AddInternal(assignments[i]);
 
 #ifdef SUPPORT_FIXED_FIELDS_ON_PATH_TYPES
-            if (couldSeeProto)
+            if (couldSeeProto && i < MaxFixedFieldPathLength)
             {
                 if (this->GetData()->usedFixedFields.Test(i))
                 {
@@ -137,9 +144,20 @@ namespace Js {
         // TypePath::New will take care of aligning this appropriately.
         TypePath * clonedPath = TypePath::New(recycler, currentPathLength + 1);
 
-        clonedPath->GetData()->pathLength = (uint8)currentPathLength;
-        memcpy(&clonedPath->GetData()->map, &this->GetData()->map, sizeof(TinyDictionary) + currentPathLength);
-        memcpy(clonedPath->assignments, this->assignments, sizeof(PropertyRecord *) * currentPathLength);
+        if (clonedPath->GetData()->IsWide())
+        {
+            // The wide index is sized by the path, so it has to be rebuilt rather than copied
+            for (uint i = 0; i < currentPathLength; i++)
+            {
+                clonedPath->GetData()->Add(this->assignments[i], clonedPath->assignments);
+            }
+        }
+        else
+        {
+            clonedPath->GetData()->pathLength = (uint16)currentPathLength;
+            memcpy(&clonedPath->GetData()->map, &this->GetData()->map, sizeof(TinyDictionary) + currentPathLength);
+            memcpy(clonedPath->assignments, this->assignments, sizeof(PropertyRecord *) * currentPathLength);
+        }
 
 #ifdef SUPPORT_FIXED_FIELDS_ON_PATH_TYPES
         // Copy fixed field info
@@ -177,7 +195,7 @@ namespace Js {
 
         DynamicObject* localSingletonInstance = this->singletonInstance->Get();
 
-        return localSingletonInstance != nullptr && localSingletonInstance->GetScriptContext() == requestContext && this->GetData()->fixedFields.Test(index) ? localSingletonInstance->GetSlot(index) : nullptr;
+        return localSingletonInstance != nullptr && localSingletonInstance->GetScriptContext() == requestContext && GetIsFixedFieldAt(index, typePathLength) ? localSingletonInstance->GetSlot(index) : nullptr;
 #else
         return nullptr;
 #endif
@@ -195,12 +213,19 @@ namespace Js {
 
 #if DBG
         PropertyIndex temp;
-        if (this->map.TryGetValue(propId->GetPropertyId(), &temp, assignments))
+        if (this->TryGetValue(propId->GetPropertyId(), &temp, assignments))
         {
             AssertMsg(false, "Adding a duplicate to the type path");
         }
 #endif
-        this->map.Add((unsigned int)propId->GetPropertyId(), (byte)currentPathLength);
+        if (this->IsWide())
+        {
+            this->GetWideMap()->Add(propId->GetPropertyId(), (uint16)currentPathLength, this->pathSize);
+        }
+        else
+        {
+            this->map.Add((unsigned int)propId->GetPropertyId(), (byte)currentPathLength);
+        }
         assignments[currentPathLength] = propId;
         this->pathLength++;
         return currentPathLength;
@@ -265,7 +290,7 @@ namespace Js {
         // This invariant is predicated on the properties getting initialized in the order of indexes in the type handler.
         Assert(instance != nullptr);
         Assert(this->singletonInstance == nullptr || this->singletonInstance->Get() == instance);
-        Assert(!this->GetData()->fixedFields.Test(index) && !this->GetData()->usedFixedFields.Test(index));
+        Assert(index >= MaxFixedFieldPathLength || (!this->GetData()->fixedFields.Test(index) && !this->GetData()->usedFixedFields.Test(index)));
 
         if (this->singletonInstance == nullptr)
         {
@@ -274,7 +299,7 @@ namespace Js {
 
         this->SetMaxInitializedLength(index + 1);
 
-        if (isFixed)
+        if (isFixed && index < MaxFixedFieldPathLength)
         {
             this->GetData()->fixedFields.Set(index);
         }
@@ -304,7 +329,7 @@ namespace Js {
         Assert(index < this->GetPathLength());
         Assert(typePathLength >= this->GetMaxInitializedLength());
         Assert(index >= this->GetMaxInitializedLength());
-        Assert(!this->GetData()->fixedFields.Test(index) && !this->GetData()->usedFixedFields.Test(index));
+        Assert(index >= MaxFixedFieldPathLength || (!this->GetData()->fixedFields.Test(index) && !this->GetData()->usedFixedFields.Test(index)));
 
         this->SetMaxInitializedLength(index + 1);
 
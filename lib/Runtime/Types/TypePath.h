@@ -54,6 +54,57 @@ public:
         }
     };
 
+    // Hashed property index used by type paths that are too long for TinyDictionary. It lives in the same
+    // trailing storage of TypePath::Data as the TinyDictionary would: one bucket head per path entry, followed
+    // by one chain link per path entry.
+    class WideDictionary
+    {
+        static const uint16 NIL = 0xffff;
+
+        uint16 entries[0];
+
+public:
+        static size_t GetAllocSize(uint pathSize)
+        {
+            return sizeof(uint16) * 2 * pathSize;
+        }
+
+        void Initialize(uint pathSize)
+        {
+            Assert(Math::IsPow2(pathSize));
+            memset(entries, 0xff, sizeof(uint16) * pathSize);
+        }
+
+        void Add(PropertyId key, uint16 value, uint pathSize)
+        {
+            uint16* buckets = entries;
+            uint16* next = entries + pathSize;
+            uint32 bucketIndex = key & (pathSize - 1);
+
+            next[value] = buckets[bucketIndex];
+            buckets[bucketIndex] = value;
+        }
+
+        template <class Data>
+        inline bool TryGetValue(PropertyId key, PropertyIndex* index, const Data& data, uint pathSize)
+        {
+            uint16* buckets = entries;
+            uint16* next = entries + pathSize;
+            uint32 bucketIndex = key & (pathSize - 1);
+
+            for (uint16 i = buckets[bucketIndex]; i != NIL; i = next[i])
+            {
+                if (data[i]->GetPropertyId() == key)
+                {
+                    *index = i;
+                    return true;
+                }
+                Assert(i != next[i]);
+            }
+            return false;
+        }
+    };
+
     class TypePath
     {
         friend class PathTypeHandlerBase;
@@ -72,36 +123,61 @@ public:
 #define TYPE_PATH_ALLOC_GRANULARITY_GAP 3
 #endif
 #endif
+        // Paths up to this size index their properties with a TinyDictionary; longer ones use a WideDictionary.
         // Although we can allocate 2 more, this will put struct Data into another bucket.  Just waste some slot in that case for 32-bit
-        static const uint MaxPathTypeHandlerLength = 128;
+        static const uint MaxTinyDictionaryPathLength = 128;
+        static const uint MaxPathTypeHandlerLength = 4096;
+        // Fixed fields are only tracked for the properties at the start of the path.
+        static const uint MaxFixedFieldPathLength = 128;
         static const uint InitialTypePathSize = 16 + TYPE_PATH_ALLOC_GRANULARITY_GAP;
 
     private:
 
         struct Data
         {
-            Data(uint8 pathSize) : pathSize(pathSize), pathLength(0)
+            Data(uint16 pathSize) : pathSize(pathSize), pathLength(0)
 #ifdef SUPPORT_FIXED_FIELDS_ON_PATH_TYPES
                 , maxInitializedLength(0)
 #endif
-            {}
+            {
+                if (IsWide())
+                {
+                    GetWideMap()->Initialize(pathSize);
+                }
+            }
 
 #ifdef SUPPORT_FIXED_FIELDS_ON_PATH_TYPES
-            BVStatic<MaxPathTypeHandlerLength> fixedFields;
-            BVStatic<MaxPathTypeHandlerLength> usedFixedFields;
+            BVStatic<MaxFixedFieldPathLength> fixedFields;
+            BVStatic<MaxFixedFieldPathLength> usedFixedFields;
 
             // We sometimes set up PathTypeHandlers and associate TypePaths before we create any instances
             // that populate the corresponding slots, e.g. for object literals or constructors with only
             // this statements.  This field keeps track of the longest instance associated with the given
             // TypePath.
-            uint8 maxInitializedLength;
+            uint16 maxInitializedLength;
 #endif
-            uint8 pathLength;      // Entries in use
-            uint8 pathSize;        // Allocated entries
+            uint16 pathLength;      // Entries in use
+            uint16 pathSize;        // Allocated entries
 
-            // This map has to be at the end, because TinyDictionary has a zero size array
+            // This map has to be at the end, because TinyDictionary has a zero size array.
+            // For wide paths its storage holds a WideDictionary instead.
             TinyDictionary map;
 
+            static size_t GetAllocSize(uint pathSize)
+            {
+                return pathSize > MaxTinyDictionaryPathLength ? WideDictionary::GetAllocSize(pathSize) : pathSize;
+            }
+
+            bool IsWide() const { return pathSize > MaxTinyDictionaryPathLength; }
+            WideDictionary * GetWideMap() { Assert(IsWide()); return reinterpret_cast<WideDictionary *>(&map); }
+
+            bool TryGetValue(PropertyId propId, PropertyIndex * index, const PropertyRecord ** assignments)
+            {
+                return IsWide() ?
+                    GetWideMap()->TryGetValue(propId, index, assignments, pathSize) :
+                    map.TryGetValue(propId, index, assignments);
+            }
+
             int Add(const PropertyRecord * propertyId, const PropertyRecord ** assignments);
         } * data;
 
@@ -157,8 +233,8 @@ public:
             return AddInternal(propertyRecord);
         }
 
-        uint8 GetPathLength() { return this->GetData()->pathLength; }
-        uint8 GetPathSize() { return this->GetData()->pathSize; }
+        uint16 GetPathLength() { return this->GetData()->pathLength; }
+        uint16 GetPathSize() { return this->GetData()->pathSize; }
 
         PropertyIndex Lookup(PropertyId propId,int typePathLength);
         PropertyIndex LookupInline(PropertyId propId,int typePathLength);
@@ -167,13 +243,13 @@ public:
         int AddInternal(const PropertyRecord* propId);
 
 #ifdef SUPPORT_FIXED_FIELDS_ON_PATH_TYPES
-        uint8 GetMaxInitializedLength() { return this->GetData()->maxInitializedLength; }
+        uint16 GetMaxInitializedLength() { return this->GetData()->maxInitializedLength; }
         void SetMaxInitializedLength(int newMaxInitializedLength)
         {
             Assert(newMaxInitializedLength >= 0);
             Assert(newMaxInitializedLength <= MaxPathTypeHandlerLength);
             Assert(this->GetMaxInitializedLength() <= newMaxInitializedLength);
-            this->GetData()->maxInitializedLength = (uint8)newMaxInitializedLength;
+            this->GetData()->maxInitializedLength = (uint16)newMaxInitializedLength;
         }
 
         Var GetSingletonFixedFieldAt(PropertyIndex index, int typePathLength, ScriptContext * requestContext);
@@ -222,7 +298,7 @@ public:
             Assert(index < typePathLength);
             Assert(typePathLength <= this->GetPathLength());
 
-            return this->GetData()->fixedFields.Test(index) != 0;
+            return index < MaxFixedFieldPathLength && this->GetData()->fixedFields.Test(index) != 0;
         }
 
         bool GetIsUsedFixedFieldAt(PropertyIndex index, int typePathLength)
@@ -231,14 +307,17 @@ public:
             Assert(index < typePathLength);
             Assert(typePathLength <= this->GetPathLength());
 
-            return this->GetData()->usedFixedFields.Test(index) != 0;
+            return index < MaxFixedFieldPathLength && this->GetData()->usedFixedFields.Test(index) != 0;
         }
 
         void SetIsUsedFixedFieldAt(PropertyIndex index, int typePathLength)
         {
             Assert(index < this->GetMaxInitializedLength());
             Assert(CanHaveFixedFields(typePathLength));
-            this->GetData()->usedFixedFields.Set(index);
+            if (index < MaxFixedFieldPathLength)
+            {
+                this->GetData()->usedFixedFields.Set(index);
+            }
         }
 
         void ClearIsFixedFieldAt(PropertyIndex index, int typePathLength)
@@ -247,8 +326,11 @@ public:
             Assert(index < typePathLength);
             Assert(typePathLength <= this->GetPathLength());
 
-            this->GetData()->fixedFields.Clear(index);
-            this->GetData()->usedFixedFields.Clear(index);
+            if (index < MaxFixedFieldPathLength)
+            {
+                this->GetData()->fixedFields.Clear(index);
+                this->GetData()->usedFixedFields.Clear(index);
+            }
         }
 
         bool CanHaveFixedFields(int typePathLength)
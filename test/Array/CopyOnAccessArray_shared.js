@@ -0,0 +1,47 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// -force:CopyOnAccessArray
+// Identical copy-on-access array literals share their backing segment, across call sites and script contexts.
+// Writing to any of the arrays must not be visible through the others.
+
+function first() { return [10, 20, 30, 40, 50, 60]; }
+function second() { return [10, 20, 30, 40, 50, 60]; }
+function different() { return [10, 20, 30, 40, 50, 61]; }
+
+var other = WScript.LoadScript(
+    "function first() { return [10, 20, 30, 40, 50, 60]; }\n" +
+    "function read(a, i) { return a[i]; }", "samethread");
+
+var passed = true;
+function check(expected, actual, message) {
+    if (expected !== actual) {
+        WScript.Echo("FAIL: " + message + ": expected " + expected + ", got " + actual);
+        passed = false;
+    }
+}
+
+for (var iteration = 0; iteration < 3; iteration++) {
+    var a = first(), b = second(), c = different(), d = other.first(), e = first();
+
+    check(60, b[5], "untouched literal from another call site");
+    a[5] = 1;
+    check(1, a[5], "written element");
+    check(60, b[5], "literal with the same contents at another call site");
+    check(60, e[5], "another array from the same call site");
+    check(60, d[5], "literal with the same contents in another script context");
+    check(61, c[5], "literal with different contents");
+
+    d[0] = -1;
+    check(-1, other.read(d, 0), "written element in the other script context");
+    check(10, other.read(other.first(), 0), "fresh literal in the other script context");
+    check(10, first()[0], "fresh literal after a write in the other script context");
+
+    b.push(70);
+    check(7, b.length, "pushed array");
+    check(6, second().length, "fresh literal after a push");
+}
+
+WScript.Echo(passed ? "pass" : "fail");
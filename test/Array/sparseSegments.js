@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Sparse arrays written at scattered indices end up with many segments, which are looked up through the
+// segment B-tree once there are enough of them, and small neighboring segments are grown to take in nearby
+// writes. Check the elements against a plain object that mirrors every write.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Deterministic pseudo-random numbers so that failures reproduce
+var seed = 12345;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % n;
+}
+
+function checkElements(array, expected, range, message) {
+    var count = 0;
+    for (var i = 0; i < range; i++) {
+        if (expected.hasOwnProperty(i)) {
+            assert.areEqual(expected[i], array[i], message + ": element " + i);
+            count++;
+        } else {
+            assert.isFalse(i in array, message + ": hole " + i);
+        }
+    }
+    var keys = Object.keys(array);
+    assert.areEqual(count, keys.length, message + ": number of elements");
+    for (var k = 1; k < keys.length; k++) {
+        assert.isTrue(+keys[k - 1] < +keys[k], message + ": keys are in ascending order");
+    }
+}
+
+function makeValue(kind, i) {
+    return kind === "int" ? i * 3 : kind === "float" ? i + 0.5 : "v" + i;
+}
+
+var kinds = ["int", "float", "var"];
+
+var tests = [
+    {
+        name: "Random writes over a sparse range",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var array = [], expected = {};
+                var range = 20000;
+                for (var n = 0; n < 3000; n++) {
+                    var i = random(range);
+                    array[i] = makeValue(kind, i);
+                    expected[i] = array[i];
+                }
+                checkElements(array, expected, range, kind);
+            });
+        }
+    },
+    {
+        name: "Descending writes with small gaps grow segments to the front",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var array = [], expected = {};
+                for (var block = 0; block < 200; block++) {
+                    var base = 100000 + block * 1000;
+                    array[base] = makeValue(kind, base);
+                    expected[base] = array[base];
+                }
+                for (var block = 0; block < 200; block++) {
+                    var base = 100000 + block * 1000;
+                    for (var i = base - 3; i > base - 200; i -= 3 + random(4)) {
+                        array[i] = makeValue(kind, i);
+                        expected[i] = array[i];
+                    }
+                }
+                checkElements(array, expected, 300000, kind);
+                assert.areEqual(100000 + 199 * 1000 + 1, array.length, kind + ": length");
+            });
+        }
+    },
+    {
+        name: "Deletes, truncation and array methods on a fragmented array",
+        body: function () {
+            var array = [], expected = {};
+            for (var n = 0; n < 2000; n++) {
+                var i = random(50000);
+                array[i] = i;
+                expected[i] = i;
+            }
+            for (var n = 0; n < 500; n++) {
+                var i = random(50000);
+                delete array[i];
+                delete expected[i];
+            }
+            checkElements(array, expected, 50000, "after deletes");
+
+            array.length = 25000;
+            for (var i in expected) {
+                if (+i >= 25000) {
+                    delete expected[i];
+                }
+            }
+            checkElements(array, expected, 50000, "after truncation");
+
+            var keys = Object.keys(expected);
+            var last = +keys[keys.length - 1];
+            assert.areEqual(last, array.lastIndexOf(last), "lastIndexOf");
+            assert.areEqual(+keys[0], array.indexOf(+keys[0]), "indexOf");
+
+            var sum = 0, expectedSum = 0;
+            array.forEach(function (v) { sum += v; });
+            keys.forEach(function (k) { expectedSum += +k; });
+            assert.areEqual(expectedSum, sum, "forEach visits every element once");
+        }
+    },
+    {
+        name: "fill over a fragmented array stores the range in one go",
+        body: function () {
+            kinds.forEach(function (kind) {
+                var array = [], expected = {};
+                var range = 30000;
+                for (var n = 0; n < 2000; n++) {
+                    var i = random(range);
+                    array[i] = makeValue(kind, i);
+                    expected[i] = array[i];
+                }
+                array[range - 1] = makeValue(kind, range - 1);
+                expected[range - 1] = array[range - 1];
+
+                var value = makeValue(kind, 7);
+                array.fill(value, 5000, 20000);
+                for (var i = 5000; i < 20000; i++) {
+                    expected[i] = value;
+                }
+                checkElements(array, expected, range, kind + ": after fill");
+                assert.areEqual(range, array.length, kind + ": fill doesn't change the length");
+
+                // Values the array can't hold as it is go through the element-by-element path
+                array.fill("s", 0, 10);
+                for (var i = 0; i < 10; i++) {
+                    expected[i] = "s";
+                }
+                checkElements(array, expected, range, kind + ": after filling with a string");
+            });
+        }
+    },
+    {
+        name: "fill sees setters on the prototype chain for holes",
+        body: function () {
+            var array = [1, 2, , 4];
+            var setterCalls = 0;
+            Object.defineProperty(Array.prototype, "2", { set: function (v) { setterCalls++; }, configurable: true });
+            try {
+                array.fill(9);
+            } finally {
+                delete Array.prototype[2];
+            }
+            assert.areEqual(1, setterCalls, "the setter is called for the hole");
+            assert.isFalse(array.hasOwnProperty(2), "the setter took the hole's value");
+            assert.areEqual(9, array[3], "other elements are filled");
+        }
+    },
+    {
+        name: "fill of a non-extensible array with holes throws",
+        body: function () {
+            var array = [1, , 3];
+            Object.preventExtensions(array);
+            assert.throws(function () { array.fill(0); }, TypeError, "filling a hole adds a property");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Exercises the byte code pairs that the interpreter runs as super-instructions
+// (Ld_A + Ld_A, Ld_A + Br, LdUndef + Br), including branches that land between the two halves.
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+function swap(a, b) {
+    var t = a;
+    a = b;
+    b = t;
+    return a * 10 + b;
+}
+
+function early(x) {
+    if (x > 2) {
+        return x;
+    }
+    var y = x;
+    if (y === 0) {
+        return;
+    }
+    return y + 1;
+}
+
+function loop(n) {
+    var last = 0, cur = 1, next;
+    for (var i = 0; i < n; i++) {
+        next = last + cur;
+        last = cur;
+        cur = next;
+    }
+    return last;
+}
+
+function conditional(c, a, b) {
+    var r = c ? a : b;
+    return r;
+}
+
+for (var iter = 0; iter < 100; iter++) {
+    check(swap(1, 2), 21, "swap");
+    check(early(5), 5, "early(5)");
+    check(early(0), undefined, "early(0)");
+    check(early(1), 2, "early(1)");
+    check(loop(10), 55, "loop(10)");
+    check(conditional(true, "a", "b"), "a", "conditional(true)");
+    check(conditional(false, "a", "b"), "b", "conditional(false)");
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
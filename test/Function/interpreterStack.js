@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Interpreter frames are allocated on a per-thread interpreter stack. Recurse deep enough to span several
+// of its segments, collect while the frames are live, and unwind through exceptions to check that the
+// stack is popped correctly.
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+function recurse(n) {
+    var local = { value: n };
+    if (n === 0) {
+        CollectGarbage();
+        return 0;
+    }
+    var result = recurse(n - 1);
+    return result + local.value;
+}
+
+function thrower(n) {
+    var local = [n];
+    if (n === 0) {
+        throw new Error("bottom");
+    }
+    try {
+        return thrower(n - 1);
+    } finally {
+        local.push(n);
+    }
+}
+
+function generatorUser(n) {
+    function* gen() {
+        for (var i = 0; i < n; i++) {
+            yield recurse(i);
+        }
+    }
+    var sum = 0;
+    for (var value of gen()) {
+        sum += value;
+    }
+    return sum;
+}
+
+for (var iter = 0; iter < 3; iter++) {
+    check(recurse(2000), 2001000, "recurse(2000)");
+
+    try {
+        thrower(1000);
+        check(true, false, "thrower should throw");
+    } catch (e) {
+        check(e.message, "bottom", "thrower message");
+    }
+
+    check(recurse(100), 5050, "recurse(100) after unwinding");
+    check(generatorUser(20), 1330, "generatorUser(20)");
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Property accesses at sites that see more types than fit in their polymorphic inline caches.
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+var shapeCount = 64;
+function makeObjects() {
+    var objects = [];
+    for (var i = 0; i < shapeCount; i++) {
+        var o = {};
+        // Give each object a different shape, with 'x' at a different slot
+        for (var j = 0; j < i % 16; j++) {
+            o["p" + i + "_" + j] = j;
+        }
+        o.x = i;
+        o.y = -i;
+        objects.push(o);
+    }
+    return objects;
+}
+
+function getX(o) { return o.x; }
+function getX2(o) { return o.x; }
+function setY(o, v) { o.y = v; }
+function getY(o) { return o.y; }
+
+var objects = makeObjects();
+
+for (var iter = 0; iter < 20; iter++) {
+    for (var i = 0; i < objects.length; i++) {
+        check(getX(objects[i]), i, "getX #" + i);
+        check(getX2(objects[i]), i, "getX2 #" + i);
+        setY(objects[i], i * iter);
+        check(getY(objects[i]), i * iter, "getY #" + i);
+    }
+}
+
+// Attribute changes must not be hidden by cached entries
+Object.defineProperty(objects[3], "y", { writable: false });
+setY(objects[3], 12345);
+check(getY(objects[3]), 3 * 19, "non-writable y");
+
+Object.freeze(objects[5]);
+setY(objects[5], 12345);
+check(getY(objects[5]), 5 * 19, "frozen y");
+
+delete objects[7].x;
+check(getX(objects[7]), undefined, "deleted x");
+Object.prototype.x = "proto";
+check(getX(objects[7]), "proto", "x from prototype");
+delete Object.prototype.x;
+
+Object.defineProperty(objects[9], "x", { get: function () { return "getter"; } });
+check(getX(objects[9]), "getter", "accessor x");
+
+// Types that are collected must not be confused with new types allocated at the same address
+objects = null;
+CollectGarbage();
+objects = makeObjects();
+for (var iter = 0; iter < 5; iter++) {
+    for (var i = 0; i < objects.length; i++) {
+        check(getX(objects[i]), i, "getX after GC #" + i);
+        setY(objects[i], iter);
+        check(getY(objects[i]), iter, "getY after GC #" + i);
+    }
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Large JSON texts are indexed up front so that the scanner can skip whitespace and find the end of strings a word
+// at a time. Check that they parse the same as small texts, which are scanned one character at a time.
+
+var passed = true;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAIL: " + message + "\n  expected: " + expected + "\n  actual:   " + actual);
+        passed = false;
+    }
+}
+
+function spaces(n) {
+    return new Array(n + 1).join(" ");
+}
+
+function checkSyntaxError(text, message) {
+    try {
+        JSON.parse(text);
+        check("no error", "SyntaxError", message);
+    } catch (e) {
+        check(e instanceof SyntaxError, true, message);
+    }
+}
+
+// Padding that takes a text past the size where indexing kicks in
+var padding = spaces(5000);
+
+var strings = ["", "plain", "say \"hi\"", "C:\\temp", "tab\there", "\u00e9\u4e2d\u2028\u2029", "\ud83d\ude00",
+    "/slash/", "a long string that runs over the end of one word of the index and into the next one, and beyond"];
+var numbers = [0, 7, -7, 42, 123456789, 1234567890, 98765432109876, 1.5, -0.25, 1e21, 1e-7, 2.5e10];
+
+var records = [];
+for (var i = 0; i < 300; i++) {
+    records.push({
+        id: i,
+        name: strings[i % strings.length],
+        value: numbers[i % numbers.length],
+        flags: [true, false, null],
+        nested: { text: strings[(i * 7) % strings.length], list: [i, -i, i / 4] }
+    });
+}
+
+// Compact, pretty-printed and tab-indented texts
+var expected = JSON.stringify(records);
+check(JSON.stringify(JSON.parse(expected)), expected, "compact");
+check(JSON.stringify(JSON.parse(JSON.stringify(records, null, 4))), expected, "pretty-printed");
+check(JSON.stringify(JSON.parse(JSON.stringify(records, null, "\t") + "\r\n")), expected, "tab-indented");
+
+// Each record on its own is below the size limit, and must match the same record out of the large text
+var parsed = JSON.parse(JSON.stringify(records, null, 2));
+for (var i = 0; i < records.length; i += 17) {
+    check(JSON.stringify(parsed[i]), JSON.stringify(JSON.parse(JSON.stringify(records[i]))), "record " + i);
+}
+
+// Strings starting at every offset in a word of the index, with and without escapes
+for (var offset = 0; offset < 70; offset++) {
+    for (var s = 0; s < strings.length; s++) {
+        var text = spaces(offset) + "[" + JSON.stringify(strings[s]) + "]" + padding;
+        check(JSON.parse(text)[0], strings[s], "string " + s + " at offset " + offset);
+    }
+    check(JSON.parse(spaces(offset) + '{"k\\u0041y":"v"}' + padding).kAy, "v", "escaped property name at offset " + offset);
+}
+
+// Numbers next to every delimiter, and the ones that need the full conversion
+var numberText = "[0,1 ,22\t,333\n,4444\r,55555]" + padding;
+check(JSON.stringify(JSON.parse(numberText)), "[0,1,22,333,4444,55555]", "integers before delimiters");
+var mixed = JSON.parse("[1e3, 10E-1, 12.5, 0.5, 123456789012, -0, 0, 999999999, 1000000000]" + padding);
+check(JSON.stringify(mixed), "[1000,1,12.5,0.5,123456789012,0,0,999999999,1000000000]", "numbers needing the full conversion");
+check(1 / mixed[5], -Infinity, "-0 keeps its sign");
+check(JSON.parse("{\"a\":5}" + padding).a, 5, "integer before a closing brace");
+
+// Errors are still reported for large texts
+checkSyntaxError("[" + padding + "01]", "leading zero");
+checkSyntaxError("[" + padding + "1.]", "no digit after the decimal point");
+checkSyntaxError("[" + padding + "\"unterminated]", "unterminated string");
+checkSyntaxError("[" + padding + "\"tab\there\"]", "control character in a string");
+checkSyntaxError("[" + padding + "\"\\x\"]", "bad escape");
+checkSyntaxError("[" + padding + "\"\\u12\"]", "short unicode escape");
+checkSyntaxError("[1]" + padding + "x", "trailing garbage");
+checkSyntaxError("[1," + padding, "missing closing bracket");
+checkSyntaxError("[" + padding + "1x]", "letter after a number");
+checkSyntaxError("[\"a\u0000b\"]" + padding, "NUL in a string");
+check(JSON.parse(padding + "\"\"" + padding), "", "empty string surrounded by whitespace");
+check(JSON.parse("[\"\u00ff\"]" + padding)[0], "\u00ff", "Latin-1 character");
+
+if (passed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Escaped strings are written straight into the buffer of the string tree that JSON.stringify builds when that tree
+// is flattened. Make sure they come out the same whether they are flattened on their own first or as part of the tree.
+
+var passed = true;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAIL: " + message + "\n  expected: " + expected + "\n  actual:   " + actual);
+        passed = false;
+    }
+}
+
+var value = {
+    quote: "say \"hi\"",
+    slash: "C:\\temp\\file",
+    control: "tab\there\nnew line\u0001\u001f",
+    prefix: "a long prefix that needs no escaping, then a quote: \"",
+    latin1: "caf\u00e9 na\u00efve r\u00e9sum\u00e9 \"quoted\" \u00ff",
+    nested: ["x\"y", { deeper: "\\\\" }]
+};
+var expected = '{"quote":"say \\"hi\\"","slash":"C:\\\\temp\\\\file","control":"tab\\there\\nnew line\\u0001\\u001f",' +
+    '"prefix":"a long prefix that needs no escaping, then a quote: \\"",' +
+    '"latin1":"caf\u00e9 na\u00efve r\u00e9sum\u00e9 \\"quoted\\" \u00ff","nested":["x\\"y",{"deeper":"\\\\\\\\"}]}';
+
+// Flatten the whole tree at once
+check(JSON.stringify(value), expected, "whole tree");
+
+// Flatten the pieces separately by stringifying them on their own first
+for (var key in value) {
+    var piece = JSON.stringify(value[key]);
+    check(expected.indexOf(piece) !== -1, true, "piece " + key);
+}
+
+// Round trip through a large tree
+var list = [];
+for (var i = 0; i < 1000; i++) {
+    list.push("item \"" + i + "\"\n\\");
+}
+var json = JSON.stringify(list);
+var parsed = JSON.parse(json);
+check(parsed.length, 1000, "round trip length");
+check(parsed[999], "item \"999\"\n\\", "round trip value");
+
+if (passed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects that share a type are stringified from a plan of their members built for the first of them. Check that
+// the output matches the general path, including when a toJSON method changes an object while it is stringified.
+
+var passed = true;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAIL: " + message + "\n  expected: " + expected + "\n  actual:   " + actual);
+        passed = false;
+    }
+}
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+    this["needs \"quotes\""] = x + y;
+}
+
+var points = [];
+for (var i = 0; i < 5; i++) {
+    points.push(new Point(i, -i));
+}
+check(JSON.stringify(points),
+    '[{"x":0,"y":0,"needs \\"quotes\\"":0},{"x":1,"y":-1,"needs \\"quotes\\"":0},{"x":2,"y":-2,"needs \\"quotes\\"":0},' +
+    '{"x":3,"y":-3,"needs \\"quotes\\"":0},{"x":4,"y":-4,"needs \\"quotes\\"":0}]', "same-shaped objects");
+check(JSON.stringify([new Point(1, 2), new Point(3, 4)], null, 2),
+    '[\n  {\n    "x": 1,\n    "y": 2,\n    "needs \\"quotes\\"": 3\n  },\n  {\n    "x": 3,\n    "y": 4,\n    "needs \\"quotes\\"": 7\n  }\n]',
+    "same-shaped objects with a gap");
+
+// Values that are left out, and nested objects of the same type
+var records = [
+    { a: 1, b: undefined, c: function () { }, d: { a: 2, b: "x", c: null, d: [] } },
+    { a: 3, b: "y", c: true, d: { a: 4, b: undefined, c: 5, d: {} } }
+];
+check(JSON.stringify(records),
+    '[{"a":1,"d":{"a":2,"b":"x","c":null,"d":[]}},{"a":3,"b":"y","c":true,"d":{"a":4,"c":5,"d":{}}}]', "skipped values");
+
+// Symbols, indexed properties, accessors and non-enumerable properties
+var symbolKey = Symbol("s");
+var withSymbol = [{ p: 1 }, { p: 2 }];
+withSymbol[1][symbolKey] = 3;
+withSymbol[1].q = 4;
+check(JSON.stringify(withSymbol), '[{"p":1},{"p":2,"q":4}]', "symbol-keyed property");
+var indexed = [{ p: 1 }, { p: 2 }];
+indexed[1][0] = "zero";
+check(JSON.stringify(indexed), '[{"p":1},{"0":"zero","p":2}]', "indexed property");
+var accessor = [{ p: 1 }, { p: 2 }];
+Object.defineProperty(accessor[1], "g", { get: function () { return "got"; }, enumerable: true });
+Object.defineProperty(accessor[1], "h", { value: "hidden", enumerable: false });
+check(JSON.stringify(accessor), '[{"p":1},{"p":2,"g":"got"}]', "accessor and non-enumerable property");
+
+// toJSON on a member value that changes the object being stringified
+function makeVictim(mutate) {
+    var victim = { first: null, second: 2, third: 3 };
+    victim.first = { toJSON: function () { mutate(victim); return "first"; } };
+    return victim;
+}
+var unchanged = { first: "first", second: 2, third: 3 };
+check(JSON.stringify([unchanged, makeVictim(function (o) { delete o.second; })]),
+    '[{"first":"first","second":2,"third":3},{"first":"first","third":3}]', "property deleted by toJSON");
+check(JSON.stringify([unchanged, makeVictim(function (o) { o.third = "changed"; o.fourth = 4; })]),
+    '[{"first":"first","second":2,"third":3},{"first":"first","second":2,"third":"changed"}]', "property added by toJSON");
+check(JSON.stringify([unchanged, makeVictim(function (o) { Object.defineProperty(o, "second", { get: function () { return "getter"; } }); })]),
+    '[{"first":"first","second":2,"third":3},{"first":"first","second":"getter","third":3}]', "property turned into an accessor");
+check(JSON.stringify([unchanged, makeVictim(function (o) { o.second = undefined; })]),
+    '[{"first":"first","second":2,"third":3},{"first":"first","third":3}]', "property set to undefined");
+
+// toJSON receives the property name
+var keys = [];
+var keyed = [];
+for (var i = 0; i < 3; i++) {
+    keyed.push({ name: { toJSON: function (key) { keys.push(key); return key; } } });
+}
+check(JSON.stringify(keyed), '[{"name":"name"},{"name":"name"},{"name":"name"}]', "toJSON result");
+check(keys.join(), "name,name,name", "toJSON key");
+
+// Replacers take the general path
+check(JSON.stringify([new Point(1, 2), new Point(3, 4)], function (k, v) { return k === "y" ? undefined : v; }),
+    '[{"x":1,"needs \\"quotes\\"":3},{"x":3,"needs \\"quotes\\"":7}]', "replacer function");
+check(JSON.stringify([new Point(1, 2), new Point(3, 4)], ["y"]), '[{"y":2},{"y":4}]', "replacer array");
+
+if (passed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,124 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects with more properties than a TinyDictionary can index keep using path types (with a hashed index).
+
+if (this.WScript && this.WScript.LoadScriptFile) {
+  this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+function makeWide(count, prefix) {
+  var obj = {};
+  for (var i = 0; i < count; i++) {
+    obj[prefix + i] = i;
+  }
+  return obj;
+}
+
+function checkWide(obj, count, prefix) {
+  for (var i = 0; i < count; i++) {
+    assert.areEqual(i, obj[prefix + i], prefix + i);
+  }
+  var keys = Object.keys(obj);
+  assert.areEqual(count, keys.length);
+  for (var i = 0; i < count; i++) {
+    assert.areEqual(prefix + i, keys[i]);
+  }
+}
+
+var Tests = [function () {
+    [100, 129, 300, 1000, 5000].forEach(function (count) {
+      checkWide(makeWide(count, "p"), count, "p");
+    });
+  },
+  function () {
+    // Two objects built the same way share their types, including past the first 128 properties
+    var obj1 = makeWide(400, "q");
+    var obj2 = makeWide(400, "q");
+    obj2.q399 = "changed";
+    assert.areEqual(399, obj1.q399);
+    assert.areEqual("changed", obj2.q399);
+
+    // Branch the shared path after 300 properties
+    var obj3 = makeWide(300, "q");
+    obj3.other = "branch";
+    assert.areEqual("branch", obj3.other);
+    assert.areEqual(undefined, obj1.other);
+    assert.areEqual(undefined, obj3.q300);
+    checkWide(obj1, 400, "q");
+  },
+  function () {
+    // Inline caches on properties at the end of a wide path
+    var objs = [makeWide(350, "r"), makeWide(350, "r"), makeWide(350, "r")];
+    function read(o) { return o.r0 + o.r200 + o.r349; }
+    function write(o, v) { o.r349 = v; }
+    for (var i = 0; i < 50; i++) {
+      var o = objs[i % objs.length];
+      write(o, i);
+      assert.areEqual(0 + 200 + i, read(o));
+    }
+  },
+  function () {
+    // Wide object literals
+    var source = "({";
+    for (var i = 0; i < 600; i++) {
+      source += (i ? "," : "") + "s" + i + ":" + i;
+    }
+    source += "})";
+    var literal1 = eval(source);
+    var literal2 = eval(source);
+    checkWide(literal1, 600, "s");
+    literal2.s599 = -1;
+    assert.areEqual(599, literal1.s599);
+    assert.areEqual(-1, literal2.s599);
+  },
+  function () {
+    // Grow a path one property at a time across the TinyDictionary limit, where the path is reallocated, and branch
+    // it on each side of the limit
+    for (var count = 126; count <= 134; count++) {
+      var obj = makeWide(count, "g");
+      checkWide(obj, count, "g");
+      obj.extra = count;
+      assert.areEqual(count, obj.extra);
+      checkWide(makeWide(count + 1, "g"), count + 1, "g");
+    }
+  },
+  function () {
+    // Deleting and reconfiguring properties still converts to a dictionary
+    var obj = makeWide(300, "t");
+    delete obj.t150;
+    Object.defineProperty(obj, "t10", { enumerable: false });
+    assert.areEqual(undefined, obj.t150);
+    assert.areEqual(10, obj.t10);
+    assert.areEqual(298, Object.keys(obj).length);
+    assert.areEqual(299, obj.t299);
+  },
+  function () {
+    // Methods past the fixed field limit are called correctly after being overwritten
+    function Wide() {
+      for (var i = 0; i < 200; i++) {
+        this["u" + i] = i;
+      }
+      this.method = function () { return 1; };
+    }
+    var obj = new Wide();
+    function call(o) { return o.method(); }
+    for (var i = 0; i < 20; i++) {
+      assert.areEqual(1, call(obj));
+    }
+    obj.method = function () { return 2; };
+    for (var i = 0; i < 20; i++) {
+      assert.areEqual(2, call(obj));
+    }
+  }
+];
+
+for (var i = 0; i < 3; ++i) {
+  for (var j = 0; j < Tests.length; ++j) {
+    Tests[j]();
+  }
+}
+
+WScript.Echo("Pass");
@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Objects created by constructors whose property count changes the inline slot capacity of later objects.
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+function checkObject(o, count, value, message) {
+    check(Object.keys(o).length, count, message + " property count");
+    for (var j = 0; j < count; j++) {
+        check(o["p" + j], value + j, message + " p" + j);
+    }
+}
+
+// Adds many more properties than the default inline slot capacity
+function Wide(v) {
+    this.p0 = v; this.p1 = v + 1; this.p2 = v + 2; this.p3 = v + 3; this.p4 = v + 4;
+    this.p5 = v + 5; this.p6 = v + 6; this.p7 = v + 7; this.p8 = v + 8; this.p9 = v + 9;
+    this.p10 = v + 10; this.p11 = v + 11; this.p12 = v + 12; this.p13 = v + 13; this.p14 = v + 14;
+    this.p15 = v + 15; this.p16 = v + 16; this.p17 = v + 17; this.p18 = v + 18; this.p19 = v + 19;
+}
+
+var wides = [];
+for (var i = 0; i < 50; i++) {
+    wides.push(new Wide(i));
+}
+for (var i = 0; i < wides.length; i++) {
+    checkObject(wides[i], 20, i, "Wide #" + i);
+}
+
+// Adds a few properties, then more later on
+function Narrow(v) {
+    this.p0 = v;
+    this.p1 = v + 1;
+}
+
+var narrows = [];
+for (var i = 0; i < 50; i++) {
+    var o = new Narrow(i);
+    if (i > 10) {
+        for (var j = 2; j < 12; j++) {
+            o["p" + j] = i + j;
+        }
+    }
+    narrows.push(o);
+}
+for (var i = 0; i < narrows.length; i++) {
+    checkObject(narrows[i], i > 10 ? 12 : 2, i, "Narrow #" + i);
+}
+
+// Constructor that recurses into itself before adding its properties
+function Tree(depth) {
+    this.left = depth > 0 ? new Tree(depth - 1) : null;
+    this.right = depth > 0 ? new Tree(depth - 1) : null;
+    this.p0 = depth; this.p1 = depth + 1; this.p2 = depth + 2; this.p3 = depth + 3; this.p4 = depth + 4;
+    this.p5 = depth + 5; this.p6 = depth + 6; this.p7 = depth + 7; this.p8 = depth + 8; this.p9 = depth + 9;
+}
+
+function checkTree(t, depth) {
+    check(Object.keys(t).length, 12, "Tree property count");
+    for (var j = 0; j < 10; j++) {
+        check(t["p" + j], depth + j, "Tree p" + j);
+    }
+    if (depth > 0) {
+        checkTree(t.left, depth - 1);
+        checkTree(t.right, depth - 1);
+    }
+}
+
+for (var i = 0; i < 5; i++) {
+    checkTree(new Tree(4), 4);
+}
+
+// Prototype change in the middle of the observation phase
+function Changing(v) {
+    this.p0 = v; this.p1 = v + 1; this.p2 = v + 2; this.p3 = v + 3; this.p4 = v + 4;
+    this.p5 = v + 5; this.p6 = v + 6; this.p7 = v + 7; this.p8 = v + 8; this.p9 = v + 9;
+}
+var changing = [new Changing(0)];
+Changing.prototype = { isNew: true };
+for (var i = 1; i < 20; i++) {
+    changing.push(new Changing(i));
+}
+for (var i = 0; i < changing.length; i++) {
+    checkObject(changing[i], 10, i, "Changing #" + i);
+    check(changing[i].isNew, i === 0 ? undefined : true, "Changing #" + i + " prototype");
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
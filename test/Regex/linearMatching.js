@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Patterns without back-references or lookarounds switch to the linear-time matcher after -RegexBacktrackLimit
+// backtracks in one match, right away when the limit is 0, whether the backtracking happens in the interpreter or in
+// native code (-RegexJitThreshold). Their linear program is only compiled then. The result must be the one backtracking
+// would have found.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function describe(regex, input) {
+    regex.lastIndex = 0;
+    var result = regex.exec(input);
+    return JSON.stringify({ result: result, index: result && result.index });
+}
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+var tests = [
+    {
+        name: "Matches and groups are the ones backtracking finds",
+        body: function () {
+            var cases = [
+                [/(a|ab)(c|bcd)(d*)/, "abcd", "{\"result\":[\"abcd\",\"a\",\"bcd\",\"\"],\"index\":0}"],
+                [/(a+)+b/, "aaaaab", "{\"result\":[\"aaaaab\",\"aaaaa\"],\"index\":0}"],
+                [/(a*)*b/, "aab", "{\"result\":[\"aab\",\"aa\"],\"index\":0}"],
+                [/(a|b)*?c/, "ababc", "{\"result\":[\"ababc\",\"b\"],\"index\":0}"],
+                [/(a+?)(a*)/, "aaaa", "{\"result\":[\"aaaa\",\"a\",\"aaa\"],\"index\":0}"],
+                [/x(?:ab|a)(?:bc|c)y/, "--xabcy--", "{\"result\":[\"xabcy\"],\"index\":2}"],
+                [/(\d+)\.(\d*)e?/, "v 3.14e", "{\"result\":[\"3.14e\",\"3\",\"14\"],\"index\":2}"],
+                [/(foo|foobar)+x/, "foobarfoox", "{\"result\":[\"foobarfoox\",\"foo\"],\"index\":0}"],
+                [/^(\w+)\s+(\w+)$/m, "one\nhello world\ntwo", "{\"result\":[\"hello world\",\"hello\",\"world\"],\"index\":4}"],
+                [/(?:(a)|(b))+/, "ab", "{\"result\":[\"ab\",null,\"b\"],\"index\":0}"],
+                [/(z)((a+)?(b+)?(c))*/, "zaacbbbcac", "{\"result\":[\"zaacbbbcac\",\"z\",\"ac\",\"a\",null,\"c\"],\"index\":0}"],
+                [/[^,]*,[a-c]{2,3}?/i, "X,ABCD", "{\"result\":[\"X,AB\"],\"index\":0}"],
+                [/\b(\w)\w*\b.*?\1?x/, "hello wx", "{\"result\":[\"hello wx\",\"h\"],\"index\":0}"],
+                [/a{2,4}?b|a+/, "aaaaa", "{\"result\":[\"aaaaa\"],\"index\":0}"],
+                [/(\u00e9|e)+t/i, "\u00c9Et", "{\"result\":[\"\u00c9Et\",\"E\"],\"index\":0}"],
+                [/.*foo/, "xfooyfoo\nfoo", "{\"result\":[\"xfooyfoo\"],\"index\":0}"],
+            ];
+            for (var i = 0; i < cases.length; i++) {
+                assert.areEqual(cases[i][2], describe(cases[i][0], cases[i][1]), cases[i][0] + " on " + JSON.stringify(cases[i][1]));
+            }
+        }
+    },
+    {
+        name: "Catastrophic patterns",
+        body: function () {
+            var as = repeat("a", 40);
+            assert.areEqual(null, /(a|aa)*c/.exec(as), "(a|aa)*c without a match");
+            assert.areEqual(as + "c", /(a|aa)*c/.exec(as + "c")[0], "(a|aa)*c with a match");
+            assert.areEqual(null, /(x+x+)+y/.exec(repeat("x", 40)), "(x+x+)+y");
+            assert.isFalse(/^(\w+\s?)+$/.test(repeat("word ", 30) + "!"), "(\\w+\\s?)+$");
+            assert.areEqual(["aaab", as + "b"], ("-aaab-" + as + "b-" + as).match(/(a+)+b/g), "(a+)+b, global");
+        }
+    },
+    {
+        name: "Linear programs are compiled from the source on first use",
+        body: function () {
+            // Compiled again from the source once needed, so escapes and flags must come out the same
+            assert.areEqual("{\"result\":[\"a/bbbc\",\"b\"],\"index\":1}", describe(/a\/(b|bb)+c/, "-a/bbbc"), "escaped slash");
+            assert.areEqual("{\"result\":[\"\ud83d\ude00x\ud83d\ude00z\",\"\ud83d\ude00\"],\"index\":0}",
+                describe(/(.|\u{1F600})+z/u, "\u{1F600}x\u{1F600}z"), "unicode");
+            assert.areEqual("{\"result\":[\"ABab\",\"ab\"],\"index\":0}", describe(/(ab|a)+$/i, "ABab"), "ignore case");
+
+            // Loops whose body can match empty can't run in linear time. After the first match finds that out, later
+            // matches keep backtracking past the limit.
+            var emptyLoop = /(a*)*c/;
+            for (var i = 0; i < 3; i++) {
+                assert.areEqual(null, emptyLoop.exec(repeat("a", 12) + "b"), "empty loop body without a match, run " + i);
+                assert.areEqual("{\"result\":[\"aaaac\",\"aaaa\"],\"index\":0}", describe(emptyLoop, "aaaac"), "empty loop body, run " + i);
+            }
+        }
+    },
+    {
+        name: "Flags and start offsets",
+        body: function () {
+            var global = /(a|ab)(c|bcd)/g;
+            global.lastIndex = 0;
+            assert.areEqual("abcd", global.exec("xabcd abc")[0], "first global match");
+            assert.areEqual(5, global.lastIndex, "lastIndex after the first match");
+            assert.areEqual("abc", global.exec("xabcd abc")[0], "second global match");
+
+            var sticky = /(a|b)+c/y;
+            sticky.lastIndex = 1;
+            assert.isFalse(sticky.test("xxabc"), "sticky doesn't search");
+            sticky.lastIndex = 2;
+            assert.isTrue(sticky.test("xxabc"), "sticky at its offset");
+
+            assert.areEqual("x-y-z", "x1y22z".replace(/(\d|\d\d)+/g, "-"), "replace");
+            assert.areEqual(["a", "b", "c"], "a1b22c".split(/(?:\d|\d\d)+/), "split");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
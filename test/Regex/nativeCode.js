@@ -0,0 +1,103 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// With -RegexJitThreshold:2, regular expressions are compiled to native code at their second match where supported. Every
+// result after that must be the same as the interpreter's, which is what the first match of a fresh RegExp with the same
+// source gives.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var runs = 40;
+
+function describe(regex, input) {
+    var result = regex.exec(input);
+    return JSON.stringify({ result: result, index: result && result.index, lastIndex: regex.lastIndex });
+}
+
+function check(regex, inputs) {
+    for (var i = 0; i < inputs.length; i++) {
+        var expected = describe(new RegExp(regex.source, regex.flags), inputs[i]);
+        for (var run = 0; run < runs; run++) {
+            regex.lastIndex = 0;
+            assert.areEqual(expected, describe(regex, inputs[i]), regex + " on '" + inputs[i] + "', run " + run);
+        }
+    }
+}
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+var tests = [
+    {
+        name: "Characters, sets and literals",
+        body: function () {
+            check(/needle/, ["", "needle", "haystack with a needle in it", "needl", repeat("neEdle ", 10) + "needle"]);
+            check(/a[bc]d/, ["abd", "xxacd", "aed", repeat("x", 17) + "abd"]);
+            check(/[^\s,]+,/, ["one, two", "   ,", "abc"]);
+            check(/(a|b|c|d)x/, ["dx", "ex", "zzzbx"]);
+            check(/colou?r/, ["color", "colour", "colouur"]);
+            check(/\u4e2d[\u4e00-\u9fff\u3040-\u309f]+/, ["\u4e2d\u6587", "x\u4e2d\u3042z", "\u4e2d"]);
+            check(/[\u0100-\u017f\u2000-\u206f]/, ["abc\u0101", "\u2010", "\u00ff"]);
+            check(/x[xy][xyz]\u00e9/, ["xyz\u00e9", "xxx\u00e9", "xyze"]);
+        }
+    },
+    {
+        name: "Loops and backtracking",
+        body: function () {
+            check(/a[bc]+d/, ["abbcd", "ad", "abcbcbcx", "xabcd"]);
+            check(/x\d{2,4}y/, ["x1y", "x12y", "x12345y", "x1234y"]);
+            check(/[a-z]{3}\d*$/, ["abc", "abc123", "ab1", "123abc4"]);
+            check(/a.*b/, ["aXXbYYb", "ab", "a\nb", "a"]);
+            check(/\w+\d/, ["abc123", "abc", "1"]);
+            check(/<[^>]*>x/, ["<a>x", "<a><b>x", "<a>"]);
+            check(/(\d+)-(\d+)/, ["12-34", "1-", "a 5-6 b"]);
+        }
+    },
+    {
+        name: "Groups and alternatives",
+        body: function () {
+            check(/(\w+)@(\w+)\.com/, ["me@example.com", "me@example.org", "a@b.com c@d.com"]);
+            check(/(foo)?bar/, ["bar", "foobar", "fobar"]);
+            check(/(ab|a)(bc|c)/, ["abc", "ac", "abbc"]);
+            check(/(a)|(b)/, ["b", "a", "c"]);
+        }
+    },
+    {
+        name: "Assertions",
+        body: function () {
+            check(/^foo|bar$/m, ["foo", "x\nfoo", "bar\nx", "xbar", "xfoo\u2028foo"]);
+            check(/\bcat\b/, ["cat", "concat", "a cat.", "cats"]);
+            check(/\Bat/, ["cat", "at", "a at"]);
+            check(/^\s*(\w+)/, ["  word", "word", "  "]);
+            check(/\d$/, ["abc1", "1a", ""]);
+        }
+    },
+    {
+        name: "Flags",
+        body: function () {
+            var global = /o/g;
+            for (var run = 0; run < runs; run++) {
+                assert.areEqual("f00", "foo".replace(/o/g, "0"), "replace, run " + run);
+                assert.areEqual(2, "foo".match(global).length, "match all, run " + run);
+            }
+
+            var sticky = /foo/y;
+            for (var run = 0; run < runs; run++) {
+                sticky.lastIndex = run % 4;
+                assert.areEqual(run % 4 === 1, sticky.test("xfoo"), "sticky at " + (run % 4));
+            }
+        }
+    },
+    {
+        name: "Heavy backtracking gives the same answer",
+        body: function () {
+            var input = repeat("x", 100);
+            check(/^[x]*[x]*[x]*y/, [input, input + "y"]);
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Replace appends the captures a substitution pattern names straight from the input, and only makes strings of the
+// captures a replace function can see. Neither may change what ends up in the result or what the function is passed.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+var tests = [
+    {
+        name: "Substitution patterns",
+        body: function () {
+            assert.areEqual("b-a", "a-b".replace(/(\w)-(\w)/, "$2-$1"));
+            assert.areEqual("[ab|$5| ] [|$5|c d]", "a-b c d".replace(/(\w)-(\w)|(\w) (\w)/g, "[$1$2|$5|$3 $4]"));
+            assert.areEqual("pre <x-y|x-y|pre | post> post", "pre x-y post".replace(/(x)-(y)/, "<$&|$1-$2|$`|$'>"));
+            assert.areEqual("$$1 $", "ab".replace(/(a)b/, "$$$$1 $"));
+            assert.areEqual("[] []", "a b".replace(/(x)?(\w)/g, "[$1]"));
+            assert.areEqual("$3 $0 $00", "ab".replace(/(a)(b)/, "$3 $0 $00"));
+        }
+    },
+    {
+        name: "Two digit group numbers",
+        body: function () {
+            var tenGroups = /(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)/;
+            assert.areEqual("j a0 j", "abcdefghij".replace(tenGroups, "$10 $010 $10"));
+            assert.areEqual("a1", "ab".replace(/(a)b/, "$11"));
+            assert.areEqual("a1 a", "ab".replace(/(a)b/, "$11 $01"));
+        }
+    },
+    {
+        name: "Long captures",
+        body: function () {
+            var long = repeat("x", 5000);
+            var result = ("<" + long + "|" + long + "y>").replace(/<(x+)\|(x+y)>/, "$2$1");
+            assert.areEqual(10001, result.length);
+            assert.areEqual(long + "y" + long, result);
+
+            var words = repeat("word-1 ", 500);
+            assert.areEqual(repeat("1=word ", 500), words.replace(/(\w+)-(\d)/g, "$2=$1"));
+        }
+    },
+    {
+        name: "Replace functions see every capture they can observe",
+        body: function () {
+            var input = "a-b c-d";
+            var regex = /(\w)-(\w)/g;
+
+            assert.areEqual("a a-b c c-d", input.replace(regex, function (m, p1) { "use strict"; return p1 + " " + m; }));
+            assert.areEqual("b d", input.replace(regex, function (m, p1, p2) { "use strict"; return p2; }));
+            assert.areEqual("0 4", input.replace(regex, function (m, p1, p2, offset) { "use strict"; return offset; }));
+            assert.areEqual("a,b,0,a-b c-d c,d,4,a-b c-d", input.replace(regex, function () { "use strict"; return Array.prototype.slice.call(arguments, 1).join(); }));
+            assert.areEqual("b d", input.replace(regex, function (m) { return arguments[2]; }));
+            assert.areEqual("b d", input.replace(regex, function (m) { "use strict"; return eval("arguments[2]"); }));
+            assert.areEqual("b d", input.replace(regex, function (m) { return eval("arguments[2]"); }));
+            assert.areEqual("b d", input.replace(regex, (m, p1, p2) => p2));
+            assert.areEqual("x x", input.replace(regex, function () { "use strict"; return "x"; }));
+
+            var lengths = [];
+            input.replace(regex, function (m) { "use strict"; lengths.push(m.length); });
+            assert.areEqual("3,3", lengths.join());
+
+            class Replacer {
+                static second(m, p1, p2) { return p2.toUpperCase(); }
+                static rest(m, ...rest) { return rest[0] + "|" + rest[1]; }
+            }
+            assert.areEqual("B D", input.replace(regex, Replacer.second));
+            assert.areEqual("a|b c|d", input.replace(regex, Replacer.rest));
+        }
+    },
+    {
+        name: "Undefined captures passed to replace functions",
+        body: function () {
+            var seen = [];
+            "ab".replace(/(x)?(a)|(b)/g, function (m, p1, p2, p3) {
+                "use strict";
+                seen.push(String(p1) + "/" + String(p2) + "/" + String(p3));
+                return m;
+            });
+            assert.areEqual("undefined/a/undefined,undefined/undefined/b", seen.join());
+        }
+    },
+    {
+        name: "Sticky and non-global regexes",
+        body: function () {
+            var sticky = /(\w)-(\w)/y;
+            assert.areEqual("b a-b", "a-b a-b".replace(sticky, "$2"));
+            assert.areEqual(3, sticky.lastIndex);
+            assert.areEqual("a-b a-b", "a-b a-b".replace(sticky, "$2"));
+            assert.areEqual(0, sticky.lastIndex);
+            assert.areEqual("a c-d", "a-b c-d".replace(/(\w)-(\w)/, function (m, p1) { "use strict"; return p1; }));
+        }
+    },
+    {
+        name: "Split with captures",
+        body: function () {
+            assert.areEqual(["a", "-", undefined, "b", undefined, "+", "c"], "a-b+c".split(/(-)|(\+)/));
+            assert.areEqual(["a", "b"], "a-b".split(/-/));
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
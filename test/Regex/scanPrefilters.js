@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Scanning for a character class, for one of several literals or for a literal every match needs looks at a block of
+// characters at a time. Matches must be found wherever they fall relative to those blocks.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+function matchOf(regex, input) {
+    var result = regex.exec(input);
+    return result && Array.prototype.slice.call(result);
+}
+
+// Puts the match after each number of filler characters up to a few blocks' worth
+function checkAtEachOffset(regex, filler, match, expected) {
+    for (var n = 0; n < 40; n++) {
+        var result = regex.exec(repeat(filler, n) + match + repeat(filler, n % 5));
+        assert.areNotEqual(null, result, regex + " after " + n + " fillers");
+        assert.areEqual(n, result.index, regex + " index after " + n + " fillers");
+        assert.areEqual(expected, result[0], regex + " after " + n + " fillers");
+    }
+    assert.areEqual(null, regex.exec(repeat(filler, 41)), regex + " on fillers only");
+}
+
+var tests = [
+    {
+        name: "Character classes",
+        body: function () {
+            checkAtEachOffset(/\w+/, " ", "abc", "abc");
+            checkAtEachOffset(/[^\s]+/, "\t", "a-b", "a-b");
+            checkAtEachOffset(/\d+x/, "-", "123x", "123x");
+            checkAtEachOffset(/[aeiou]z/, "b", "ez", "ez");
+            checkAtEachOffset(/[\u4e00-\u9fff]+/, "a", "\u4e2d\u6587", "\u4e2d\u6587");
+            checkAtEachOffset(/[^\u0000-\u00ff]/, "\u00ff", "\u0100", "\u0100");
+            checkAtEachOffset(/[\uffff]\u0000/, "\ufffe", "\uffff\u0000", "\uffff\u0000");
+
+            // More ranges than are looked for at once
+            checkAtEachOffset(/[acegikmoqsuwy]+/, "b", "ca", "ca");
+            checkAtEachOffset(/[^bdfhjlnprtvxz]+/, "b", "ca", "ca");
+        }
+    },
+    {
+        name: "Alternative literals",
+        body: function () {
+            checkAtEachOffset(/(?:foo|bar|bazz)\d/, "x", "bazz1", "bazz1");
+            checkAtEachOffset(/(?:foo|bar|bazz)\d/, "x", "bar2", "bar2");
+            checkAtEachOffset(/x*(?:foo|bar|bazz)\d/, "y", "foo3", "foo3");
+            checkAtEachOffset(/(?:hello|world)!/i, "x", "WoRlD!", "WoRlD!");
+
+            // The earliest literal wins, whichever alternative it is, and a literal that doesn't complete the match
+            // moves the scan past it
+            assert.areEqual(["bar1", "bar"], matchOf(/(foo|bar)\d/, "bar1 foo2"));
+            assert.areEqual(["foo2", "foo"], matchOf(/(foo|bar)\d/, "barx foo2 bar3"));
+            assert.areEqual(["xaab"], matchOf(/.?(?:ab|aab)/, "xaab"));
+            assert.areEqual("x[foo]y[bar]z[bazz]", "xfooybarzbazz".replace(/foo|bar|bazz/g, "[$&]"));
+            assert.areEqual(["ab", "ab", "ab"], (repeat("x", 9) + "ab" + repeat("x", 17) + "ab" + "ab").match(/ab|cd/g));
+        }
+    },
+    {
+        name: "Required literals",
+        body: function () {
+            checkAtEachOffset(/\w+@example\.com/, " ", "me@example.com", "me@example.com");
+            checkAtEachOffset(/(\d+)-needle-(\d+)/, "-", "1-needle-2", "1-needle-2");
+            checkAtEachOffset(/(?:ab)+needle/, "x", "ababneedle", "ababneedle");
+
+            var long = repeat("word ", 1000);
+            assert.areEqual(null, /\w+needle\w+/.exec(long), "missing literal");
+            assert.areEqual(null, /(\w+)(needle)?\d/.exec(long), "optional literal, no digit");
+            assert.areEqual(["wordneedleword"], matchOf(/\w+needle\w+/, long + "wordneedleword"));
+            assert.areEqual(["word9"], matchOf(/\w+(?:needle)?\d/, long + "word9"));
+            assert.areEqual(["word9"], matchOf(/\w+(?:needle|9)/, long + "word9"));
+            assert.areEqual(["ab", undefined, "ab"], matchOf(/(a|b)+ab|(ab)/, "xab"));
+
+            // Only the rest of the input has to have the literal
+            var regex = /\w+-tail/g;
+            var input = "a-tail b-tail c-tai";
+            assert.areEqual("a-tail", regex.exec(input)[0]);
+            assert.areEqual("b-tail", regex.exec(input)[0]);
+            assert.areEqual(null, regex.exec(input));
+            assert.areEqual(0, regex.lastIndex);
+
+            assert.areEqual("[a-tail] [b-tail] c-tai", input.replace(/\w+-tail/g, "[$&]"));
+            assert.areEqual(["one", "two", "three"], "one--sep--two--sep--three".split(/-+sep-+/));
+            assert.areEqual(["no separator"], "no separator".split(/-+sep-+/));
+            assert.areEqual(["x1-tail", "x2-tail"], "x1-tail x2-tail".match(/\w+-tail/g));
+        }
+    },
+    {
+        name: "Anchored and sticky patterns",
+        body: function () {
+            assert.areEqual(["ab-tail"], matchOf(/^\w+-tail/, "ab-tail"));
+            assert.areEqual(null, /^\w+-tail/.exec(" ab-tail"));
+
+            var sticky = /\w+-tail/y;
+            sticky.lastIndex = 2;
+            assert.areEqual(["b-tail"], matchOf(sticky, "a b-tail"));
+            sticky.lastIndex = 1;
+            assert.areEqual(null, sticky.exec("a b-tail"));
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Script contexts on the same thread share the compiled program of a regex with the same source and flags. Each regex
+// must still keep its own lastIndex and match results, and keep working after the others are gone.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var remoteSource =
+    "var word = /(\\w+)-(\\d+)/g;" +
+    "var sticky = /(\\w+)-(\\d+)/y;" +
+    "var caseless = /(\\w+)-(\\d+)/gi;" +
+    "function dynamic() { return new RegExp('(\\\\w+)-(\\\\d+)', 'g'); }" +
+    "function firstGroup(input) { return /(\\w+)-(\\d+)/.test(input) ? RegExp.$1 : null; }";
+
+var tests = [
+    {
+        name: "Regexes with the same source in other script contexts match independently",
+        body: function () {
+            var remotes = [WScript.LoadScript(remoteSource, "samethread"), WScript.LoadScript(remoteSource, "samethread")];
+            var word = /(\w+)-(\d+)/g;
+            var input = "a-1 b-2 c-3";
+
+            assert.areEqual("a-1", word.exec(input)[0]);
+            assert.areEqual("a-1", remotes[0].word.exec(input)[0]);
+            assert.areEqual("b-2", word.exec(input)[0]);
+            assert.areEqual("a-1", remotes[1].word.exec(input)[0]);
+            assert.areEqual("b-2", remotes[0].word.exec(input)[0]);
+            assert.areEqual(7, word.lastIndex);
+            assert.areEqual(7, remotes[0].word.lastIndex);
+            assert.areEqual(3, remotes[1].word.lastIndex);
+
+            assert.areEqual("c", remotes[1].firstGroup("c-3"));
+            assert.areEqual("d", remotes[0].firstGroup("d-4"));
+            assert.areEqual("c", remotes[1].RegExp.$1, "RegExp.$1 is per script context");
+        }
+    },
+    {
+        name: "Flags are part of what is shared",
+        body: function () {
+            var remote = WScript.LoadScript(remoteSource, "samethread");
+
+            assert.areEqual(null, remote.sticky.exec(" a-1"));
+            assert.areEqual(0, remote.sticky.lastIndex);
+            remote.sticky.lastIndex = 1;
+            assert.areEqual("a-1,a,1", remote.sticky.exec(" a-1").join());
+            assert.areEqual(4, remote.sticky.lastIndex);
+
+            assert.areEqual("[A-1] [b-2]", "A-1 b-2".replace(remote.caseless, "[$&]"));
+            assert.areEqual("[A-1] [b-2]", "A-1 b-2".replace(/(\w+)-(\d+)/gi, "[$&]"));
+            assert.areEqual(null, "-1".match(/(\w+)-(\d+)/gi));
+        }
+    },
+    {
+        name: "Dynamic regexes share programs too",
+        body: function () {
+            var remote = WScript.LoadScript(remoteSource, "samethread");
+            var local = new RegExp("(\\w+)-(\\d+)", "g");
+            var remoteRegex = remote.dynamic();
+
+            assert.areEqual(["x-1", "y-2"], "x-1 y-2".match(local));
+            assert.areEqual("x-1,y-2", "x-1 y-2".match(remoteRegex).join());
+            assert.areEqual("x", remoteRegex.exec("x-1 y-2")[1]);
+            assert.areEqual("y", remoteRegex.exec("x-1 y-2")[1]);
+            assert.areEqual(0, local.lastIndex);
+        }
+    },
+    {
+        name: "Regexes keep working after the script context that compiled them first is gone",
+        body: function () {
+            (function () {
+                var remote = WScript.LoadScript("var first = /first-(\\d+)-program/g; first.test('first-1-program');", "samethread");
+                remote = null;
+            })();
+            CollectGarbage();
+            CollectGarbage();
+
+            var regex = new RegExp("first-(\\d+)-program", "g");
+            assert.areEqual("first-2-program first-3-program", "first-2-program first-3-program".match(regex).join(" "));
+            assert.areEqual("3", /first-(\d+)-program/.exec("first-3-program")[1]);
+
+            var later = WScript.LoadScript("var first = /first-(\\d+)-program/g;", "samethread");
+            assert.areEqual("first-4-program", "x first-4-program".match(later.first).join());
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse keeps string values that only contain Latin-1 characters in a one-byte representation.
+// Exercise them through the paths that read them directly as well as the ones that widen them.
+
+var failed = false;
+function check(actual, expected, message)
+{
+    if (actual !== expected)
+    {
+        WScript.Echo("FAILED: " + message + ": expected '" + expected + "', got '" + actual + "'");
+        failed = true;
+    }
+}
+
+function parsed(text)
+{
+    return JSON.parse(JSON.stringify({ value: text })).value;
+}
+
+var latin1 = "caf\u00e9 au lait, cr\u00e8me br\u00fbl\u00e9e";
+var ascii = "the quick brown fox jumps over the lazy dog";
+var wide = "wide \u0100\u4e2d characters are not Latin-1";
+
+for (var i = 0; i < 100; i++)
+{
+    [latin1, ascii, wide].forEach(function (expected)
+    {
+        // Fresh strings, so each check starts from the one-byte form
+        check(parsed(expected).length, expected.length, "length");
+        check(parsed(expected) === expected, true, "equality with a flat string");
+        check(parsed(expected) === parsed(expected), true, "equality with another parsed string");
+        check(parsed(expected) === parsed(expected + "!"), false, "inequality");
+        check(parsed(expected).charCodeAt(3), expected.charCodeAt(3), "charCodeAt");
+        check(parsed(expected).charAt(expected.length - 1), expected.charAt(expected.length - 1), "charAt");
+        check(parsed(expected)[5], expected[5], "index");
+        check("<" + parsed(expected) + ">", "<" + expected + ">", "concat");
+        check(parsed(expected).indexOf("l"), expected.indexOf("l"), "indexOf");
+        check(parsed(expected).toUpperCase(), expected.toUpperCase(), "toUpperCase");
+        check(parsed(expected).substring(2, 9), expected.substring(2, 9), "substring");
+        check(JSON.stringify(parsed(expected)), JSON.stringify(expected), "stringify");
+
+        var o = {};
+        o[parsed(expected)] = i;
+        check(o[expected], i, "property key");
+    });
+}
+
+// Hot loops over one string, which the JIT reads a character at a time from either buffer width
+function scan(str)
+{
+    var sum = 0, text = "";
+    for (var j = 0; j < str.length; j++)
+    {
+        sum += str.charCodeAt(j) + str.codePointAt(j);
+        text += str.charAt(j) + str[j];
+    }
+    return sum + text;
+}
+
+function countEqual(strs, other)
+{
+    var count = 0;
+    for (var j = 0; j < strs.length; j++)
+    {
+        if (strs[j] === other)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+[latin1, ascii, wide].forEach(function (expected)
+{
+    var strs = [];
+    for (var i = 0; i < 10; i++)
+    {
+        check(scan(parsed(expected)), scan(expected), "scan");
+        strs.push(parsed(expected), parsed(expected + "!"));
+    }
+    check(countEqual(strs, parsed(expected)), 10, "jitted equality");
+    check(countEqual(strs, parsed(expected)), 10, "jitted equality after widening");
+});
+
+check(parsed("\u00ff\u00fe short") === "\u00ff\u00fe short", true, "short string");
+check(parsed("\u0000 null character is one byte too") === "\u0000 null character is one byte too", true, "embedded null");
+
+if (!failed)
+{
+    WScript.Echo("pass");
+}
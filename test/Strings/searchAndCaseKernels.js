@@ -0,0 +1,154 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String search, comparison and case mapping scan several characters at a time. Check them against
+// character-by-character reference implementations at every offset around the block boundaries.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function referenceIndexOf(s, search, position) {
+    for (var k = Math.min(Math.max(position, 0), s.length); k + search.length <= s.length; k++) {
+        if (s.substr(k, search.length) === search) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+function referenceLastIndexOf(s, search, position) {
+    for (var k = Math.min(Math.max(position, 0), s.length - search.length); k >= 0; k--) {
+        if (s.substr(k, search.length) === search) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+function repeat(c, n) {
+    return new Array(n + 1).join(c);
+}
+
+var tests = [
+    {
+        name: "indexOf and lastIndexOf find matches at every offset",
+        body: function () {
+            var searches = ["x", "xy", "xyz", "x\u4e2dz", "needle", "abcdefghijklmnopq", repeat("a", 7) + "x"];
+            for (var length = 0; length < 40; length++) {
+                for (var s = 0; s < searches.length; s++) {
+                    var search = searches[s];
+                    for (var at = 0; at + search.length <= length; at++) {
+                        var text = repeat("a", at) + search + repeat("a", length - at - search.length);
+                        assert.areEqual(at, text.indexOf(search), "indexOf '" + search + "' at " + at + " in length " + length);
+                        assert.areEqual(at, text.lastIndexOf(search), "lastIndexOf '" + search + "' at " + at + " in length " + length);
+                        assert.isTrue(text.includes(search), "includes '" + search + "' at " + at);
+                        assert.areEqual(-1, text.indexOf(search, at + 1), "indexOf past the only match");
+                        if (at > 0) {
+                            assert.areEqual(-1, text.lastIndexOf(search, at - 1), "lastIndexOf before the only match");
+                        }
+                    }
+                }
+            }
+        }
+    },
+    {
+        name: "Repeated near-matches pick the first or last full match",
+        body: function () {
+            var text = "";
+            for (var i = 0; i < 30; i++) {
+                text += "ab" + (i % 7 === 3 ? "c" : "a");
+            }
+            var searches = ["abc", "aba", "bab", "ca", "abcab", "a", "c", "abd", "\u00e9"];
+            for (var s = 0; s < searches.length; s++) {
+                for (var position = -1; position <= text.length + 1; position++) {
+                    assert.areEqual(referenceIndexOf(text, searches[s], position), text.indexOf(searches[s], position),
+                        "indexOf '" + searches[s] + "' from " + position);
+                    assert.areEqual(referenceLastIndexOf(text, searches[s], position), text.lastIndexOf(searches[s], position),
+                        "lastIndexOf '" + searches[s] + "' from " + position);
+                }
+            }
+            assert.areEqual(5, "abcde".indexOf("", 10), "empty string is found at the clamped position");
+            assert.areEqual(5, "abcde".lastIndexOf(""), "empty string is found at the end");
+            assert.areEqual(-1, "abc".indexOf("abcd"), "search longer than the string");
+            assert.areEqual(-1, "abc".lastIndexOf("abcd"), "search longer than the string, backwards");
+        }
+    },
+    {
+        name: "Long search strings and surrogate pairs",
+        body: function () {
+            var sentence = "the quick brown fox jumps over the lazy dog";
+            var text = repeat("-", 50) + sentence + repeat("-", 13) + sentence + repeat("-", 3);
+            assert.areEqual(50, text.indexOf(sentence), "long search, first");
+            assert.areEqual(50 + sentence.length + 13, text.lastIndexOf(sentence), "long search, last");
+
+            var pair = "\ud83d\ude00";
+            var emoji = repeat("\ud83d\ude01", 9) + pair + repeat("\ud83d\ude01", 9);
+            assert.areEqual(18, emoji.indexOf(pair), "surrogate pair");
+            assert.areEqual(19, emoji.indexOf("\ude00"), "lone trail surrogate");
+            assert.areEqual(36, emoji.lastIndexOf("\ud83d"), "lone lead surrogate, backwards");
+        }
+    },
+    {
+        name: "startsWith, endsWith and comparisons differ at every offset",
+        body: function () {
+            for (var length = 1; length < 36; length++) {
+                var base = "";
+                for (var i = 0; i < length; i++) {
+                    base += String.fromCharCode(0x41 + i % 26);
+                }
+                for (var diff = 0; diff < length; diff++) {
+                    var lower = base.substr(0, diff) + "@" + base.substr(diff + 1);
+                    var higher = base.substr(0, diff) + "\uffff" + base.substr(diff + 1);
+                    assert.isFalse(base.startsWith(lower), "startsWith, difference at " + diff);
+                    assert.isFalse(("x" + base).endsWith(higher), "endsWith, difference at " + diff);
+                    assert.isTrue(lower < base && base < higher, "relational comparison, difference at " + diff);
+                    assert.isFalse(base == lower, "equality, difference at " + diff);
+                    assert.areEqual(0, (base + "").localeCompare(base.substr(0, length)), "localeCompare of equal strings");
+                }
+                assert.isTrue(("x" + base + "y").startsWith(base, 1), "startsWith at a position");
+                assert.isTrue(base.substr(0, length - 1) < base, "prefix sorts first");
+            }
+        }
+    },
+    {
+        name: "Case mapping of ASCII strings and strings with non-ASCII characters",
+        body: function () {
+            var ascii = "";
+            for (var c = 0; c < 0x80; c++) {
+                ascii += String.fromCharCode(c);
+            }
+            for (var start = 0; start < 20; start++) {
+                var s = ascii.substr(start) + ascii.substr(0, start);
+                var lower = "", upper = "";
+                for (var i = 0; i < s.length; i++) {
+                    var code = s.charCodeAt(i);
+                    lower += String.fromCharCode(code >= 0x41 && code <= 0x5a ? code + 0x20 : code);
+                    upper += String.fromCharCode(code >= 0x61 && code <= 0x7a ? code - 0x20 : code);
+                }
+                assert.areEqual(lower, s.toLowerCase(), "ASCII toLowerCase rotated by " + start);
+                assert.areEqual(upper, s.toUpperCase(), "ASCII toUpperCase rotated by " + start);
+            }
+
+            assert.areEqual("HELLO WORLD, \u00c7A VA", "hello world, \u00e7a va".toUpperCase(), "non-ASCII after ASCII");
+            assert.areEqual("abcdefghij\u00e0", "ABCDEFGHIJ\u00c0".toLowerCase(), "non-ASCII at the end of a block");
+            assert.areEqual("ABCDEFGH \u0394\u039f\u039c\u0395", "abcdefgh \u03b4\u03bf\u03bc\u03b5".toUpperCase(), "Greek after ASCII");
+            var unchanged = "already lower case";
+            assert.areEqual(unchanged, unchanged.toLowerCase(), "nothing to map");
+        }
+    },
+    {
+        name: "Regular expressions that skip ahead to a character",
+        body: function () {
+            for (var at = 0; at < 40; at++) {
+                var text = repeat("-", at) + "x1" + repeat("-", 5);
+                assert.areEqual(at, text.search(/x\d/), "single character, match at " + at);
+                assert.areEqual(at, text.search(/[xy]\d/), "two characters, match at " + at);
+                assert.areEqual("x1", text.match(/x./)[0], "match at " + at);
+                assert.areEqual(-1, repeat("-", at).search(/x\d/), "no match in length " + at);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
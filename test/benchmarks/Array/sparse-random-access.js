@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Writes and reads random indices of large sparse arrays, so that lookups go through the segment B-tree
+// and nearby writes land in a growing number of segments. Run with: perl perftest.pl -dir:Array -binary:<path to ch>
+
+var _startDate = new Date();
+
+var seed = 1;
+function random(n) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed % n;
+}
+
+var checksum = 0;
+for (var iteration = 0; iteration < 10; iteration++) {
+    var ints = [], values = [];
+    for (var i = 0; i < 50000; i++) {
+        var index = random(10000000);
+        ints[index] = i;
+        values[random(1000000)] = "x";
+    }
+    for (var i = 0; i < 200000; i++) {
+        var v = ints[random(10000000)];
+        if (v !== undefined) {
+            checksum += v;
+        }
+        checksum += values[random(1000000)] === "x" ? 1 : 0;
+    }
+}
+
+if (checksum === 0) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
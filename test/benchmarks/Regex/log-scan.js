@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs a handful of hot regular expressions over the lines of a generated server log, the kind of loop where each
+// pattern is matched thousands of times. Run with: perl perftest.pl -dir:Regex -binary:<path to ch>
+// Native regex code is off by default; -RegexJitThreshold:32 turns it on for comparison.
+
+var _startDate = new Date();
+
+var methods = ["GET", "POST", "PUT", "DELETE"];
+var lines = [];
+for (var i = 0; i < 20000; i++) {
+    lines.push("10.0." + (i % 256) + "." + (i * 7 % 256) + " - user" + (i % 97) + " [12/Mar/2017:10:" +
+        (i % 60) + ":" + (i * 13 % 60) + "] \"" + methods[i % methods.length] + " /api/items/" + i +
+        "?page=" + (i % 10) + " HTTP/1.1\" " + (i % 17 === 0 ? 404 : 200) + " " + (i * 31 % 5000) +
+        (i % 5 === 0 ? " contact: admin" + (i % 7) + "@example.com" : ""));
+}
+
+var request = /"(GET|POST|PUT|DELETE) ([^ ?"]+)[^"]*" (\d{3}) (\d+)/;
+var email = /(\w+)@(\w+)\.com/;
+var notFound = /" 404 /;
+var address = /^\d+\.\d+\.\d+\.\d+/;
+
+var bytes = 0, emails = 0, missing = 0, addresses = 0;
+for (var iteration = 0; iteration < 10; iteration++) {
+    for (var j = 0; j < lines.length; j++) {
+        var line = lines[j];
+        var m = request.exec(line);
+        if (m) {
+            bytes += +m[4];
+        }
+        if (email.test(line)) {
+            emails++;
+        }
+        if (notFound.test(line)) {
+            missing++;
+        }
+        if (address.test(line)) {
+            addresses++;
+        }
+    }
+}
+
+if (emails !== 10 * 4000 || addresses !== 10 * lines.length || missing === 0 || bytes === 0) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Validates generated input against patterns with nested quantifiers, where a near miss makes a backtracking matcher
+// try exponentially many ways to split the input. Run with: perl perftest.pl -dir:Regex -binary:<path to ch>
+
+var _startDate = new Date();
+
+var validators = [
+    /^(\w+\s?)+$/,
+    /^([a-z0-9]+[._-]?)+@example\.com$/,
+    /^(\d+,?)+;$/
+];
+
+function repeat(s, n) {
+    return new Array(n + 1).join(s);
+}
+
+var inputs = [];
+for (var i = 0; i < 200; i++) {
+    var n = 16 + i % 8;
+    inputs.push(repeat("word ", n) + (i % 2 === 0 ? "!" : "end"));
+    inputs.push(repeat("first.last", n % 4 + 1) + (i % 2 === 0 ? "@example.org" : "@example.com"));
+    inputs.push(repeat("12345", n) + (i % 2 === 0 ? ";!" : ";"));
+}
+
+var valid = 0;
+for (var iteration = 0; iteration < 5; iteration++) {
+    for (var j = 0; j < inputs.length; j++) {
+        if (validators[j % validators.length].test(inputs[j])) {
+            valid++;
+        }
+    }
+}
+
+if (valid !== 5 * 300) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
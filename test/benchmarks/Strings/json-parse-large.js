@@ -0,0 +1,38 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Parses a large pretty-printed API response, the kind of payload where most of the text is indentation, property
+// names and short strings. Run with: perl perftest.pl -dir:Strings -binary:<path to ch>
+
+var _startDate = new Date();
+
+var tags = ["alpha", "beta", "gamma", "delta", "epsilon"];
+var items = [];
+for (var i = 0; i < 5000; i++) {
+    items.push({
+        id: i,
+        name: "item number " + i,
+        description: "A reasonably long description for item " + i + " that needs no escaping at all",
+        price: (i * 37) % 1000 + 0.99,
+        stock: (i * 7919) % 500,
+        active: i % 3 !== 0,
+        tags: [tags[i % tags.length], tags[(i + 2) % tags.length]],
+        owner: { id: i % 97, login: "user" + (i % 97), path: "C:\\users\\user" + (i % 97) }
+    });
+}
+var text = JSON.stringify({ count: items.length, items: items }, null, 4);
+
+var total = 0;
+for (var iteration = 0; iteration < 20; iteration++) {
+    total += JSON.parse(text).items.length;
+}
+
+if (total !== 20 * items.length) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
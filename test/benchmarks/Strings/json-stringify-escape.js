@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Stringifies records whose string values need escaping, so that the output tree is full of escaped strings
+// that are flattened into the final buffer. Run with: perl perftest.pl -dir:Strings -binary:<path to ch>
+
+var _startDate = new Date();
+
+var records = [];
+for (var i = 0; i < 5000; i++) {
+    records.push({
+        id: i,
+        title: "Item \"" + i + "\"\tin stock",
+        path: "C:\\data\\items\\" + i + ".json",
+        description: "Line one of item " + i + "\nLine two of item " + i + "\n",
+        tags: ["a\"b", "c\\d", "plain" + i]
+    });
+}
+
+var totalLength = 0;
+for (var iteration = 0; iteration < 20; iteration++) {
+    var json = JSON.stringify(records);
+    totalLength += json.charCodeAt(0) === 91 ? json.length : 0;
+}
+
+if (totalLength === 0) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
@@ -0,0 +1,37 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Serializes an API response made of thousands of objects with the same few properties, the way a service
+// renders a page of database rows. Run with: perl perftest.pl -dir:Strings -binary:<path to ch>
+
+var _startDate = new Date();
+
+function Row(i) {
+    this.id = i;
+    this.firstName = "first" + (i % 50);
+    this.lastName = "last" + (i % 70);
+    this.active = i % 3 !== 0;
+    this.balance = i * 17 % 10000;
+    this.address = { street: i + " Main Street", city: "City " + (i % 20), zip: 10000 + i % 900 };
+}
+
+var rows = [];
+for (var i = 0; i < 5000; i++) {
+    rows.push(new Row(i));
+}
+
+var totalLength = 0;
+for (var iteration = 0; iteration < 20; iteration++) {
+    var json = JSON.stringify({ page: iteration, rows: rows });
+    totalLength += json.charCodeAt(0) === 123 ? json.length : 0;
+}
+
+if (totalLength === 0) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Renders a table through nested templates, the way a template engine builds its output: each row and cell is
+// built from several pieces and the pieces are joined into ever larger string trees, which are flattened once at
+// the end. Run with: perl perftest.pl -dir:Strings -binary:<path to ch>
+
+var _startDate = new Date();
+
+var rowCount = 2000;
+var columnNames = ["id", "name", "email", "city", "country", "score"];
+var cities = ["Lisbon", "Oslo", "Kyoto", "Lima", "Nairobi", "Quebec", "Tallinn", "Hobart"];
+var rows = [];
+for (var i = 0; i < rowCount; i++) {
+    rows.push({
+        id: i,
+        name: "user_" + i,
+        email: "user_" + i + "@example.com",
+        city: cities[i % cities.length],
+        country: "Country " + (i % 37),
+        score: (i * 7919) % 1000
+    });
+}
+
+function renderCell(name, value) {
+    return '<td class="col-' + name + '">' + value + '</td>';
+}
+
+function renderRow(row, index) {
+    var cells = "";
+    for (var c = 0; c < columnNames.length; c++) {
+        cells = cells + renderCell(columnNames[c], row[columnNames[c]]);
+    }
+    return '<tr class="' + (index % 2 ? "odd" : "even") + '" data-id="' + row.id + '">' + cells + '</tr>\n';
+}
+
+function renderTable() {
+    var header = "";
+    for (var c = 0; c < columnNames.length; c++) {
+        header = header + '<th>' + columnNames[c] + '</th>';
+    }
+    var body = "";
+    for (var r = 0; r < rows.length; r++) {
+        // Prepend some rows and append others so that the tree grows on both sides
+        body = r % 4 === 0 ? renderRow(rows[r], r) + body : body + renderRow(rows[r], r);
+    }
+    return '<table>\n<thead><tr>' + header + '</tr></thead>\n<tbody>\n' + body + '</tbody>\n</table>\n';
+}
+
+var totalLength = 0;
+for (var iteration = 0; iteration < 20; iteration++) {
+    var html = renderTable();
+    // Force the tree to be flattened
+    totalLength += html.charCodeAt(html.length - 1) === 10 ? html.length : 0;
+}
+
+if (totalLength === 0) {
+    throw "ERROR: bad result";
+}
+
+var _interval = new Date() - _startDate;
+
+WScript.Echo("### TIME:", _interval, "ms");
@@ -0,0 +1,175 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map and Set ordering, key equality, and iterator stability across the table rebuilds caused by
+// growth, delete-heavy workloads, and clear.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function keysOf(collection) {
+    var keys = [];
+    collection.forEach(function (value, key) { keys.push(key); });
+    return keys;
+}
+
+var tests = [
+    {
+        name: "Numbers equal under SameValueZero are the same key whatever their representation",
+        body: function () {
+            var map = new Map();
+            map.set(1, "int");
+            map.set(1.5, "double");
+            map.set(0, "zero");
+            map.set(NaN, "nan");
+            map.set(Math.pow(2, 40), "large");
+
+            assert.areEqual("int", map.get(2 / 2), "double value 1 finds the tagged int key 1");
+            assert.areEqual("int", map.get(Math.sqrt(1)), "computed 1 finds key 1");
+            assert.areEqual("zero", map.get(-0), "-0 finds key 0");
+            assert.areEqual("nan", map.get(0 / 0), "any NaN finds key NaN");
+            assert.areEqual("large", map.get(Math.pow(2, 20) * Math.pow(2, 20)), "large integral double is found");
+            assert.areEqual("double", map.get(3 / 2), "double key is found");
+            assert.isFalse(map.has(1 + 1e-15), "nearby double is a different key");
+
+            map.set(1.0, "int again");
+            assert.areEqual(5, map.size, "setting an existing numeric key does not add an entry");
+            assert.areEqual([1, 1.5, 0, NaN, Math.pow(2, 40)], keysOf(map), "overwrite keeps insertion order");
+
+            var set = new Set([1, 1.0, 2 / 2, -0, 0, NaN, 0 / 0]);
+            assert.areEqual(3, set.size, "Set collapses equal numbers");
+            assert.isTrue(Object.is([...set][1], 0), "-0 is normalized to +0 in a Set");
+        }
+    },
+    {
+        name: "Strings are compared by contents and objects by identity",
+        body: function () {
+            var map = new Map();
+            var prefix = "ke";
+            map.set("key", 1);
+            map.set(prefix + "y", 2);
+            map.set(["k", "e", "y"].join(""), 3);
+            assert.areEqual(1, map.size, "strings with the same contents are one key");
+            assert.areEqual(3, map.get("key"), "last set wins");
+
+            var o1 = {}, o2 = {};
+            map.set(o1, "o1");
+            map.set(o2, "o2");
+            assert.areEqual("o1", map.get(o1), "object key o1");
+            assert.areEqual("o2", map.get(o2), "object key o2");
+            assert.isFalse(map.has({}), "a new object is not a key");
+
+            map.set("1", "string one");
+            map.set(1, "number one");
+            assert.areEqual("string one", map.get("1"), "string '1' and number 1 are different keys");
+            assert.areEqual("number one", map.get(1), "number 1 and string '1' are different keys");
+        }
+    },
+    {
+        name: "Insertion order is kept through growth and delete-heavy churn",
+        body: function () {
+            var map = new Map();
+            var expected = [];
+            for (var i = 0; i < 1000; i++) {
+                map.set(i, i * 2);
+                expected.push(i);
+            }
+            for (var i = 0; i < 1000; i += 3) {
+                assert.isTrue(map.delete(i), "delete " + i);
+            }
+            expected = expected.filter(function (k) { return k % 3 !== 0; });
+            for (var i = 0; i < 1000; i += 3) {
+                map.set(i, i * 2);
+                expected.push(i);
+            }
+            assert.areEqual(expected, keysOf(map), "re-added keys go to the end");
+            assert.areEqual(1000, map.size, "size after churn");
+
+            // Delete almost everything so that the table shrinks
+            for (var i = 0; i < 1000; i++) {
+                if (i !== 500 && i !== 7) {
+                    map.delete(i);
+                }
+            }
+            assert.areEqual([7, 500], keysOf(map), "survivors keep their relative order");
+            assert.areEqual(14, map.get(7), "value of 7 survives rebuilds");
+            assert.areEqual(1000, map.get(500), "value of 500 survives rebuilds");
+        }
+    },
+    {
+        name: "Iterators stay valid while entries are deleted and the table is rebuilt",
+        body: function () {
+            var set = new Set();
+            for (var i = 0; i < 64; i++) {
+                set.add(i);
+            }
+
+            var seen = [];
+            for (var v of set) {
+                seen.push(v);
+                // Delete the next two entries, then enough of the rest to shrink the table
+                set.delete(v + 1);
+                set.delete(v + 2);
+                if (v === 30) {
+                    for (var j = 34; j < 64; j++) {
+                        set.delete(j);
+                    }
+                }
+            }
+            assert.areEqual([0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33], seen, "deleted entries are skipped");
+
+            var map = new Map([["a", 1], ["b", 2], ["c", 3]]);
+            var iter = map.keys();
+            assert.areEqual("a", iter.next().value, "first key");
+            // Grow the table several times while the iterator is positioned in the original one
+            map.delete("b");
+            for (var i = 0; i < 100; i++) {
+                map.set("k" + i, i);
+            }
+            assert.areEqual("c", iter.next().value, "iterator moves to the rebuilt table");
+            assert.areEqual("k0", iter.next().value, "entries added while iterating are visited");
+            var count = 0;
+            while (!iter.next().done) {
+                count++;
+            }
+            assert.areEqual(99, count, "remaining entries are visited once");
+            assert.isTrue(iter.next().done, "a finished iterator stays finished");
+            map.set("late", 0);
+            assert.isTrue(iter.next().done, "a finished iterator does not see later additions");
+        }
+    },
+    {
+        name: "Iterators continue with new entries after clear",
+        body: function () {
+            var map = new Map([[1, "a"], [2, "b"], [3, "c"]]);
+            var iter = map.entries();
+            assert.areEqual([1, "a"], iter.next().value, "first entry");
+
+            map.clear();
+            assert.areEqual(0, map.size, "map is empty after clear");
+            map.set(4, "d");
+            map.set(5, "e");
+            assert.areEqual([4, "d"], iter.next().value, "first entry added after clear");
+
+            map.clear();
+            map.clear();
+            map.set(6, "f");
+            assert.areEqual([6, "f"], iter.next().value, "entry added after repeated clears");
+            assert.isTrue(iter.next().done, "done");
+
+            var set = new Set(["x", "y"]);
+            var visited = [];
+            set.forEach(function (v) {
+                visited.push(v);
+                if (v === "x") {
+                    set.clear();
+                    set.add("z");
+                }
+            });
+            assert.areEqual(["x", "z"], visited, "forEach visits entries added after clear");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });